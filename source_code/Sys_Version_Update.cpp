@@ -1686,6 +1686,27 @@ void Sys_Version_Update::check_update_hyd_table_general_param_gpu(QSqlDatabase*
 	Hyd_Model_Floodplain::close_table();
 
 }
+//Check and update the hydraulic view for the instationary floodplain results; the element polygons are not stored anymore per time step, they are joined from the element table (18.10.2026)
+void Sys_Version_Update::check_update_hyd_view_instat_results_fp(QSqlDatabase *ptr_database) {
+	if (Sys_Project::get_project_type() == _sys_project_type::proj_dam ||
+		Sys_Project::get_project_type() == _sys_project_type::proj_fpl ||
+		Sys_Project::get_project_type() == _sys_project_type::proj_hyd_file ||
+		Sys_Project::get_project_type() == _sys_project_type::proj_fpl_file) {
+		return;
+	}
+	bool error = false;
+	//check it
+	if (Hyd_Element_Floodplain::check_erg_instat_view_exists(ptr_database) == false) {
+		try {
+			Hyd_Element_Floodplain::create_erg_instat_view(ptr_database);
+		}
+		catch (Error msg) {
+			error = true;
+		}
+	}
+	Hyd_Element_Floodplain::close_erg_instat_table();
+	Hyd_Element_Floodplain::close_table();
+}
 //Set error(s)
 Error Sys_Version_Update::set_error(const int err_type){
 	string place="Sys_Version_Update::";
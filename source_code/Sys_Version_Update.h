@@ -67,6 +67,9 @@ public:
 	//Check and update the floodplain table (hyd_floodplain_general_prm) to support GPU, by adding columns for scheme type, courant, device,...etc (19.12.2023)
 	void Sys_Version_Update::check_update_hyd_table_general_param_gpu(QSqlDatabase* ptr_database, const string project_file);
 
+	///Check and update the hydraulic view for the instationary floodplain results; the element polygons are not stored anymore per time step, they are joined from the element table (18.10.2026)
+	void check_update_hyd_view_instat_results_fp(QSqlDatabase *ptr_database);
+
 private:
 	///Check and update the text of the hydraulic table of the hydraulic river profile result members; width_max is introduced (18.02.2021)
 	void check_update_hyd_table_river_result_width(QSqlDatabase *ptr_database, const string project_file);
@@ -357,43 +357,33 @@ void Dam_Eco_Btype_Element::output_result_members2database(QSqlDatabase *ptr_dat
 		msg.output_msg(4);
 	}
 }
-//Get the data-string to complete a insert-string for inserting the data of the element results to database
-string Dam_Eco_Btype_Element::get_datastring_results2database(const int global_id, const int bound_sz, const string break_sz, const int raster_id, const double cellsize, const double x_origin, const double y_origin, const bool must_output){
-	string buffer=label::not_set;
-	//no result is written to database
+//Get if the results of the element are output to database (a damage is calculated or the output is required)
+bool Dam_Eco_Btype_Element::get_result_required(const bool must_output){
 	if(must_output==false){
 		if(this->result_dam<constant::zero_epsilon){
-			return buffer;
+			return false;
 		}
 	}
-
-	//set the query via a query string
-	ostringstream query_string;
-	query_string << " ( " ;
-	query_string << global_id << " , " ;
-	query_string << this->elem_index<< " , " ;
-	query_string << raster_id<< " , " ;
-	query_string << this->system_id.area_state << " , " ;
-	query_string << this->system_id.measure_nr << " , " ;
-	query_string << bound_sz << " , " ;
-	query_string << "'"<<break_sz<< "' , " ;
+	return true;
+}
+//Add the element results as row to the bulk writer; false is returned, if a sent package failed
+bool Dam_Eco_Btype_Element::add_results2bulk_writer(Sys_Database_Bulk_Writer *writer, const int global_id, const int bound_sz, const string break_sz, const int raster_id, const double cellsize, const double x_origin, const double y_origin){
+	writer->add_int(global_id);
+	writer->add_int(this->elem_index);
+	writer->add_int(raster_id);
+	writer->add_int(this->system_id.area_state);
+	writer->add_int(this->system_id.measure_nr);
+	writer->add_int(bound_sz);
+	writer->add_text(break_sz);
 	//results
-	query_string << this->result_dam<< " , " ;
-	query_string << this->risk_zone << " , " ;
-
-	if(this->polygon_string==label::not_set){
-		//set the polgon points
-		Geo_Raster_Polygon poly_buff;
-		poly_buff.set_points(&this->mid_point, cellsize, cellsize, 0.0, x_origin, y_origin);
-		this->polygon_string=poly_buff.get_polygon2sql_string();
-	}
-
-	query_string << this->polygon_string ;
-	query_string <<" ) ";
-
-	buffer=query_string.str();
-
-	return buffer;
+	writer->add_double(this->result_dam);
+	writer->add_int(this->risk_zone);
+	//set the polgon points
+	Geo_Raster_Polygon poly_buff;
+	poly_buff.set_points(&this->mid_point, cellsize, cellsize, 0.0, x_origin, y_origin);
+	writer->add_polygon(&poly_buff);
+
+	return writer->end_row();
 }
 //Create the database table for the raster elements (static)
 void Dam_Eco_Btype_Element::create_elem_table(QSqlDatabase *ptr_database){
@@ -1123,9 +1113,8 @@ int Dam_Eco_Btype_Element::get_max_glob_id_erg_table(QSqlDatabase *ptr_database)
 	int id_glob=Dam_Eco_Btype_Element::elem_erg_table->maximum_int_of_column(Dam_Eco_Btype_Element::elem_erg_table->get_column_name(dam_label::glob_id),ptr_database);
 	return id_glob;
 }
-//Get the header for inserting the element result data to database table [static)
-string Dam_Eco_Btype_Element::get_insert_header_erg_table(QSqlDatabase *ptr_database){
-	string buffer;
+//Set the table and the columns of the element result data to the bulk writer (static)
+void Dam_Eco_Btype_Element::set_bulk_writer_erg_table(Sys_Database_Bulk_Writer *writer, QSqlDatabase *ptr_database){
 	//the table is set (the name and the column names) and allocated
 	try{
 		Dam_Eco_Btype_Element::set_erg_table(ptr_database);
@@ -1133,27 +1122,18 @@ string Dam_Eco_Btype_Element::get_insert_header_erg_table(QSqlDatabase *ptr_data
 	catch(Error msg){
 		throw msg;
 	}
-	//set the query via a query string
-	ostringstream query_string;
-	query_string << "INSERT INTO  " << Dam_Eco_Btype_Element::elem_erg_table->get_table_name();
-	query_string <<" ( ";
-	query_string << Dam_Eco_Btype_Element::elem_erg_table->get_column_name(dam_label::glob_id) <<" , ";
-	query_string << Dam_Eco_Btype_Element::elem_erg_table->get_column_name(dam_label::elem_id) <<" , ";
-	query_string << Dam_Eco_Btype_Element::elem_erg_table->get_column_name(dam_label::raster_id) <<" , ";
-	query_string << Dam_Eco_Btype_Element::elem_erg_table->get_column_name(label::areastate_id) <<" , ";
-	query_string << Dam_Eco_Btype_Element::elem_erg_table->get_column_name(label::measure_id) <<" , ";
-	query_string << Dam_Eco_Btype_Element::elem_erg_table->get_column_name(hyd_label::sz_bound_id) <<" , ";
-	query_string << Dam_Eco_Btype_Element::elem_erg_table->get_column_name(risk_label::sz_break_id) <<" , ";
+	writer->set_table(Dam_Eco_Btype_Element::elem_erg_table->get_table_name());
+	writer->add_column(Dam_Eco_Btype_Element::elem_erg_table->get_column_name(dam_label::glob_id));
+	writer->add_column(Dam_Eco_Btype_Element::elem_erg_table->get_column_name(dam_label::elem_id));
+	writer->add_column(Dam_Eco_Btype_Element::elem_erg_table->get_column_name(dam_label::raster_id));
+	writer->add_column(Dam_Eco_Btype_Element::elem_erg_table->get_column_name(label::areastate_id));
+	writer->add_column(Dam_Eco_Btype_Element::elem_erg_table->get_column_name(label::measure_id));
+	writer->add_column(Dam_Eco_Btype_Element::elem_erg_table->get_column_name(hyd_label::sz_bound_id));
+	writer->add_column(Dam_Eco_Btype_Element::elem_erg_table->get_column_name(risk_label::sz_break_id));
 	//results
-	query_string << Dam_Eco_Btype_Element::elem_erg_table->get_column_name(dam_label::btype_cost) <<" , ";
-	query_string << Dam_Eco_Btype_Element::elem_erg_table->get_column_name(dam_label::btype_damage_zone) <<" , ";
-
-	query_string << Dam_Eco_Btype_Element::elem_erg_table->get_column_name(dam_label::elem_poly) <<" ) ";
-
-	query_string << " VALUES ";
-
-	buffer=query_string.str();
-	return buffer;
+	writer->add_column(Dam_Eco_Btype_Element::elem_erg_table->get_column_name(dam_label::btype_cost));
+	writer->add_column(Dam_Eco_Btype_Element::elem_erg_table->get_column_name(dam_label::btype_damage_zone));
+	writer->add_column(%s::elem_erg_table->get_column_name(dam_label::elem_poly), _sys_bulk_column_type::bulk_geometry_wkb);
 }
 //Switch the applied-flag for the ecological biotope-type damage results in the database table for a defined system state (static)
 void Dam_Eco_Btype_Element::switch_applied_flag_erg_table(QSqlDatabase *ptr_database, const _sys_system_id id, const bool flag){
@@ -355,23 +355,15 @@ void Dam_Eco_Btype_Raster::output_results2database(QSqlDatabase *ptr_database,co
 	prefix << "RAST_"<<this->number<<"> ";
 	Sys_Common_Output::output_dam->set_userprefix(prefix.str());
 
-	//Set the query
-	QSqlQuery query_buff(*ptr_database);
-
 	ostringstream cout;
 	cout << "Transfer the biotope-type damage results of raster elements of raster " << this->name << " to database..."<< endl;
 	Sys_Common_Output::output_dam->output_txt(&cout);
 
 	//get the global index
 	int glob_id=Dam_Eco_Btype_Element::get_max_glob_id_erg_table(ptr_database)+1;
-	//get the header for the query
-	string query_header;
-	query_header=Dam_Eco_Btype_Element::get_insert_header_erg_table(ptr_database);
-
-	ostringstream query_data;
-	ostringstream query_total;
-	int counter=0;
-	string buffer_data;
+	//the rows are sent in packages by the bulk writer
+	Sys_Database_Bulk_Writer writer(ptr_database);
+	Dam_Eco_Btype_Element::set_bulk_writer_erg_table(&writer, ptr_database);
 	bool must_output2=false;
 
 	for(int i=0; i<this->number_polygons; i++){
@@ -385,54 +377,29 @@ void Dam_Eco_Btype_Raster::output_results2database(QSqlDatabase *ptr_database,co
 			must_output2=true;
 		}
 
-		buffer_data = this->elements[i].get_datastring_results2database(glob_id , bound_sz, break_sz, this->number, this->width_x,this->x_coor_origin, this->y_coor_origin, must_output2);
-		if(buffer_data!=label::not_set){
-			query_data <<  buffer_data << " ,";
+		if(this->elements[i].get_result_required(must_output2)==true){
+			bool ok=this->elements[i].add_results2bulk_writer(&writer, glob_id, bound_sz, break_sz, this->number, this->width_x, this->x_coor_origin, this->y_coor_origin);
 			//count the global index
 			glob_id++;
-			counter++;
 			*was_output=true;
-		}
-		//send packages of 100
-		if(counter==100){
-			query_total<< query_header << query_data.str();
-			//delete last komma
-			string buff=query_total.str();
-			buff.erase(buff.length()-1);
-			Data_Base::database_request(&query_buff, buff, ptr_database);
-			//delete them
-			query_total.str("");
-			query_data.str("");
-			counter=0;
-			if(query_buff.lastError().isValid()){
+			if(ok==false){
 				Warning msg=this->set_warning(5);
 				ostringstream info;
 				info << "Table Name                : " << Dam_Eco_Btype_Element::elem_erg_table->get_table_name() << endl;
-				info << "Table error info          : " << query_buff.lastError().text().toStdString() << endl;
+				info << "Table error info          : " << writer.get_last_error() << endl;
 				msg.make_second_info(info.str());
 				msg.output_msg(4);
 			}
 		}
 	}
 	//send the rest
-	if(counter!=0){
-		query_total<< query_header << query_data.str();
-		//delete last komma
-		string buff=query_total.str();
-		buff.erase(buff.length()-1);
-		Data_Base::database_request(&query_buff, buff, ptr_database);
-		//delete them
-		query_total.str("");
-		query_data.str("");
-		counter=0;
-		if(query_buff.lastError().isValid()){
-			Warning msg=this->set_warning(5);
-			ostringstream info;
-			info << "Table Name                : " << Dam_Eco_Btype_Element::elem_erg_table->get_table_name() << endl;
-			info << "Table error info          : " << query_buff.lastError().text().toStdString() << endl;
-			msg.make_second_info(info.str());
-			msg.output_msg(4);
-		}
+	if(writer.finish()==false){
+		Warning msg=this->set_warning(5);
+		ostringstream info;
+		info << "Table Name                : " << Dam_Eco_Btype_Element::elem_erg_table->get_table_name() << endl;
+		info << "Table error info          : " << writer.get_last_error() << endl;
+		msg.make_second_info(info.str());
+		msg.output_msg(4);
 	}
 	Sys_Common_Output::output_dam->rewind_userprefix();
 }
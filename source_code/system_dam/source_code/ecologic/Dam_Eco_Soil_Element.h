@@ -81,8 +81,10 @@ public:
 
 	///Output the result memebrs to database (inadequate performance)
 	void output_result_members2database(QSqlDatabase *ptr_database, const int bound_sz, const string break_sz, const int raster_id, const double cellsize, const double x_origin, const double y_origin);
-	///Get the data-string to complete a insert-string for inserting the data of the element results to database
-	string get_datastring_results2database(const int global_id, const int bound_sz, const string break_sz, const int raster_id, const double cellsize, const double x_origin, const double y_origin, const bool must_output);
+	///Get if the results of the element are output to database (a damage is calculated or the output is required)
+	bool get_result_required(const bool must_output);
+	///Add the element results as row to the bulk writer; false is returned, if a sent package failed
+	bool add_results2bulk_writer(Sys_Database_Bulk_Writer *writer, const int global_id, const int bound_sz, const string break_sz, const int raster_id, const double cellsize, const double x_origin, const double y_origin);
 
 	///Create the database table for the raster elements
 	static void create_elem_table(QSqlDatabase *ptr_database);
@@ -129,8 +131,8 @@ public:
 
 	///Get the maximum value of the global index of the element result database table
 	static int get_max_glob_id_erg_table(QSqlDatabase *ptr_database);
-	///Get the header for inserting the element result data to database table
-	static string get_insert_header_erg_table(QSqlDatabase *ptr_database);
+	///Set the table and the columns of the element result data to the bulk writer
+	static void set_bulk_writer_erg_table(Sys_Database_Bulk_Writer *writer, QSqlDatabase *ptr_database);
 
 	///Switch the applied-flag for the ecological soil-erosion damage results in the database table for a defined system state
 	static void switch_applied_flag_erg_table(QSqlDatabase *ptr_database, const _sys_system_id id, const bool flag);
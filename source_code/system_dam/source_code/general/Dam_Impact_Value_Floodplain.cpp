@@ -68,77 +68,68 @@ double Dam_Impact_Value_Floodplain::analyse_date_time(const QStringList list) {
 }
 //Set the impact values from database
 void Dam_Impact_Value_Floodplain::set_impact_values_database(const int bound_sz, const string break_sz, QSqlDatabase *ptr_database, const _sys_system_id sys_id){
-	QSqlQueryModel results;
-	int number_found_elem=0;
+	/**The results are read row by row with a stream reader; just one package of rows is kept in memory.
+	*/
+	Sys_Database_Stream_Reader results(ptr_database);
 
+	this->allocate_impact_values();
 	try{
-		number_found_elem=Hyd_Element_Floodplain::count_relevant_results_elements_database(&results, ptr_database, sys_id, this->index_floodplain, bound_sz, break_sz, false);
-		
+		Hyd_Element_Floodplain::stream_relevant_results_elements_database(&results, ptr_database, sys_id, this->index_floodplain, bound_sz, break_sz);
 	}
 	catch(Error msg){
 		throw msg;
 	}
-    ostringstream cout;
-    cout <<number_found_elem<< " hydraulic impact values are found" << endl ;
-    Sys_Common_Output::output_dam->output_txt(&cout);
-	this->allocate_impact_values();
 	//set the impact values
 	int elem_id=0;
-	int counter=0;
-	int counter2=0;
-	for(int i=0; i< number_found_elem; i++){
-		if(i==counter*constant::max_rows){
-			results.clear();
-			Hyd_Element_Floodplain::select_relevant_results_elements_database(&results, ptr_database, sys_id, this->index_floodplain, bound_sz, break_sz, i, constant::max_rows, false);
-			counter++;
-			counter2=0;
+	while(results.next_row()==true){
+		elem_id=results.get_int(0);
+		if(elem_id<0 || elem_id>=this->number_element){
+			continue;
 		}
-		elem_id=results.record(counter2).value((Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemdata_id)).c_str()).toInt();
-		this->impact_values[elem_id].readout_data_from_database_model(&results, counter2);
-		counter2++;
+		this->impact_values[elem_id].readout_data_from_database_reader(&results);
 	}
-
-
-	results.clear();
-	ptr_database->close();
-	ptr_database->open();
+	if(results.get_last_error()!=label::not_set){
+		Error msg=this->set_error(1);
+		ostringstream info;
+		info << "Table Name      : " << Hyd_Element_Floodplain::erg_table->get_table_name() << endl;
+		info << "Table error info: " << results.get_last_error() << endl;
+		msg.make_second_info(info.str());
+		throw msg;
+	}
+	ostringstream cout;
+	cout <<results.get_number_read_rows()<< " hydraulic impact values are found" << endl ;
+	Sys_Common_Output::output_dam->output_txt(&cout);
+	results.close();
 }
 //Set the instationary impact values from database
 void Dam_Impact_Value_Floodplain::set_instationary_impact_values_database(const int bound_sz, const string break_sz, QSqlDatabase *ptr_database, const _sys_system_id sys_id, const string time_date) {
-	QSqlQueryModel results;
-	int number_found_elem = 0;
+	Sys_Database_Stream_Reader results(ptr_database);
 
+	this->allocate_impact_values();
 	try {
-		number_found_elem = Hyd_Element_Floodplain::count_relevant_instat_results_elements_database(&results, ptr_database, sys_id, this->index_floodplain, bound_sz, break_sz, time_date, false);
-
+		Hyd_Element_Floodplain::stream_relevant_instat_results_elements_database(&results, ptr_database, sys_id, this->index_floodplain, bound_sz, break_sz, time_date);
 	}
 	catch (Error msg) {
 		throw msg;
 	}
-	//ostringstream cout;
-	//cout << number_found_elem << " hydraulic instationary impact values are found" << endl;
-	//Sys_Common_Output::output_dam->output_txt(&cout);
-	this->allocate_impact_values();
 	//set the impact values
 	int elem_id = 0;
-	int counter = 0;
-	int counter2 = 0;
-	for (int i = 0; i < number_found_elem; i++) {
-		if (i == counter * constant::max_rows) {
-			results.clear();
-			Hyd_Element_Floodplain::select_relevant_instat_results_elements_database(&results, ptr_database, sys_id, this->index_floodplain, bound_sz, break_sz, i, constant::max_rows, time_date, false);
-			counter++;
-			counter2 = 0;
+	while (results.next_row() == true) {
+		elem_id = results.get_int(0);
+		if (elem_id < 0 || elem_id >= this->number_element) {
+			continue;
 		}
-		elem_id = results.record(counter2).value((Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemdata_id)).c_str()).toInt();
-		this->impact_values[elem_id].readout_instat_data_from_database_model(&results, counter2);
-		counter2++;
+		this->impact_values[elem_id].readout_instat_data_from_database_reader(&results);
 	}
-
-
-	results.clear();
-	ptr_database->close();
-	ptr_database->open();
+	if (results.get_last_error() != label::not_set) {
+		Error msg = this->set_error(1);
+		ostringstream info;
+		info << "Table Name      : " << Hyd_Element_Floodplain::erg_instat_table->get_table_name() << endl;
+		info << "Table error info: " << results.get_last_error() << endl;
+		msg.make_second_info(info.str());
+		throw msg;
+	}
+	results.close();
 
 }
 //__________
@@ -181,6 +172,12 @@ Error Dam_Impact_Value_Floodplain::set_error(const int err_type){
 			help="Check the memory";
 			type=10;
 			break;
+		case 1://reading of the results failed
+			place.append("set_impact_values_database(const int bound_sz, const string break_sz, QSqlDatabase *ptr_database, const _sys_system_id sys_id)");
+			reason="Reading of the hydraulic results from the database failed";
+			help="Check the database";
+			type=2;
+			break;
 		default:
 			place.append("set_error(const int err_type)");
 			reason ="Unknown flag!";
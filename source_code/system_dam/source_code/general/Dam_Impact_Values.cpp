@@ -115,6 +115,40 @@ void Dam_Impact_Values::readout_instat_data_from_database_model(QSqlQueryModel *
 	}
 
 }
+//Read out the member data from the current row of a stream reader (see Hyd_Element_Floodplain::stream_relevant_results_elements_database)
+void Dam_Impact_Values::readout_data_from_database_reader(Sys_Database_Stream_Reader *reader){
+	//the columns are given by their position in the select statement
+	this->fp_elem_id=reader->get_int(0);
+	this->impact_h=reader->get_double(1);
+	this->impact_v_tot=reader->get_double(2);
+	this->impact_dsdt=reader->get_double(3);
+	this->impact_duration=reader->get_double(4);
+	this->impact_first_t=reader->get_double(5);
+	this->impact_vh=reader->get_double(6);
+	this->watervolume=reader->get_double(7);
+	if(this->impact_h>constant::meter_epsilon){
+		this->was_wet_flag=true;
+	}
+	else{
+		this->was_wet_flag=false;
+	}
+}
+//Read out the instationary member data from the current row of a stream reader (see Hyd_Element_Floodplain::stream_relevant_instat_results_elements_database)
+void Dam_Impact_Values::readout_instat_data_from_database_reader(Sys_Database_Stream_Reader *reader){
+	//the columns are given by their position in the select statement
+	this->fp_elem_id=reader->get_int(0);
+	this->impact_h=reader->get_double(1);
+	this->impact_v_tot=reader->get_double(2);
+	this->impact_dsdt=reader->get_double(3);
+	this->impact_vh=reader->get_double(4);
+	this->date_time=reader->get_string(5);
+	if(this->impact_h>constant::meter_epsilon){
+		this->was_wet_flag=true;
+	}
+	else{
+		this->was_wet_flag=false;
+	}
+}
 //Convert the enumerator (_dam_impact_type) to a text (static)
 string Dam_Impact_Values::convert_dam_impact_type2txt(const _dam_impact_type value){
 	string buff;
@@ -65,6 +65,10 @@ public:
 	void readout_data_from_database_model(QSqlQueryModel *model, const int model_index);
 	///Read out the member data from a given QSqlTableModel
 	void readout_instat_data_from_database_model(QSqlQueryModel *model, const int model_index);
+	///Read out the member data from the current row of a stream reader (see Hyd_Element_Floodplain::stream_relevant_results_elements_database)
+	void readout_data_from_database_reader(Sys_Database_Stream_Reader *reader);
+	///Read out the instationary member data from the current row of a stream reader (see Hyd_Element_Floodplain::stream_relevant_instat_results_elements_database)
+	void readout_instat_data_from_database_reader(Sys_Database_Stream_Reader *reader);
 
 
 	///Convert the enumerator (_dam_impact_type) to a text
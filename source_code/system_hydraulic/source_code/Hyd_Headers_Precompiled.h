@@ -33,6 +33,8 @@
 #include "Hyd_Observation_Point.h"
 //managment class of observation points
 #include "Hyd_Observation_Point_Manager.h"
+//output of the instationary results in an own thread
+#include "Hyd_Output_Writer.h"
 
 //model classes
 //Base class of hydraulic models
@@ -78,6 +80,7 @@
 #include "Hyd_River_Profile_Type_Bridge.h"
 //Table class for the profile characteristics
 #include "Hyd_Tables.h"
+#include "Hyd_Fused_Tables.h"
 //Point class of the river profile
 #include "Hyd_River_Profile_Point.h"
 //Segment of a river profile
@@ -90,6 +93,8 @@
 #include "Hyd_Floodplain_Polysegment.h"
 //The numerical raster of the floodplain
 #include "Hyd_Floodplain_Raster.h"
+//The chunked binary result store of a floodplain model
+#include "Hyd_Floodplain_Result_Store.h"
 //Raster converter class
 #include "Hyd_Gis2Promraster_Converter.h"
 //A raster polygon of the numerical raster of the floodplain
@@ -19,6 +19,7 @@ Hyd_Multiple_Hydraulic_Systems::Hyd_Multiple_Hydraulic_Systems(void){
 	this->required_threads=1;
 
 	this->thread_is_started=false;
+	this->output_blocked=false;
 	this->gis_raster=NULL;
 	this->prom_raster=NULL;
 	this->raster_import_dia=NULL;
@@ -565,6 +566,11 @@ void Hyd_Multiple_Hydraulic_Systems::delete_hydraulic_boundary_scenarios(const i
 //public slots
 //Manage the output of the hydraulic classes
 void Hyd_Multiple_Hydraulic_Systems::recieve_output_required(int thread){
+	QMutexLocker locker(&this->output_mutex);
+	//the output is used by the pre-/postprocessing of the pipeline
+	if(this->output_blocked==true){
+		return;
+	}
 	if(this->threads[thread].get_output_is_required()==false){
 		return;
 	}
@@ -659,7 +665,9 @@ void Hyd_Multiple_Hydraulic_Systems::allocate_hyd_threads(void){
 			this->threads[i].set_temp_calc_apply(true);
 
 		}
+		this->threads[i].set_output_synchronisation(&this->output_mutex, &this->output_finished);
 		QObject::connect(&this->threads[i], SIGNAL(output_required(int)), this, SLOT(recieve_output_required(int )));
+		this->thread_waiter.observe_thread(&this->threads[i]);
 
 	}
 }
@@ -1150,7 +1158,7 @@ void Hyd_Multiple_Hydraulic_Systems::reset_hyd_temp_system_boundaries_db(int *co
 void Hyd_Multiple_Hydraulic_Systems::calculate_hyd_system(void){
 	for(int i=0; i<this->required_threads; i++){
 		if(threads[i].get_preproc_flag()==true){
-			this->threads[i].start();
+			this->thread_waiter.start_thread(&this->threads[i]);
 		}
 	}
 	this->wait_loop();
@@ -1167,7 +1175,7 @@ void Hyd_Multiple_Hydraulic_Systems::calculate_hyd_temp_system(void) {
 	for (int i = 0; i < this->required_threads; i++) {
 		
 		if (threads[i].get_preproc_flag() == true) {
-			this->threads[i].start();
+			this->thread_waiter.start_thread(&this->threads[i]);
 		}
 	}
 	this->wait_loop();
@@ -1184,24 +1192,7 @@ void Hyd_Multiple_Hydraulic_Systems::calculate_hyd_temp_system(void) {
 void Hyd_Multiple_Hydraulic_Systems::make_postprocessing_hyd_system(void){
 	if(Hyd_Multiple_Hydraulic_Systems::abort_thread_flag==false){
 		for(int i=0; i<this->required_threads; i++){
-			if(threads[i].get_preproc_flag()==true){
-				try{
-					ostringstream cout;
-					cout <<"Postprocessing of hydraulicsystem " << this->threads[i].get_identifier_prefix(false)<<"..."<< endl;
-					Sys_Common_Output::output_hyd->output_txt(&cout);
-					this->threads[i].output_final_model_statistics();
-					this->counter_warnings=this->counter_warnings+this->threads[i].get_number_warnings();
-					Sys_Common_Output::output_hyd->insert_separator(4);
-				}
-				catch(Error msg){
-					ostringstream info;
-					info <<"Number hydraulic system : "<< this->threads[i].get_identifier_prefix(false)<< endl;
-					msg.make_second_info(info.str());
-					this->counter_error++;
-					this->threads[i].increase_error_number();
-					msg.output_msg(2);
-				}
-			}
+			this->make_postprocessing_hyd_thread(i);
 		}
 	}
 }
@@ -1209,40 +1200,153 @@ void Hyd_Multiple_Hydraulic_Systems::make_postprocessing_hyd_system(void){
 void Hyd_Multiple_Hydraulic_Systems::make_postprocessing_hyd_temp_system(void) {
 	if (Hyd_Multiple_Hydraulic_Systems::abort_thread_flag == false) {
 		for (int i = 0; i < this->required_threads; i++) {
-			if (threads[i].get_preproc_flag() == true) {
-				try {
-					ostringstream cout;
-					cout << "Postprocessing of hydraulic temperature system " << this->threads[i].get_identifier_prefix(false) << "..." << endl;
-					Sys_Common_Output::output_hyd->output_txt(&cout);
-					this->threads[i].output_final_model_statistics();
-					this->counter_warnings = this->counter_warnings + this->threads[i].get_number_warnings();
-					Sys_Common_Output::output_hyd->insert_separator(4);
+			this->make_postprocessing_hyd_thread(i);
+		}
+	}
+
+}
+//Perform the postprocessing of one hydraulic (temperature) system thread
+void Hyd_Multiple_Hydraulic_Systems::make_postprocessing_hyd_thread(const int i){
+	if(threads[i].get_preproc_flag()==true){
+		string sys_type="hydraulic system";
+		if(this->type==_hyd_thread_type::hyd_temp_calculation){
+			sys_type="hydraulic temperature system";
+		}
+		try{
+			ostringstream cout;
+			cout <<"Postprocessing of "<<sys_type<<" " << this->threads[i].get_identifier_prefix(false)<<"..."<< endl;
+			Sys_Common_Output::output_hyd->output_txt(&cout);
+			this->threads[i].output_final_model_statistics();
+			this->counter_warnings=this->counter_warnings+this->threads[i].get_number_warnings();
+			Sys_Common_Output::output_hyd->insert_separator(4);
+		}
+		catch(Error msg){
+			ostringstream info;
+			info <<"Number "<<sys_type<<" : "<< this->threads[i].get_identifier_prefix(false)<< endl;
+			msg.make_second_info(info.str());
+			this->counter_error++;
+			this->threads[i].increase_error_number();
+			msg.output_msg(2);
+		}
+	}
+}
+//Calculate the hydraulic (temperature) systems per database as pipeline: a finished thread is postprocessed, preprocessed with the next system and restarted, while the other threads go on calculating
+void Hyd_Multiple_Hydraulic_Systems::calculate_hyd_system_pipeline(int *counter_sys){
+	//the first systems are loaded and cloned before any thread is started
+	this->decide_new_reset_db(counter_sys);
+
+	vector<bool> active(this->required_threads, false);
+	for(int i=0; i<this->required_threads; i++){
+		if(this->threads[i].get_preproc_flag()==true){
+			this->thread_waiter.start_thread(&this->threads[i]);
+			active[i]=true;
+		}
+	}
+
+	bool all_finished=true;
+	int counter=0;
+	int number_finished=0;
+	ostringstream buffer;
+	try{
+		do{
+			number_finished=this->thread_waiter.get_number_finished();
+			for(int i=0; i<this->required_threads; i++){
+				if(active[i]==false || this->thread_waiter.get_thread_running(&this->threads[i])==true){
+					continue;
 				}
-				catch (Error msg) {
-					ostringstream info;
-					info << "Number hydraulic temperature system : " << this->threads[i].get_identifier_prefix(false) << endl;
-					msg.make_second_info(info.str());
-					this->counter_error++;
-					this->threads[i].increase_error_number();
-					msg.output_msg(2);
+				//thread is finished: postprocessing
+				this->threads[i].wait();
+				active[i]=false;
+				this->counter_error=this->counter_error+this->threads[i].get_number_errors();
+				Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
+				//the other threads are still calculating; their output has to wait until the pre-/postprocessing is done
+				this->block_thread_output();
+				this->make_postprocessing_hyd_thread(i);
+
+				//preprocessing of the next system and restart
+				if(*counter_sys<this->sz_bound_manager.get_number_sz()){
+					buffer.str("");
+					buffer <<*counter_sys << " of " << this->sz_bound_manager.get_number_sz();
+					emit emit_number_performed_calculation(buffer.str().c_str());
+					Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
+					if(this->type==_hyd_thread_type::hyd_temp_calculation){
+						this->reset_hyd_temp_system_boundaries_db(counter_sys, i);
+					}
+					else{
+						this->reset_hyd_system_boundaries_db(counter_sys, i);
+					}
+					if(this->threads[i].get_preproc_flag()==true){
+						this->thread_waiter.start_thread(&this->threads[i]);
+						active[i]=true;
+					}
+				}
+				this->release_thread_output();
+			}
+
+			all_finished=true;
+			counter=0;
+			for(int i=0; i<this->required_threads; i++){
+				if(active[i]==true){
+					all_finished=false;
+					counter++;
 				}
 			}
+			buffer.str("");
+			buffer << counter;
+			emit emit_number_threads(buffer.str().c_str());
+			if(all_finished==false){
+				this->thread_waiter.wait_next_finished(number_finished, 2000);
+			}
 		}
+		while(all_finished==false);
+	}
+	catch(Error msg){
+		this->release_thread_output();
+		//the threads are stopped by the abort flag; wait for them before leaving
+		for(int i=0; i<this->required_threads; i++){
+			this->threads[i].wait();
+		}
+		throw msg;
 	}
-
+}
+//Block the output of the hydraulic threads to display/console; it waits until a running output of a thread is finished
+void Hyd_Multiple_Hydraulic_Systems::block_thread_output(void){
+	QMutexLocker locker(&this->output_mutex);
+	this->output_blocked=true;
+	bool output_running=true;
+	while(output_running==true){
+		output_running=false;
+		for(int i=0; i<this->required_threads; i++){
+			if(this->threads[i].isRunning()==true && this->threads[i].get_output_is_running()==true){
+				output_running=true;
+			}
+		}
+		if(output_running==true){
+			Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
+			//the thread wakes the condition at the end of its output; the timeout covers a thread, which is ended during its output
+			this->output_finished.wait(&this->output_mutex, 500);
+		}
+	}
+}
+//Release the output of the hydraulic threads to display/console; the waiting threads get the output by their next request
+void Hyd_Multiple_Hydraulic_Systems::release_thread_output(void){
+	QMutexLocker locker(&this->output_mutex);
+	this->output_blocked=false;
 }
 //Waiting loop for the threads
 void Hyd_Multiple_Hydraulic_Systems::wait_loop(void){
 	bool all_finished=true;
 	int counter=0;
+	int number_finished=0;
 	ostringstream buffer;
-	//waiting loop for this thread
+	//waiting loop for this thread; it wakes up as soon as a thread is finished
 	do{
 		all_finished=true;
 		counter=0;
 		buffer.str("");
+		number_finished=this->thread_waiter.get_number_finished();
 		for(int i=0; i<this->required_threads; i++){
-			if(this->threads[i].isRunning()==true){
+			if(this->thread_waiter.get_thread_running(&this->threads[i])==true){
 				all_finished=false;
 				counter++;
 			}
@@ -1250,10 +1354,14 @@ void Hyd_Multiple_Hydraulic_Systems::wait_loop(void){
 		buffer << counter;
 		emit emit_number_threads(buffer.str().c_str());
 		if(all_finished==false){
-			this->sleep(2);
+			this->thread_waiter.wait_next_finished(number_finished, 2000);
 		}
 	}
 	while(all_finished==false);
+	//the threads have sent the finished-signal; wait until they are completly closed
+	for(int i=0; i<this->required_threads; i++){
+		this->threads[i].wait();
+	}
 }
 //Allocate the file names
 void Hyd_Multiple_Hydraulic_Systems::allocate_file_names(void){
@@ -1703,12 +1811,7 @@ void Hyd_Multiple_Hydraulic_Systems::calculate_hydraulic_system_database(void){
 				emit_number_performed_calculation(cout.str().c_str());
 			}
 			Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
-			this->decide_new_reset_db(&counter_sys);
-			this->calculate_hyd_system();
-			Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
-			this->make_postprocessing_hyd_system();
-			
-
+			this->calculate_hyd_system_pipeline(&counter_sys);
 		}
 		while(counter_sys<this->sz_bound_manager.get_number_sz());
 	}
@@ -1747,12 +1850,7 @@ void Hyd_Multiple_Hydraulic_Systems::calculate_hydraulic_temp_system_database(vo
 				emit_number_performed_calculation(cout.str().c_str());
 			}
 			Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
-			this->decide_new_reset_db(&counter_sys);
-			this->calculate_hyd_temp_system();
-			Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
-			this->make_postprocessing_hyd_temp_system();
-
-
+			this->calculate_hyd_system_pipeline(&counter_sys);
 		} while (counter_sys < this->sz_bound_manager.get_number_sz());
 	}
 	catch (Error msg) {
@@ -202,6 +202,15 @@ private:
 	///Flag if the threads has started
 	bool thread_is_started;
 
+	///Waiter for the end of the hydraulic threads
+	Sys_Thread_Waiter thread_waiter;
+	///Flag if the output of the hydraulic threads to display/console is blocked by the pre-/postprocessing of the pipeline
+	bool output_blocked;
+	///Mutex for the output permission of the hydraulic threads; it guards the output flags of the threads
+	QMutex output_mutex;
+	///Wait condition, which is woken by a hydraulic thread, if its output is finished
+	QWaitCondition output_finished;
+
 	///Gis-raster, which is the input-raster
 	Hyd_Gis2Promraster_Converter *gis_raster;
 	///Prom-raster. which is the output-raster
@@ -244,6 +253,14 @@ private:
 	void make_postprocessing_hyd_system(void);
 	///Perform the postprocessing of the hydraulic temperature system(s) calculation 
 	void make_postprocessing_hyd_temp_system(void);
+	///Perform the postprocessing of one hydraulic (temperature) system thread
+	void make_postprocessing_hyd_thread(const int i);
+	///Calculate the hydraulic (temperature) systems per database as pipeline: a finished thread is postprocessed, preprocessed with the next system and restarted, while the other threads go on calculating
+	void calculate_hyd_system_pipeline(int *counter_sys);
+	///Block the output of the hydraulic threads to display/console; it waits until a running output of a thread is finished
+	void block_thread_output(void);
+	///Release the output of the hydraulic threads to display/console; the waiting threads get the output by their next request
+	void release_thread_output(void);
 	///Waiting loop for the threads
 	void wait_loop(void);
 
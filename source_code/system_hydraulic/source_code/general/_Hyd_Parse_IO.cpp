@@ -325,6 +325,8 @@ _hyd_keyword_file _Hyd_Parse_IO::ParseNextKeyword(char *CommandList){
 	else if (FIND1("$TECPLOT_2D"))	Keyword = eTECPLOT2D;
 	else if (FIND1("$BLUEKENUE_2D"))	Keyword = eBLUEKENUE2D;
 	else if (FIND1("$PARAVIEW_EXCEL_1D"))	Keyword = ePARAVIEW1D;
+	else if (FIND1("$BINARY_1D"))	Keyword = eBINARY1D;
+	else if (FIND1("$BINARY_2D"))	Keyword = eBINARY2D;
 	else if (FIND1("$PARAVIEW_2D"))	Keyword = ePARAVIEW2D;
 	else if (FIND1("$DATBASE_INSTAT"))	Keyword = eDATABASE_INSTAT;
 	else if (FIND1("$OUTPUT_FOLDER"))	Keyword = eOUTPUT_FOLDER;
@@ -396,6 +398,7 @@ _hyd_keyword_file _Hyd_Parse_IO::ParseNextKeyword(char *CommandList){
 	//just used in 1d
 	else if (FIND1("$PROF_INTERFACE")	)	Keyword = ePROF_INTERFACE;
 	else if (FIND1("$V_EXPLICIT")		)	Keyword = eV_EXPLICIT;
+	else if (FIND1("$DIRECT_SOLVER")	)	Keyword = eDIRECT_SOLVER;
 	//output file
 	else if (FIND1("!2DOUTPUT")			)	Keyword = e2DOUTPUT;
 
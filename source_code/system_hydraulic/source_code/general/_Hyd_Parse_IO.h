@@ -105,6 +105,10 @@ enum _hyd_keyword_file{
 	eBLUEKENUE2D,
 	///Marker for the Paraview / Excel 1d output
 	ePARAVIEW1D,
+	///Marker for the binary 1d output
+	eBINARY1D,
+	///Marker for the binary 2d output
+	eBINARY2D,
 	///Marker for the Paraview 2d output
 	ePARAVIEW2D,
 	///Marker for the database instationary output
@@ -207,6 +211,8 @@ enum _hyd_keyword_file{
 	eV_EXPLICIT,
 	///Marker for the flag of the interface of foreland and main river (1d)
 	ePROF_INTERFACE,
+	///Marker for the flag of the direct band solver with the analytical Jacobian (1d)
+	eDIRECT_SOLVER,
 	///Marker for the path and name of the 2d-output file 
 	e2DOUTPUT,
 	
@@ -11,6 +11,7 @@ _Hyd_Model::_Hyd_Model(void) {
     this->NEQ_real=0;
     this->id_reduced=NULL;
 	this->half_bandwidth=0;
+	this->direct_solver_flag=false;
 	this->number_solversteps=0;
 
 
@@ -190,58 +191,8 @@ void _Hyd_Model::init_solver(Hyd_Param_Global *global_params){
 	
 
 
-	//see the cvode manual to set other specifications
-	//Set the linear solver
-	//flag = CVSpgmr(this->cvode_mem, global_params->GlobPreType, constant::krylow_subspace);
-    flag = CVSpgmr(this->cvode_mem, global_params->GlobPreType, 3);
-    //flag = CVSpgmr(this->cvode_mem, PREC_NONE, 3);
-	//other solver types
-	//flag = CVSpbcg(this->cvode_mem, global_params->GlobPreType, 5);
-	//flag = CVSptfqmr(this->cvode_mem, global_params->GlobPreType, 5);
-    //flag = CVBand(this->cvode_mem, this->NEQ, this->half_bandwidth, this->half_bandwidth);
-	if(flag<0){
-		Error msg=this->set_error(3);
-		ostringstream info;
-		info <<"CVSpgmr(this->cvode_mem, global_params->GlobPreType, constant::krylow_subspace)"<< endl;
-		info <<"CVode: " << this->cvode_linear_flags2string(flag) << endl;
-		msg.make_second_info(info.str());
-		throw msg;
-	}
-
-
-
-	//Initialize the cvbandpre preconditioner module; Specify the upper and lower half-bandwidths mu and ml and call
-   flag=CVBandPrecInit(this->cvode_mem, this->NEQ_real, this->half_bandwidth, this->half_bandwidth, this->NEQ, this->id_reduced,this->ilu_number);
-	if(flag<0){
-		Error msg=this->set_error(3);
-		ostringstream info;
-		info <<"Solver function: CVBandPrecInit(this->cvode_mem, this->NEQ, this->half_bandwidth, this->half_bandwidth)"<< endl;
-		info <<"CVode: " << this->cvode_linear_flags2string(flag) << endl;
-		msg.make_second_info(info.str());
-		throw msg;
-	}
-
-
-	//CVSpgmrSetGSType specifies the type of Gram-Schmidt orthogonalization to be used. This must be one of the two enumeration constants MODIFIED_GS or CLASSICAL_GS
-    flag = CVSpilsSetGSType(this->cvode_mem, global_params->GlobGramSchmidt);
-	if(flag<0){
-		Error msg=this->set_error(3);
-		ostringstream info;
-		info <<"Solver function: CVSpgmrSetGSType(this->cvode_mem, global_params->GlobGramSchmidt)"<< endl;
-		info <<"CVode: " << this->cvode_linear_flags2string(flag) << endl;
-		msg.make_second_info(info.str());
-		throw msg;
-	}
-	//Set the relation between linear and nonlinear error weights (default 0.05);0,35
-    flag=CVSpilsSetEpsLin(this->cvode_mem, 0.05);
-	if(flag<0){
-		Error msg=this->set_error(3);
-		ostringstream info;
-		info <<"Solver function: CVSpilsSetEpsLin(this->cvode_mem, 0.10)"<< endl;
-		info <<"CVode: " << this->cvode_linear_flags2string(flag) << endl;
-		msg.make_second_info(info.str());
-		throw msg;
-	}
+	//set the linear solver
+	this->init_linear_solver(global_params);
 
 	//count the required memory for the solver
 	this->count_solver_memory();
@@ -367,8 +318,6 @@ void _Hyd_Model::reset_solver_tolerances(void){
 }
 //Reinitialize the solver
 void _Hyd_Model::reinit_solver(Hyd_Param_Global *global_params){
-	this->close_solver();
-    //CVodeReInit(this->cvode_mem,0.0, this->results);
 	this->diff_solver_steps=0;
 	this->old_solver_steps=0;
 	
@@ -383,7 +332,11 @@ void _Hyd_Model::reinit_solver(Hyd_Param_Global *global_params){
 	this->no_lin_failure=0;
 	this->no_reset=0;
 
-	this->init_solver(global_params);
+	//reuse the initialised solver; just if it is not possible, the solver is completely reinitialised
+	if(this->reset_solver2init_condition(global_params)==false){
+		this->close_solver();
+		this->init_solver(global_params);
+	}
 
 }
 ///Get the warncounter for the solver warnings
@@ -438,6 +391,90 @@ void _Hyd_Model::clone_model(_Hyd_Model *model){
 	this->tol_reduce_counter=model->tol_reduce_counter;
 	
 	
+}
+//Initialize the linear solver; as default the Krylov solver (CVSpgmr) with the banded preconditioner is used
+void _Hyd_Model::init_linear_solver(Hyd_Param_Global *global_params){
+	int flag=-1;
+	this->direct_solver_flag=false;
+
+	//see the cvode manual to set other specifications
+	//Set the linear solver
+	//flag = CVSpgmr(this->cvode_mem, global_params->GlobPreType, constant::krylow_subspace);
+    flag = CVSpgmr(this->cvode_mem, global_params->GlobPreType, 3);
+    //flag = CVSpgmr(this->cvode_mem, PREC_NONE, 3);
+	//other solver types
+	//flag = CVSpbcg(this->cvode_mem, global_params->GlobPreType, 5);
+	//flag = CVSptfqmr(this->cvode_mem, global_params->GlobPreType, 5);
+    //flag = CVBand(this->cvode_mem, this->NEQ, this->half_bandwidth, this->half_bandwidth);
+	if(flag<0){
+		Error msg=this->set_error(3);
+		ostringstream info;
+		info <<"CVSpgmr(this->cvode_mem, global_params->GlobPreType, constant::krylow_subspace)"<< endl;
+		info <<"CVode: " << this->cvode_linear_flags2string(flag) << endl;
+		msg.make_second_info(info.str());
+		throw msg;
+	}
+
+
+
+	//Initialize the cvbandpre preconditioner module; Specify the upper and lower half-bandwidths mu and ml and call
+   flag=CVBandPrecInit(this->cvode_mem, this->NEQ_real, this->half_bandwidth, this->half_bandwidth, this->NEQ, this->id_reduced,this->ilu_number);
+	if(flag<0){
+		Error msg=this->set_error(3);
+		ostringstream info;
+		info <<"Solver function: CVBandPrecInit(this->cvode_mem, this->NEQ, this->half_bandwidth, this->half_bandwidth)"<< endl;
+		info <<"CVode: " << this->cvode_linear_flags2string(flag) << endl;
+		msg.make_second_info(info.str());
+		throw msg;
+	}
+
+
+	//CVSpgmrSetGSType specifies the type of Gram-Schmidt orthogonalization to be used. This must be one of the two enumeration constants MODIFIED_GS or CLASSICAL_GS
+    flag = CVSpilsSetGSType(this->cvode_mem, global_params->GlobGramSchmidt);
+	if(flag<0){
+		Error msg=this->set_error(3);
+		ostringstream info;
+		info <<"Solver function: CVSpgmrSetGSType(this->cvode_mem, global_params->GlobGramSchmidt)"<< endl;
+		info <<"CVode: " << this->cvode_linear_flags2string(flag) << endl;
+		msg.make_second_info(info.str());
+		throw msg;
+	}
+	//Set the relation between linear and nonlinear error weights (default 0.05);0,35
+    flag=CVSpilsSetEpsLin(this->cvode_mem, 0.05);
+	if(flag<0){
+		Error msg=this->set_error(3);
+		ostringstream info;
+		info <<"Solver function: CVSpilsSetEpsLin(this->cvode_mem, 0.10)"<< endl;
+		info <<"CVode: " << this->cvode_linear_flags2string(flag) << endl;
+		msg.make_second_info(info.str());
+		throw msg;
+	}
+}
+//Initialize the direct band solver (CVBand) as linear solver; without a Jacobian function (NULL) the difference quotient Jacobian of the solver is used
+void _Hyd_Model::init_band_solver(CVDlsBandJacFn jac_function){
+	int flag=-1;
+	this->direct_solver_flag=true;
+
+	flag = CVBand(this->cvode_mem, this->NEQ, this->half_bandwidth, this->half_bandwidth);
+	if(flag<0){
+		Error msg=this->set_error(3);
+		ostringstream info;
+		info <<"Solver function: CVBand(this->cvode_mem, this->NEQ, this->half_bandwidth, this->half_bandwidth)"<< endl;
+		info <<"CVode: " << this->cvode_linear_flags2string(flag) << endl;
+		msg.make_second_info(info.str());
+		throw msg;
+	}
+	if(jac_function!=NULL){
+		flag = CVDlsSetBandJacFn(this->cvode_mem, jac_function);
+		if(flag<0){
+			Error msg=this->set_error(3);
+			ostringstream info;
+			info <<"Solver function: CVDlsSetBandJacFn(this->cvode_mem, jac_function)"<< endl;
+			info <<"CVode: " << this->cvode_linear_flags2string(flag) << endl;
+			msg.make_second_info(info.str());
+			throw msg;
+		}
+	}
 }
 //run the solver
 void _Hyd_Model::run_solver(const double next_time_point, const string system_id){
@@ -613,48 +650,75 @@ void _Hyd_Model::output_solver_statistics(ostringstream *cout){
 	Sys_Common_Output::output_hyd->output_txt(cout);
 
 
-	flag = CVSpilsGetNumRhsEvals(cvode_mem, &nfeSPGMR);
-	 if(flag<0){
-		Warning msg=this->set_warning(2);
-		ostringstream info;
-		info <<"Solver function: CVSpgmrGetNumRhsEvals(cvode_mem, &nfeSPGMR)"<< endl;
-		info <<"CVode: " << this->cvode_init_flags2string(flag) << endl;
-		msg.make_second_info(info.str());
-		msg.output_msg(2);
-	}
-	 this->no_spgmr=this->no_spgmr+nfeSPGMR;
-	 *cout << " Number of function evaluations (Spgmr)   :"<< P(0) << W(15) << this->no_spgmr << endl;
-	 Sys_Common_Output::output_hyd->output_txt(cout);
-
+	if(this->direct_solver_flag==true){
+		//direct band solver: the function evaluations for the difference quotient Jacobian and the Jacobian evaluations are counted
+		flag = CVDlsGetNumRhsEvals(cvode_mem, &nfeSPGMR);
+		if(flag<0){
+			Warning msg=this->set_warning(2);
+			ostringstream info;
+			info <<"Solver function: CVDlsGetNumRhsEvals(cvode_mem, &nfeSPGMR)"<< endl;
+			info <<"CVode: " << this->cvode_init_flags2string(flag) << endl;
+			msg.make_second_info(info.str());
+			msg.output_msg(2);
+		}
+		this->no_spgmr=this->no_spgmr+nfeSPGMR;
+		*cout << " Number of function evaluations (Band)    :"<< P(0) << W(15) << this->no_spgmr << endl;
 
-	flag=CVSpilsGetNumPrecEvals(this->cvode_mem, &n_pre);
-	if(flag<0){
-		Warning msg=this->set_warning(2);
-		ostringstream info;
-		info <<"CVSpgmrGetNumPrecEvals(this->bp_data, &n_pre)"<< endl;
-		info <<"CVode: " << this->cvode_init_flags2string(flag) << endl;
-		msg.make_second_info(info.str());
-		msg.output_msg(2);
+		flag = CVDlsGetNumJacEvals(cvode_mem, &n_pre);
+		if(flag<0){
+			Warning msg=this->set_warning(2);
+			ostringstream info;
+			info <<"Solver function: CVDlsGetNumJacEvals(cvode_mem, &n_pre)"<< endl;
+			info <<"CVode: " << this->cvode_init_flags2string(flag) << endl;
+			msg.make_second_info(info.str());
+			msg.output_msg(2);
+		}
+		this->no_prec=this->no_prec+n_pre;
+		*cout << " Number of Jacobian evaluations (Band)    :"<< P(0) << W(15) << this->no_prec << endl;
+		Sys_Common_Output::output_hyd->output_txt(cout);
 	}
-	this->no_prec=this->no_prec+n_pre;
-	*cout << " Number of function evaluations (Prec)    :"<< P(0) << W(15) << this->no_prec << endl;
-	Sys_Common_Output::output_hyd->output_txt(cout);
+	else{
+		flag = CVSpilsGetNumRhsEvals(cvode_mem, &nfeSPGMR);
+		 if(flag<0){
+			Warning msg=this->set_warning(2);
+			ostringstream info;
+			info <<"Solver function: CVSpgmrGetNumRhsEvals(cvode_mem, &nfeSPGMR)"<< endl;
+			info <<"CVode: " << this->cvode_init_flags2string(flag) << endl;
+			msg.make_second_info(info.str());
+			msg.output_msg(2);
+		}
+		 this->no_spgmr=this->no_spgmr+nfeSPGMR;
+		 *cout << " Number of function evaluations (Spgmr)   :"<< P(0) << W(15) << this->no_spgmr << endl;
+		 Sys_Common_Output::output_hyd->output_txt(cout);
 
 
-	flag=CVSpilsGetNumPrecSolves(this->cvode_mem, &n_pre_solv);
-	if(flag<0){
-		Warning msg=this->set_warning(2);
-		ostringstream info;
-		info <<"CVSpgmrGetNumPrecSolves(this->bp_data, &n_pre_solv)"<< endl;
-		info <<"CVode: " << this->cvode_init_flags2string(flag) << endl;
-		msg.make_second_info(info.str());
-		msg.output_msg(2);
-	}
-	this->no_prec_solve=this->no_prec_solve+n_pre_solv;
-	*cout << " Number of function evaluations (Precsolv):"<< P(0) << W(15) << this->no_prec_solve << endl;
-	Sys_Common_Output::output_hyd->output_txt(cout);
+		flag=CVSpilsGetNumPrecEvals(this->cvode_mem, &n_pre);
+		if(flag<0){
+			Warning msg=this->set_warning(2);
+			ostringstream info;
+			info <<"CVSpgmrGetNumPrecEvals(this->bp_data, &n_pre)"<< endl;
+			info <<"CVode: " << this->cvode_init_flags2string(flag) << endl;
+			msg.make_second_info(info.str());
+			msg.output_msg(2);
+		}
+		this->no_prec=this->no_prec+n_pre;
+		*cout << " Number of function evaluations (Prec)    :"<< P(0) << W(15) << this->no_prec << endl;
+		Sys_Common_Output::output_hyd->output_txt(cout);
 
 
+		flag=CVSpilsGetNumPrecSolves(this->cvode_mem, &n_pre_solv);
+		if(flag<0){
+			Warning msg=this->set_warning(2);
+			ostringstream info;
+			info <<"CVSpgmrGetNumPrecSolves(this->bp_data, &n_pre_solv)"<< endl;
+			info <<"CVode: " << this->cvode_init_flags2string(flag) << endl;
+			msg.make_second_info(info.str());
+			msg.output_msg(2);
+		}
+		this->no_prec_solve=this->no_prec_solve+n_pre_solv;
+		*cout << " Number of function evaluations (Precsolv):"<< P(0) << W(15) << this->no_prec_solve << endl;
+		Sys_Common_Output::output_hyd->output_txt(cout);
+	}
 
 	flag = CVodeGetNumNonlinSolvIters(cvode_mem, &nni);
 	 if(flag<0){
@@ -682,32 +746,34 @@ void _Hyd_Model::output_solver_statistics(ostringstream *cout){
 	 *cout << " Number of nonlinear convergence failures :"<< P(0) << W(15) << this->no_non_lin_failure << endl;
 	  Sys_Common_Output::output_hyd->output_txt(cout,true);
 
-	  flag = CVSpilsGetNumLinIters(cvode_mem, &nli);
-	 if(flag<0){
-		Warning msg=this->set_warning(2);
-		ostringstream info;
-		info <<"Solver function: CVSpgmrGetNumLinIters(cvode_mem, &nli)"<< endl;
-		info <<"CVode: " << this->cvode_init_flags2string(flag) << endl;
-		msg.make_second_info(info.str());
-		msg.output_msg(2);
-	}
-	 this->no_lin_iters=this->no_lin_iters+nli;
-	 *cout << " Number of linear iterations              :"<< P(0) << W(15) << this->no_lin_iters << endl;
-	 Sys_Common_Output::output_hyd->output_txt(cout,true);
+	if(this->direct_solver_flag==false){
+		  flag = CVSpilsGetNumLinIters(cvode_mem, &nli);
+		 if(flag<0){
+			Warning msg=this->set_warning(2);
+			ostringstream info;
+			info <<"Solver function: CVSpgmrGetNumLinIters(cvode_mem, &nli)"<< endl;
+			info <<"CVode: " << this->cvode_init_flags2string(flag) << endl;
+			msg.make_second_info(info.str());
+			msg.output_msg(2);
+		}
+		 this->no_lin_iters=this->no_lin_iters+nli;
+		 *cout << " Number of linear iterations              :"<< P(0) << W(15) << this->no_lin_iters << endl;
+		 Sys_Common_Output::output_hyd->output_txt(cout,true);
 	
-	flag = CVSpilsGetNumConvFails(cvode_mem, &ncfl);
-	 if(flag<0){
-		Warning msg=this->set_warning(2);
-		ostringstream info;
-		info <<"Solver function: CVSpgmrGetNumConvFails(cvode_mem, &ncfl)"<< endl;
-		info <<"CVode: " << this->cvode_init_flags2string(flag) << endl;
-		msg.make_second_info(info.str());
-		msg.output_msg(2);
-	}
-	 this->no_lin_failure=this->no_lin_failure+ncfl;
-	 *cout << " Number of linear convergence failures    :"<< P(0) << W(15) << this->no_lin_failure << endl;
-	 Sys_Common_Output::output_hyd->output_txt(cout,true);
+		flag = CVSpilsGetNumConvFails(cvode_mem, &ncfl);
+		 if(flag<0){
+			Warning msg=this->set_warning(2);
+			ostringstream info;
+			info <<"Solver function: CVSpgmrGetNumConvFails(cvode_mem, &ncfl)"<< endl;
+			info <<"CVode: " << this->cvode_init_flags2string(flag) << endl;
+			msg.make_second_info(info.str());
+			msg.output_msg(2);
+		}
+		 this->no_lin_failure=this->no_lin_failure+ncfl;
+		 *cout << " Number of linear convergence failures    :"<< P(0) << W(15) << this->no_lin_failure << endl;
+		 Sys_Common_Output::output_hyd->output_txt(cout,true);
 	 
+	}
 }
 //Set the solver statistics before a solver reset
 void _Hyd_Model::set_solver_statistics(void){
@@ -971,8 +1037,10 @@ void _Hyd_Model::close_solver(void){
 	}
 
 	//For GPU Solver
-	if (this->pManager != NULL)
+	if (this->pManager != NULL){
 		delete this->pManager;
+		this->pManager=NULL;
+	}
 	
 	//Free solver memory: CVodeFree(cvode mem); to free the memory allocated for cvode.
 	CVodeFree(&this->cvode_mem);
@@ -980,6 +1048,80 @@ void _Hyd_Model::close_solver(void){
 	//count the memory
 	Sys_Memory_Count::self()->minus_mem(this->solver_mem, _sys_system_modules::HYD_SYS);
 }
+//Reset the initialised solver to the initial conditions by reusing its workspaces; false is returned, if a complete reinitialisation is required
+bool _Hyd_Model::reset_solver2init_condition(Hyd_Param_Global *global_params){
+	if(this->gpu_in_use==true){
+		return this->reset_solver_gpu2init_condition();
+	}
+	if(this->cvode_mem==NULL || this->results==NULL){
+		return false;
+	}
+	int flag=-1;
+	//set the init condition
+	this->set_initcond2resultvector();
+	//the cvode memory, the linear solver and the preconditioner are kept; just the integrator history is reseted
+	flag=CVodeReInit(this->cvode_mem, 0.0, this->results);
+	if(flag<0){
+		Error msg=this->set_error(8);
+		ostringstream info;
+		info <<"Solver function: CVodeReInit(this->cvode_mem, 0.0, this->results)"<< endl;
+		info <<"CVode: " << this->cvode_init_flags2string(flag) << endl;
+		msg.make_second_info(info.str());
+		throw msg;
+	}
+	//the tolerances and the maximum step size may be changed during the last calculation
+	CVode_change_SStolerances(this->cvode_mem, this->setted_rel_tol, this->setted_abs_tol);
+	CVodeSetMaxStep(this->cvode_mem, global_params->GlobMaxStepSize);
+	this->max_solver_step=global_params->GlobMaxStepSize;
+
+	return true;
+}
+//Reset the initialised GPU solver to the initial conditions by reusing the compiled program and the device buffers; false is returned, if a complete reinitialisation is required
+bool _Hyd_Model::reset_solver_gpu2init_condition(void){
+	if(this->pManager==NULL){
+		return false;
+	}
+	Hyd_Model_Floodplain* myFloodplain = (Hyd_Model_Floodplain*) this;
+	CDomainCartesian* ourCartesianDomain = pManager->getDomain();
+	//the coupling type of the domain is fixed with the allocation of the device buffers
+	bool use_optimized_coupling=(myFloodplain->get_number_boundary_conditions() == 0 && myFloodplain->get_number_coupling_conditions() > 0);
+	if(ourCartesianDomain->getUseOptimizedCoupling()!=use_optimized_coupling){
+		return false;
+	}
+	if(use_optimized_coupling==true && ourCartesianDomain->getOptimizedCouplingSize()!=(unsigned long)myFloodplain->get_number_coupling_conditions()){
+		return false;
+	}
+
+	pManager->resetModel();
+
+	unsigned long ulCellID;
+	for (unsigned long iRow = 0; iRow < myFloodplain->Param_FP.get_no_elems_y(); iRow++) {
+		for (unsigned long iCol = 0; iCol < myFloodplain->Param_FP.get_no_elems_x(); iCol++) {
+			ulCellID = ourCartesianDomain->getCellID(iCol, ourCartesianDomain->getRows() - iRow - 1);
+			//Depth
+			ourCartesianDomain->setFSL(ulCellID, myFloodplain->floodplain_elems[ulCellID].element_type->get_flow_data().init_condition + myFloodplain->floodplain_elems[ulCellID].get_z_value());
+			//MaxDepth
+			ourCartesianDomain->setMaxFSL(ulCellID, myFloodplain->floodplain_elems[ulCellID].element_type->get_flow_data().init_condition + myFloodplain->floodplain_elems[ulCellID].get_z_value());
+			//VelocityX
+			ourCartesianDomain->setDischargeX(ulCellID, 0.0);
+			//VelocityY
+			ourCartesianDomain->setDischargeY(ulCellID, 0.0);
+		}
+	}
+	if (ourCartesianDomain->getUseOptimizedCoupling()) {
+		for (int i = 0; i < ourCartesianDomain->getOptimizedCouplingSize(); i++) {
+			ourCartesianDomain->setOptimizedCouplingCondition(i, 0.0);
+			ourCartesianDomain->setOptimizedCouplingID(i, myFloodplain->get_optimized_coupling_id(i));
+		}
+	}
+	else {
+		ourCartesianDomain->resetBoundaryCondition();
+	}
+
+	pManager->ValidateAndPrepareModel();
+
+	return true;
+}
 //count solver memory
 void _Hyd_Model::count_solver_memory(void){
     long int number_real=0;
@@ -1004,27 +1146,41 @@ void _Hyd_Model::count_solver_memory(void){
 			msg.output_msg(2);
 		}
 		this->solver_mem = number_real * sizeof(realtype) + number_int * sizeof(int);
-        flag=CVSpilsGetWorkSpace(this->cvode_mem, &number_real, &number_int);
-		if(flag<0){
-			Warning msg=this->set_warning(0);
-			ostringstream info;
-			info <<"Solver function: CVSpgmrGetWorkSpace(this->cvode_mem, &number_real, &number_int)"<< endl;
-			info <<"CVode: " << this->cvode_init_flags2string(flag) << endl;
-			msg.make_second_info(info.str());
-			msg.output_msg(2);
+		if(this->direct_solver_flag==true){
+			flag=CVDlsGetWorkSpace(this->cvode_mem, &number_real, &number_int);
+			if(flag<0){
+				Warning msg=this->set_warning(0);
+				ostringstream info;
+				info <<"Solver function: CVDlsGetWorkSpace(this->cvode_mem, &number_real, &number_int)"<< endl;
+				info <<"CVode: " << this->cvode_init_flags2string(flag) << endl;
+				msg.make_second_info(info.str());
+				msg.output_msg(2);
+			}
+			this->solver_mem=this->solver_mem+ number_real * sizeof(realtype) + number_int * sizeof(int);
 		}
-		this->solver_mem=this->solver_mem+ number_real * sizeof(realtype) + number_int * sizeof(int);
-
-        flag=CVBandPrecGetWorkSpace(this->cvode_mem, &number_real, &number_int);
-		if(flag<0){
-			Warning msg=this->set_warning(0);
-			ostringstream info;
-			info <<"Solver function: CVBandPrecGetWorkSpace(this->bp_data, &number_real, &number_int)"<< endl;
-			info <<"CVode: " << this->cvode_init_flags2string(flag) << endl;
-			msg.make_second_info(info.str());
-			msg.output_msg(2);
+		else{
+	        flag=CVSpilsGetWorkSpace(this->cvode_mem, &number_real, &number_int);
+			if(flag<0){
+				Warning msg=this->set_warning(0);
+				ostringstream info;
+				info <<"Solver function: CVSpgmrGetWorkSpace(this->cvode_mem, &number_real, &number_int)"<< endl;
+				info <<"CVode: " << this->cvode_init_flags2string(flag) << endl;
+				msg.make_second_info(info.str());
+				msg.output_msg(2);
+			}
+			this->solver_mem=this->solver_mem+ number_real * sizeof(realtype) + number_int * sizeof(int);
+
+	        flag=CVBandPrecGetWorkSpace(this->cvode_mem, &number_real, &number_int);
+			if(flag<0){
+				Warning msg=this->set_warning(0);
+				ostringstream info;
+				info <<"Solver function: CVBandPrecGetWorkSpace(this->bp_data, &number_real, &number_int)"<< endl;
+				info <<"CVode: " << this->cvode_init_flags2string(flag) << endl;
+				msg.make_second_info(info.str());
+				msg.output_msg(2);
+			}
+			this->solver_mem=this->solver_mem+number_real * sizeof(realtype) + number_int * sizeof(int);
 		}
-		this->solver_mem=this->solver_mem+number_real * sizeof(realtype) + number_int * sizeof(int);
 
 		//the realtype vector of the result and estimated_error =>2
 		this->solver_mem=this->solver_mem+this->NEQ*sizeof(realtype)*2;
@@ -165,6 +165,8 @@ protected:
     int *id_reduced;
 	///Half bandwidth of the system, which is to solve
 	int half_bandwidth;
+	///Flag if the direct band solver (CVBand) is used as linear solver instead of the Krylov solver (CVSpgmr) with the banded preconditioner
+	bool direct_solver_flag;
 	///Reached time of the solver
 	realtype reached_time;
 	///Maximum value of the N_Vector of errors
@@ -228,6 +230,11 @@ protected:
 	///Run the solver
 	void run_solver(const double next_time_point,  const string system_id);
 
+	///Initialize the linear solver; as default the Krylov solver (CVSpgmr) with the banded preconditioner is used
+	virtual void init_linear_solver(Hyd_Param_Global *global_params);
+	///Initialize the direct band solver (CVBand) as linear solver; without a Jacobian function (NULL) the difference quotient Jacobian of the solver is used
+	void init_band_solver(CVDlsBandJacFn jac_function);
+
 	//get the number of solver timesteps
 	long int get_number_solversteps(void);
 
@@ -303,6 +310,10 @@ private:
 
 	///Close the solver
 	void close_solver(void);
+	///Reset the initialised solver to the initial conditions by reusing its workspaces; false is returned, if a complete reinitialisation is required
+	bool reset_solver2init_condition(Hyd_Param_Global *global_params);
+	///Reset the initialised GPU solver to the initial conditions by reusing the compiled program and the device buffers; false is returned, if a complete reinitialisation is required
+	bool reset_solver_gpu2init_condition(void);
 	///Count solver memory
 	void count_solver_memory(void);
 
@@ -458,19 +458,7 @@ void Hyd_Coupling_FP2CO_Dikebreak::synchronise_models(const double timepoint, co
 
 		}
 
-		this->break_info_list.counter_breach.append(this->breach_counter);
-		this->break_info_list.delta_h2start.append(this->coast->get_global_sea_h()-this->start_waterlevel_global);
-		this->break_info_list.downstream_breach.append(this->breach_width_downstream);
-		this->break_info_list.downstream_delta_h.append(*this->deltah_downstream);
-		this->break_info_list.upstream_breach.append(this->breach_width_upstream);
-		this->break_info_list.upstream_delta_h.append(*this->deltah_upstream);
-		this->break_info_list.downstream_wall_stress.append(this->counter_stress_downstream);
-		this->break_info_list.upstream_wall_stress.append(this->counter_stress_upstream);
-		this->break_info_list.mean_q.append(this->mean_q);
-		this->break_info_list.mean_v.append(this->mean_v);
-		this->break_info_list.time.append(timepoint);
-		this->break_info_list.time_breach.append(this->breach_time);
-		this->break_info_list.total_breach.append(this->total_breach_width);
+		this->append_break_record(timepoint, this->coast->get_global_sea_h()-this->start_waterlevel_global);
 	}
 }
 //Output the members
@@ -516,19 +504,19 @@ void Hyd_Coupling_FP2CO_Dikebreak::output_index_coupled_models(ostringstream *co
 //Output result members to tecplot file
 void Hyd_Coupling_FP2CO_Dikebreak::output_results2file_tecplot (double const ){
 	if(this->file_name!=label::not_set){
-		for(int i=0; i< this->break_info_list.time.count(); i++){
-			this->output_file << W(9)<<P(0) << FORMAT_FIXED_REAL << this->break_info_list.time.at(i) <<W(16); 
-			this->output_file << this->break_info_list.counter_breach.at(i) << W(20) ;
-			this->output_file << this->break_info_list.time_breach.at(i) << W(20);
-			this->output_file <<P(3) << FORMAT_FIXED_REAL << this->break_info_list.total_breach.at(i) << W(20) ;
+		for(int i=0; i< this->number_break_records; i++){
+			this->output_file << W(9)<<P(0) << FORMAT_FIXED_REAL << this->break_records[i].time <<W(16); 
+			this->output_file << this->break_records[i].counter_breach << W(20) ;
+			this->output_file << this->break_records[i].time_breach << W(20);
+			this->output_file <<P(3) << FORMAT_FIXED_REAL << this->break_records[i].total_breach << W(20) ;
 			if(this->started_flag==true){
-				this->output_file << this->break_info_list.upstream_breach.at(i)+0.5*this->init_breach_width << W(20)<< this->break_info_list.downstream_breach.at(i) +0.5*this->init_breach_width<< W(29) ;
+				this->output_file << this->break_records[i].upstream_breach+0.5*this->init_breach_width << W(20)<< this->break_records[i].downstream_breach +0.5*this->init_breach_width<< W(29) ;
 			}
 			else{
 				this->output_file << 0.0 << W(20)<< 0.0<< W(29) ;
 			}
 			if(this->started_flag==true){
-				this->output_file << this->break_info_list.upstream_delta_h.at(i)<< W(29) ;
+				this->output_file << this->break_records[i].upstream_delta_h<< W(29) ;
 				this->output_file << this->break_params_upstream->resistance<< W(29) ;
 			}
 			else{
@@ -537,7 +525,7 @@ void Hyd_Coupling_FP2CO_Dikebreak::output_results2file_tecplot (double const ){
 			}
 			
 			if(this->started_flag==true){
-				this->output_file << this->break_info_list.downstream_delta_h.at(i)<< W(29) ;
+				this->output_file << this->break_records[i].downstream_delta_h<< W(29) ;
 				this->output_file << this->break_params_downstream->resistance<< W(29) ;
 			}
 			else{
@@ -545,13 +533,13 @@ void Hyd_Coupling_FP2CO_Dikebreak::output_results2file_tecplot (double const ){
 				this->output_file << 0.0<< W(29) ;
 			}
 	 
-			this->output_file << this->break_info_list.mean_q.at(i) << W(29) ;
-			this->output_file << this->break_info_list.mean_v.at(i) << W(29) ;
+			this->output_file << this->break_records[i].mean_q << W(29) ;
+			this->output_file << this->break_records[i].mean_v << W(29) ;
 
 			if(this->wall_breach_flag==true){
-				this->output_file << this->break_info_list.upstream_wall_stress.at(i)<< W(29) << this->break_info_list.downstream_wall_stress.at(i)<< W(29);
+				this->output_file << this->break_records[i].upstream_wall_stress<< W(29) << this->break_records[i].downstream_wall_stress<< W(29);
 			}
-			this->output_file << this->break_info_list.delta_h2start.at(i) << endl;
+			this->output_file << this->break_records[i].delta_h2start << endl;
 
 			
 
@@ -569,19 +557,19 @@ void Hyd_Coupling_FP2CO_Dikebreak::output_results2file_tecplot (double const ){
 //Output result members to csv file
 void Hyd_Coupling_FP2CO_Dikebreak::output_results2file_csv(double const global_time) {
 	if (this->file_name_csv != label::not_set) {
-		for (int i = 0; i < this->break_info_list.time.count(); i++) {
-			this->output_file_csv << W(9) << P(0) << FORMAT_FIXED_REAL << this->break_info_list.time.at(i) << W(16)<<",";
-			this->output_file_csv << this->break_info_list.counter_breach.at(i) << W(20) << ",";
-			this->output_file_csv << this->break_info_list.time_breach.at(i) << W(20) << ",";
-			this->output_file_csv << P(3) << FORMAT_FIXED_REAL << this->break_info_list.total_breach.at(i) << W(20) << ",";
+		for (int i = 0; i < this->number_break_records; i++) {
+			this->output_file_csv << W(9) << P(0) << FORMAT_FIXED_REAL << this->break_records[i].time << W(16)<<",";
+			this->output_file_csv << this->break_records[i].counter_breach << W(20) << ",";
+			this->output_file_csv << this->break_records[i].time_breach << W(20) << ",";
+			this->output_file_csv << P(3) << FORMAT_FIXED_REAL << this->break_records[i].total_breach << W(20) << ",";
 			if (this->started_flag == true) {
-				this->output_file_csv << this->break_info_list.upstream_breach.at(i) + 0.5*this->init_breach_width << W(20) << "," << this->break_info_list.downstream_breach.at(i) + 0.5*this->init_breach_width << W(29) << ",";
+				this->output_file_csv << this->break_records[i].upstream_breach + 0.5*this->init_breach_width << W(20) << "," << this->break_records[i].downstream_breach + 0.5*this->init_breach_width << W(29) << ",";
 			}
 			else {
 				this->output_file_csv << 0.0 << W(20) << "," << 0.0 << W(29) << ",";
 			}
 			if (this->started_flag == true) {
-				this->output_file_csv << this->break_info_list.upstream_delta_h.at(i) << W(29) << ",";
+				this->output_file_csv << this->break_records[i].upstream_delta_h << W(29) << ",";
 				this->output_file_csv << this->break_params_upstream->resistance << W(29) << ",";
 			}
 			else {
@@ -590,7 +578,7 @@ void Hyd_Coupling_FP2CO_Dikebreak::output_results2file_csv(double const global_t
 			}
 
 			if (this->started_flag == true) {
-				this->output_file_csv << this->break_info_list.downstream_delta_h.at(i) << W(29) << ",";
+				this->output_file_csv << this->break_records[i].downstream_delta_h << W(29) << ",";
 				this->output_file_csv << this->break_params_downstream->resistance << W(29) << ",";
 			}
 			else {
@@ -598,13 +586,13 @@ void Hyd_Coupling_FP2CO_Dikebreak::output_results2file_csv(double const global_t
 				this->output_file_csv << 0.0 << W(29) << ",";
 			}
 
-			this->output_file_csv << this->break_info_list.mean_q.at(i) << W(29) << ",";
-			this->output_file_csv << this->break_info_list.mean_v.at(i) << W(29) << ",";
+			this->output_file_csv << this->break_records[i].mean_q << W(29) << ",";
+			this->output_file_csv << this->break_records[i].mean_v << W(29) << ",";
 
 			if (this->wall_breach_flag == true) {
-				this->output_file_csv << this->break_info_list.upstream_wall_stress.at(i) << W(29) << "," << this->break_info_list.downstream_wall_stress.at(i) << W(29) << ",";
+				this->output_file_csv << this->break_records[i].upstream_wall_stress << W(29) << "," << this->break_records[i].downstream_wall_stress << W(29) << ",";
 			}
-			this->output_file_csv << this->break_info_list.delta_h2start.at(i) << endl;
+			this->output_file_csv << this->break_records[i].delta_h2start << endl;
 
 
 
@@ -844,19 +832,7 @@ void Hyd_Coupling_FP2CO_Dikebreak::init_output2file_tecplot(void){
 	//get the file name of the coast model
 	buffer=coast->get_crude_filename_result_1d();
 
-	this->break_info_list.counter_breach.clear();
-	this->break_info_list.delta_h2start.clear();
-	this->break_info_list.downstream_breach.clear();
-	this->break_info_list.downstream_delta_h.clear();
-	this->break_info_list.upstream_breach.clear();
-	this->break_info_list.upstream_delta_h.clear();
-	this->break_info_list.downstream_wall_stress.clear();
-	this->break_info_list.upstream_wall_stress.clear();
-	this->break_info_list.mean_q.clear();
-	this->break_info_list.mean_v.clear();
-	this->break_info_list.time.clear();
-	this->break_info_list.time_breach.clear();
-	this->break_info_list.total_breach.clear();
+	this->clear_break_list();
 	buffer += "/";
 	buffer += hyd_label::tecplot;
 	buffer += "/";
@@ -890,19 +866,7 @@ void Hyd_Coupling_FP2CO_Dikebreak::init_output2file_csv(void) {
 	//get the file name of the coast model
 	buffer = coast->get_crude_filename_result_1d();
 
-	this->break_info_list.counter_breach.clear();
-	this->break_info_list.delta_h2start.clear();
-	this->break_info_list.downstream_breach.clear();
-	this->break_info_list.downstream_delta_h.clear();
-	this->break_info_list.upstream_breach.clear();
-	this->break_info_list.upstream_delta_h.clear();
-	this->break_info_list.downstream_wall_stress.clear();
-	this->break_info_list.upstream_wall_stress.clear();
-	this->break_info_list.mean_q.clear();
-	this->break_info_list.mean_v.clear();
-	this->break_info_list.time.clear();
-	this->break_info_list.time_breach.clear();
-	this->break_info_list.total_breach.clear();
+	this->clear_break_list();
 	buffer += "/";
 	buffer += hyd_label::paraview;
 	buffer += "/";
@@ -1022,7 +986,6 @@ void Hyd_Coupling_FP2CO_Dikebreak::observe_starting_coupling_points(void){
 	int index_max=-1;
 
 
-	this->sort_list_possible_start_points();
 	for(int i=0; i< this->number_possible_start_points; i++){
 		if(this->coast->get_global_sea_h()-this->list_possible_start_points[i]->get_mid_basepoint_height()>this->max_observed_waterlevel){
 			this->max_observed_waterlevel=this->coast->get_global_sea_h()-this->list_possible_start_points[i]->get_mid_basepoint_height();
@@ -1055,29 +1018,6 @@ void Hyd_Coupling_FP2CO_Dikebreak::observe_starting_coupling_points(void){
 		}
 	}
 }
-//Sort the list of the possible starting points after the waterlevel
-void Hyd_Coupling_FP2CO_Dikebreak::sort_list_possible_start_points(void){
-/**
-Bubble-sort algorithm for the sorting the detailed results array after the annuality.
-*/
-	Hyd_Coupling_Point_FP2CO *temp;
-
-	double buff1=0.0;
-	double buff2=0.0;
-
-	for(int i = this->number_possible_start_points-1; i > 0; i--){
-		for (int j = 1; j <= i; j++){
-			buff1=this->coast->get_global_sea_h()-this->list_possible_start_points[j-1]->get_mid_basepoint_height();
-			buff2=this->coast->get_global_sea_h()-this->list_possible_start_points[j]->get_mid_basepoint_height();
-
-			if (buff1 < buff2){
-				temp = this->list_possible_start_points[j-1];
-				this->list_possible_start_points[j-1] = this->list_possible_start_points[j];
-				this->list_possible_start_points[j] = temp;
-			}
-		}
-	}
-}
 //Calculate the downstream breach opening
 void Hyd_Coupling_FP2CO_Dikebreak::calculate_downstream_opening(void){
 	if(this->downstream_open_flag==true){
@@ -1392,7 +1332,19 @@ void Hyd_Coupling_FP2CO_Dikebreak::calculate_mean_q_v(const double timepoint){
 	this->mean_v=0.0;
 	if(this->coupling_flag==true && this->started_flag==true){
 		int counter=0;
-		for(int i=0; i< this->point_list->get_number_couplings() ; i++){
+		//the breach grows point by point from the starting point; the involved points are the contiguous range between the upstream and downstream coupling point
+		int first=this->point_list->get_index_couplingpoint(this->upstream_coupling_point);
+		int last=this->point_list->get_index_couplingpoint(this->downstream_coupling_point);
+		if(first<0 || last<0){
+			first=0;
+			last=this->point_list->get_number_couplings()-1;
+		}
+		else if(first>last){
+			int buff=first;
+			first=last;
+			last=buff;
+		}
+		for(int i=first; i<= last ; i++){
 			if(this->index==this->point_list->get_ptr_couplingpoint(i)->get_index_break_class()){
 				counter++;
 				this->mean_q=this->mean_q+(-1.0)*this->point_list->get_ptr_couplingpoint(i)->get_q_break();
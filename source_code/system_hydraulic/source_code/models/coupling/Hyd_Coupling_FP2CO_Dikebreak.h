@@ -127,8 +127,6 @@ private:
 	void create_starting_coupling_point_list(Hyd_Floodplain_Dikeline_Point **involved_points, const int number_involved_points);
 	///Observe and switch, if required, the possible starting coupling points
 	void observe_starting_coupling_points(void);
-	///Sort the list of the possible starting points after the waterlevel
-	void sort_list_possible_start_points(void);
 
 
 	///Calculate the downstream breach opening
@@ -243,26 +243,27 @@ void Hyd_Coupling_Point_FP2CO_List::add_relevant_polysegment_points(Hyd_Floodpla
 }
 //Get the next coupling point upwards in the list
 Hyd_Coupling_Point_FP2CO* Hyd_Coupling_Point_FP2CO_List::get_next_point_upwards(Hyd_Coupling_Point_FP2CO* coupling_point){
-	Hyd_Coupling_Point_FP2CO* pointer=NULL;
-	for(int i=0; i<this->number-1;i++){
-		if(&this->points[i]==coupling_point){
-			pointer=&this->points[i+1];
-			break;
-		}
+	int index=this->get_index_couplingpoint(coupling_point);
+	if(index<0 || index>=this->number-1){
+		return NULL;
 	}
-	return pointer;
+	return &this->points[index+1];
 }
 //Get the next coupling point downwards in the list
 Hyd_Coupling_Point_FP2CO* Hyd_Coupling_Point_FP2CO_List::get_next_point_downwards(Hyd_Coupling_Point_FP2CO* coupling_point){
-	Hyd_Coupling_Point_FP2CO* pointer=NULL;
-	for(int i=1; i<this->number;i++){
-		if(&this->points[i]==coupling_point){
-			pointer=&this->points[i-1];
-			break;
-		}
+	int index=this->get_index_couplingpoint(coupling_point);
+	if(index<1){
+		return NULL;
 	}
-
-	return pointer;
+	return &this->points[index-1];
+}
+//Get the index of the given coupling point in the list; if it is not part of the list -1 is returned
+int Hyd_Coupling_Point_FP2CO_List::get_index_couplingpoint(Hyd_Coupling_Point_FP2CO* coupling_point){
+	//the points are stored contiguously; the index is given by the address
+	if(coupling_point==NULL || this->points==NULL || coupling_point<this->points || coupling_point>=this->points+this->number){
+		return -1;
+	}
+	return (int)(coupling_point-this->points);
 }
 //Get a point between the coupling points for the given distance from the beginning of the river; if nothing is found a NULL-pointer is returned
 Hyd_Coupling_Point_FP2CO* Hyd_Coupling_Point_FP2CO_List::find_coupling_point(const double distance, _Hyd_Coupling_Point *point){
@@ -74,6 +74,8 @@ public:
 	Hyd_Coupling_Point_FP2CO* get_next_point_upwards(Hyd_Coupling_Point_FP2CO* coupling_point);
 	///Get the next coupling point downwards in the list
 	Hyd_Coupling_Point_FP2CO* get_next_point_downwards(Hyd_Coupling_Point_FP2CO* coupling_point);
+	///Get the index of the given coupling point in the list; if it is not part of the list -1 is returned
+	int get_index_couplingpoint(Hyd_Coupling_Point_FP2CO* coupling_point);
 	
 	///Get a point between the coupling points for the given distance from the beginning of the river; if nothing is found a NULL-pointer is returned
 	Hyd_Coupling_Point_FP2CO* find_coupling_point(const double distance, _Hyd_Coupling_Point *point);
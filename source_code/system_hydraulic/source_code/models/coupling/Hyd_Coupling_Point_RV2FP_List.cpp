@@ -43,26 +43,27 @@ Hyd_Coupling_Point_RV2FP* Hyd_Coupling_Point_RV2FP_List::get_ptr_couplingpoint(c
 }
 //Get the next coupling point upwards in the list
 Hyd_Coupling_Point_RV2FP* Hyd_Coupling_Point_RV2FP_List::get_next_point_upwards(Hyd_Coupling_Point_RV2FP* coupling_point){
-	Hyd_Coupling_Point_RV2FP* pointer=NULL;
-	for(int i=0; i<this->number-1;i++){
-		if(&this->points[i]==coupling_point){
-			pointer=&this->points[i+1];
-			break;
-		}
+	int index=this->get_index_couplingpoint(coupling_point);
+	if(index<0 || index>=this->number-1){
+		return NULL;
 	}
-	return pointer;
+	return &this->points[index+1];
 }
 //Get the next coupling point downwards in the list
 Hyd_Coupling_Point_RV2FP* Hyd_Coupling_Point_RV2FP_List::get_next_point_downwards(Hyd_Coupling_Point_RV2FP* coupling_point){
-	Hyd_Coupling_Point_RV2FP* pointer=NULL;
-	for(int i=1; i<this->number;i++){
-		if(&this->points[i]==coupling_point){
-			pointer=&this->points[i-1];
-			break;
-		}
+	int index=this->get_index_couplingpoint(coupling_point);
+	if(index<1){
+		return NULL;
 	}
-
-	return pointer;
+	return &this->points[index-1];
+}
+//Get the index of the given coupling point in the list; if it is not part of the list -1 is returned
+int Hyd_Coupling_Point_RV2FP_List::get_index_couplingpoint(Hyd_Coupling_Point_RV2FP* coupling_point){
+	//the points are stored contiguously; the index is given by the address
+	if(coupling_point==NULL || this->points==NULL || coupling_point<this->points || coupling_point>=this->points+this->number){
+		return -1;
+	}
+	return (int)(coupling_point-this->points);
 }
 //Get the first coupling points of the list
 Hyd_Coupling_Point_RV2FP Hyd_Coupling_Point_RV2FP_List::get_first_couplingpoint(void){
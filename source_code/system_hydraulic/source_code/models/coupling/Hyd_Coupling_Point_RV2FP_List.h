@@ -53,6 +53,8 @@ public:
 	Hyd_Coupling_Point_RV2FP* get_next_point_upwards(Hyd_Coupling_Point_RV2FP* coupling_point);
 	///Get the next coupling point downwards in the list
 	Hyd_Coupling_Point_RV2FP* get_next_point_downwards(Hyd_Coupling_Point_RV2FP* coupling_point);
+	///Get the index of the given coupling point in the list; if it is not part of the list -1 is returned
+	int get_index_couplingpoint(Hyd_Coupling_Point_RV2FP* coupling_point);
 
 	///Get the first coupling points of the list
 	Hyd_Coupling_Point_RV2FP get_first_couplingpoint(void);
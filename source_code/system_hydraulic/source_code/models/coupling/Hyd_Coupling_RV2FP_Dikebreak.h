@@ -136,8 +136,6 @@ private:
 	void create_starting_coupling_point_list(_Hyd_River_Profile **involved_profiles, const int number_involved_profiles);
 	///Observe and switch, if required, the possible starting coupling points
 	void observe_starting_coupling_points(void);
-	///Sort the list of the possible starting points after the waterlevel
-	void sort_list_possible_start_points(void);
 
 
 	///Set the dikebreak coupling member with a structure where the parser has gathered the informations (_hyd_rv2fp_dikebreak_coupling_params)
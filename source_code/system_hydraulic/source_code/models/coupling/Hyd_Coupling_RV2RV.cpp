@@ -225,6 +225,18 @@ bool Hyd_Coupling_RV2RV::get_left_bank_flag_inflow(void){
 bool Hyd_Coupling_RV2RV::get_lateral_flag_inflow(void){
 	return this->lateral_flag_inflow;
 }
+//Get if the coupling to the inflow rivermodel is applied
+bool Hyd_Coupling_RV2RV::get_coupling_flag_inflow(void){
+	return this->coupling_flag_inflow;
+}
+//Get the pointer to the inflow rivermodel (receiving river)
+Hyd_Model_River* Hyd_Coupling_RV2RV::get_inflow_rv_model(void){
+	return this->inflow_rv_model;
+}
+//Get the pointer to the outflow rivermodel (discharging river)
+Hyd_Model_River* Hyd_Coupling_RV2RV::get_outflow_rv_model(void){
+	return this->outflow_rv_model;
+}
 //Insert the junction to a list of RV2FP-coupling points
 void Hyd_Coupling_RV2RV::insert_junction_inflow_point2RV2FPlist(Hyd_Coupling_Point_RV2FP_List *list, const int river_index){
 	if(this->lateral_flag_inflow==false){
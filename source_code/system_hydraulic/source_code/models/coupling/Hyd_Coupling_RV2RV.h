@@ -57,6 +57,13 @@ public:
 	bool get_left_bank_flag_inflow(void);
 	///Get if the junction is lateral
 	bool get_lateral_flag_inflow(void);
+	///Get if the coupling to the inflow rivermodel is applied
+	bool get_coupling_flag_inflow(void);
+
+	///Get the pointer to the inflow rivermodel (receiving river)
+	Hyd_Model_River* get_inflow_rv_model(void);
+	///Get the pointer to the outflow rivermodel (discharging river)
+	Hyd_Model_River* get_outflow_rv_model(void);
 
 	///Insert the junction to a list of RV2FP-coupling points
 	virtual void insert_junction_inflow_point2RV2FPlist(Hyd_Coupling_Point_RV2FP_List *list, const int river_index);
@@ -650,6 +650,18 @@ void Hyd_Coupling_RV2RV_Diversion::reset_coupling_discharges(void){
 		this->outflow_profile_up->reset_coupling_discharge_1d();
 	}
 }
+//Get the pointer to the diversion channel
+Hyd_Model_River* Hyd_Coupling_RV2RV_Diversion::get_diversion_rv_model(void){
+	return this->diversion_rv_model;
+}
+//Get if the diversion channel discharges into a river model
+bool Hyd_Coupling_RV2RV_Diversion::get_outflow_river_flag(void){
+	return this->outflow_river_flag;
+}
+//Get if the coupling to the outflow rivermodel is applied
+bool Hyd_Coupling_RV2RV_Diversion::get_coupling_flag_outflow(void){
+	return this->coupling_flag_outflow;
+}
 //Output the members
 void Hyd_Coupling_RV2RV_Diversion::output_members(void){
 	ostringstream cout;
@@ -72,6 +72,14 @@ public:
 
 	///Output the members
 	void output_members(void);
+
+	///Get the pointer to the diversion channel
+	Hyd_Model_River* get_diversion_rv_model(void);
+	///Get if the diversion channel discharges into a river model
+	bool get_outflow_river_flag(void);
+	///Get if the coupling to the outflow rivermodel is applied
+	bool get_coupling_flag_outflow(void);
+
 	///Output the header for the coupled model indizes
 	static void output_header_coupled_indices(ostringstream *cout);
 	///Output the indizes of the coupled model
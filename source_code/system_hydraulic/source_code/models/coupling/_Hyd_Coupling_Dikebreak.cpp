@@ -58,6 +58,10 @@ _Hyd_Coupling_Dikebreak::_Hyd_Coupling_Dikebreak(void): default_max_breach_width
 	this->file_name_csv = label::not_set;
 	this->user_defined=true;
 
+	this->break_records=NULL;
+	this->number_break_records=0;
+	this->number_alloc_break_records=0;
+
 
 }
 //Default destructor
@@ -65,6 +69,7 @@ _Hyd_Coupling_Dikebreak::~_Hyd_Coupling_Dikebreak(void){
 
 	this->close_output_file();
 	this->close_output_file_csv();
+	this->delete_break_records();
 
 }
 //________
@@ -926,25 +931,9 @@ void _Hyd_Coupling_Dikebreak::output_point2database(QSqlDatabase *ptr_database){
 		throw msg;
 	}
 }
-///Clear break list
+//Clear break list; the allocated buffer is kept for the next output step
 void _Hyd_Coupling_Dikebreak::clear_break_list(void) {
-
-	this->break_info_list.counter_breach.clear();
-	this->break_info_list.delta_h2start.clear();
-	this->break_info_list.downstream_breach.clear();
-	this->break_info_list.downstream_delta_h.clear();
-	this->break_info_list.upstream_breach.clear();
-	this->break_info_list.upstream_delta_h.clear();
-	this->break_info_list.downstream_wall_stress.clear();
-	this->break_info_list.upstream_wall_stress.clear();
-	this->break_info_list.mean_q.clear();
-	this->break_info_list.mean_v.clear();
-	this->break_info_list.time.clear();
-	this->break_info_list.time_breach.clear();
-	this->break_info_list.total_breach.clear();
-
-
-
+	this->number_break_records=0;
 }
 //__________
 //protected
@@ -1034,6 +1023,36 @@ void _Hyd_Coupling_Dikebreak::calculate_total_mean_delta_h(void){
 		}	
 	}
 }
+//Append the current break parameters as record to the buffer for the file output
+void _Hyd_Coupling_Dikebreak::append_break_record(const double timepoint, const double delta_h2start){
+	//no file output is required
+	if(this->file_name==label::not_set && this->file_name_csv==label::not_set){
+		return;
+	}
+	if(this->number_break_records>=this->number_alloc_break_records){
+		int new_number=2*this->number_alloc_break_records;
+		if(new_number<64){
+			new_number=64;
+		}
+		this->allocate_break_records(new_number);
+	}
+
+	_hyd_break_record *record=&this->break_records[this->number_break_records];
+	record->time=timepoint;
+	record->counter_breach=this->breach_counter;
+	record->time_breach=this->breach_time;
+	record->total_breach=this->total_breach_width;
+	record->upstream_breach=this->breach_width_upstream;
+	record->downstream_breach=this->breach_width_downstream;
+	record->upstream_delta_h=*this->deltah_upstream;
+	record->downstream_delta_h=*this->deltah_downstream;
+	record->mean_q=this->mean_q;
+	record->mean_v=this->mean_v;
+	record->delta_h2start=delta_h2start;
+	record->upstream_wall_stress=this->counter_stress_upstream;
+	record->downstream_wall_stress=this->counter_stress_downstream;
+	this->number_break_records++;
+}
 //Close the output file
 void _Hyd_Coupling_Dikebreak::close_output_file(void){
 	if(this->output_file.is_open()==true){
@@ -1077,6 +1096,40 @@ void _Hyd_Coupling_Dikebreak::open_output_file_csv(void) {
 }
 //______
 //private
+//Allocate the buffer for the break records with the given number of records; stored records are kept
+void _Hyd_Coupling_Dikebreak::allocate_break_records(const int number){
+	_hyd_break_record *buffer=NULL;
+	try{
+		buffer=new _hyd_break_record[number];
+		Sys_Memory_Count::self()->add_mem(sizeof(_hyd_break_record)*number, _sys_system_modules::HYD_SYS);
+	}
+	catch(bad_alloc &t){
+		Error msg=this->set_error(3);
+		ostringstream info;
+		info<< "Info bad alloc: " << t.what() << endl;
+		msg.make_second_info(info.str());
+		throw msg;
+	}
+	//keep the stored records
+	const int number_stored=this->number_break_records;
+	for(int i=0; i<number_stored; i++){
+		buffer[i]=this->break_records[i];
+	}
+	this->delete_break_records();
+	this->break_records=buffer;
+	this->number_alloc_break_records=number;
+	this->number_break_records=number_stored;
+}
+//Delete the buffer for the break records
+void _Hyd_Coupling_Dikebreak::delete_break_records(void){
+	if(this->break_records!=NULL){
+		delete []this->break_records;
+		this->break_records=NULL;
+		Sys_Memory_Count::self()->minus_mem(sizeof(_hyd_break_record)*this->number_alloc_break_records, _sys_system_modules::HYD_SYS);
+	}
+	this->number_alloc_break_records=0;
+	this->number_break_records=0;
+}
 //Set error(s)
 Error _Hyd_Coupling_Dikebreak::set_error(const int err_type){
 	string place="_Hyd_Coupling_Dikebreak::";
@@ -1111,6 +1164,12 @@ Error _Hyd_Coupling_Dikebreak::set_error(const int err_type){
 			info << "Dikebreak coupling index: " << this->index << endl;
 			type = 5;
 			break;
+		case 3://bad alloc
+			place.append("allocate_break_records(const int number)");
+			reason="Can not allocate the memory";
+			help="Check the memory";
+			type=10;
+			break;
 		default:
 			place.append("set_error(const int err_type)");
 			reason ="Unknown flag!";
@@ -27,36 +27,34 @@ struct _hyd_breach_start_parameters{
 
 };
 
-///Structure to gather information of the break in list for an file output
-struct _hyd_break_list{
+///Structure to gather the information of the break at one synchronisation step for the file output \ingroup hyd
+struct _hyd_break_record{
 	///Time point [s]
-	QList<double> time;
+	double time;
 	///Counter breach [-]
-	QList<int> counter_breach;
+	int counter_breach;
 	///Time of breach [s]
-	QList<double> time_breach;
+	double time_breach;
 	///Total breach width [m]
-	QList<double> total_breach;
+	double total_breach;
 	///Upstream breach width [m]
-	QList<double> upstream_breach;
+	double upstream_breach;
 	///Downstream breach width [m]
-	QList<double> downstream_breach;
+	double downstream_breach;
 	///Upstream delta waterlevel [m]
-	QList<double> upstream_delta_h;
+	double upstream_delta_h;
 	///Downstream delta waterlevel [m]
-	QList<double> downstream_delta_h;
+	double downstream_delta_h;
 	///Mean discharge [m^3/s]
-	QList<double> mean_q;
+	double mean_q;
 	///Mean velocity [m/s]
-	QList<double> mean_v;
+	double mean_v;
 	///Delta waterlevel to start height [m]
-	QList<double> delta_h2start;
+	double delta_h2start;
 	///Stress to the upstream wall [m]
-	QList<double> upstream_wall_stress;
+	double upstream_wall_stress;
 	///Stress to the downstream wall [m]
-	QList<double> downstream_wall_stress;
-
-
+	double downstream_wall_stress;
 };
 
 
@@ -164,8 +162,12 @@ protected:
 
 
 
-	///Lists where information about the break parameters are stored
-	_hyd_break_list break_info_list;
+	///Buffer where the information about the break parameters are stored between two output steps; the allocated memory is reused
+	_hyd_break_record *break_records;
+	///Number of the stored break records
+	int number_break_records;
+	///Number of the allocated break records
+	int number_alloc_break_records;
 
 
 
@@ -303,6 +305,9 @@ protected:
 	///Calculate the total mean delta h at the breach heads 
 	void calculate_total_mean_delta_h(void);
 
+	///Append the current break parameters as record to the buffer for the file output
+	void append_break_record(const double timepoint, const double delta_h2start);
+
 	///Close the output file for tecplot
 	void close_output_file(void);
 	///Open the outpufile for tecplot; if it is open it will be closed
@@ -323,6 +328,10 @@ protected:
 private:
 
 	//method
+	///Allocate the buffer for the break records with the given number of records; stored records are kept
+	void allocate_break_records(const int number);
+	///Delete the buffer for the break records
+	void delete_break_records(void);
 	///Set error(s)
 	Error set_error(const int err_type);
 	///Set warning(s)
@@ -1,5 +1,14 @@
 #include "Hyd_Headers_Precompiled.h"
 //#include "Hyd_Floodplain_Raster.h"
+#include <algorithm>
+
+//Compare two candidates of raster element and polysegment segment (sorting by the element index, than by the segment index)
+static bool compare_raster_candidates(const _hyd_raster_candidate &first, const _hyd_raster_candidate &second){
+	if(first.elem_index!=second.elem_index){
+		return first.elem_index<second.elem_index;
+	}
+	return first.segment_index<second.segment_index;
+}
 
 //constructor
 Hyd_Floodplain_Raster::Hyd_Floodplain_Raster(void){
@@ -332,35 +341,49 @@ Hyd_Floodplainraster_Point * Hyd_Floodplain_Raster::get_raster_point(const int i
 }
 //Set a given type to Hyd_Element_Floodplain (e.g. noflow) if a raster polygon (Hyd_Floodplain_Raster_Polygon) is inside a given polygon 
 void Hyd_Floodplain_Raster::set_rasterpolygon_inside(Hyd_Floodplain_Polygon *polygon){
-	for(int i=0; i< this->number_polygons; i++){
+	//just the elements inside the bounding box of the polygon are relevant
+	int ix_min=0;
+	int iy_min=0;
+	int ix_max=-1;
+	int iy_max=-1;
+	if(this->find_elem_range_by_polygon(polygon, &ix_min, &iy_min, &ix_max, &iy_max)==false){
+		return;
+	}
+	for(int j=iy_min; j<= iy_max; j++){
 		Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
-		//set the polygon
-		this->set_raster_polygon(i);
-		//check if the raster polygon is inside the given polygon
-		this->raster_elem.is_inside_polygon(polygon);
-
-		
+		for(int i=ix_min; i<= ix_max; i++){
+			//set the polygon
+			this->set_raster_polygon(j*this->geo_info.number_x+i);
+			//check if the raster polygon is inside the given polygon
+			this->raster_elem.is_inside_polygon(polygon);
+		}
 	}
 }
 //Set a given type to Hyd_Element_Floodplain (e.g. noflow) if a raster polygon (Hyd_Floodplain_Raster_Polygon) intercepts a given polygon 
 void Hyd_Floodplain_Raster::set_rasterpolygon_intercepted(Hyd_Floodplain_Polygon *polygon,  _hyd_elem_type type){
-	for(int i=0; i< this->number_polygons; i++){
-		//set the polygon
+	//just the elements inside the bounding box of the polygon are relevant
+	int ix_min=0;
+	int iy_min=0;
+	int ix_max=-1;
+	int iy_max=-1;
+	if(this->find_elem_range_by_polygon(polygon, &ix_min, &iy_min, &ix_max, &iy_max)==false){
+		return;
+	}
+	for(int j=iy_min; j<= iy_max; j++){
 		Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
-		this->set_raster_polygon(i);
-		//check if the raster polygon is inside the given polygon
-		this->raster_elem.is_intercepted_polygon(polygon, type);
+		for(int i=ix_min; i<= ix_max; i++){
+			//set the polygon
+			this->set_raster_polygon(j*this->geo_info.number_x+i);
+			//check if the raster polygon is inside the given polygon
+			this->raster_elem.is_intercepted_polygon(polygon, type);
+		}
 	}
 }
 //Intercept a Hyd_Floodplainpolysegment with the raster (e.g. dikeline, riverline)
 void Hyd_Floodplain_Raster::interception_polysegments2raster(Hyd_Floodplain_Polysegment *line){
 	try{
-		for(int i=0; i< this->number_polygons; i++){
-			//set the polygon
-			this->set_raster_polygon(i);
-			//make the interception
-			this->raster_elem.calculate_polysegment_interception(&line->intercept_list, line);
-		}
+		//make the interception with the candidate elements
+		this->calculate_polysegment_interception_candidates(&line->intercept_list, line);
 		//sort the points in list after the distance to the beginning of the polysegment
 		line->intercept_list.sort_distance();
 		//output for development
@@ -386,12 +409,7 @@ void Hyd_Floodplain_Raster::assign_elements2couplingpointlist(Hyd_Coupling_Point
 		//first delete the interception list of the defining polysegment
 		list->get_defining_polysegment()->intercept_list.delete_list();
 		//fill it with the interception points
-		for(int i=0; i< this->number_polygons; i++){
-			//set the polygon
-			this->set_raster_polygon(i);
-			//make the interception
-			this->raster_elem.calculate_polysegment_interception(&(list->get_defining_polysegment()->intercept_list), list->get_defining_polysegment());
-		}
+		this->calculate_polysegment_interception_candidates(&(list->get_defining_polysegment()->intercept_list), list->get_defining_polysegment());
 		//sort the interception points in list after the distance to the beginning of the polysegment
 		list->get_defining_polysegment()->intercept_list.sort_distance();
 
@@ -441,12 +459,7 @@ void Hyd_Floodplain_Raster::assign_elements2couplingpointlist(Hyd_Coupling_Point
 		//first delete the interception list of the defining polysegment
 		list->get_defining_polysegment()->intercept_list.delete_list();
 		//fill it with the interception points
-		for(int i=0; i< this->number_polygons; i++){
-			//set the polygon
-			this->set_raster_polygon(i);
-			//make the interception
-			this->raster_elem.calculate_polysegment_interception(&(list->get_defining_polysegment()->intercept_list), list->get_defining_polysegment());
-		}
+		this->calculate_polysegment_interception_candidates(&(list->get_defining_polysegment()->intercept_list), list->get_defining_polysegment());
 		//sort the interception points in list after the distance to the beginning of the polysegment
 		list->get_defining_polysegment()->intercept_list.sort_distance();
 
@@ -529,12 +542,7 @@ void Hyd_Floodplain_Raster::assign_elements2couplingpointlist(Hyd_Coupling_Point
 		//for debug
 		//list->get_defining_polysegment()->output_members();
 		//fill it with the interception points
-		for(int i=0; i< this->number_polygons; i++){
-			//set the polygon
-			this->set_raster_polygon(i);
-			//make the interception
-			this->raster_elem.calculate_polysegment_interception(&(list->get_defining_polysegment()->intercept_list), list->get_defining_polysegment());
-		}
+		this->calculate_polysegment_interception_candidates(&(list->get_defining_polysegment()->intercept_list), list->get_defining_polysegment());
 		//sort the interception points in list after the distance to the beginning of the polysegment
 		list->get_defining_polysegment()->intercept_list.sort_distance();
 
@@ -682,26 +690,50 @@ void Hyd_Floodplain_Raster::assign_elements2couplingpointlist(Hyd_Coupling_Point
 //Find the index of a raster element where a given point is inside; if it is at boundary nothing is found
 int Hyd_Floodplain_Raster::find_elem_index_by_point(Geo_Point *point){
 	int index=-1;
-
-	for(int i=0; i< this->number_polygons;i++){
-		this->set_raster_polygon(i);
-		if(this->raster_elem.check_point_inside(point)==true){
-			index=i;
-			break;
-		}	
+	//just the element of the point and its neighbours are checked
+	double x_local=0.0;
+	double y_local=0.0;
+	int ix_min=0;
+	int iy_min=0;
+	int ix_max=-1;
+	int iy_max=-1;
+	this->transform_global2local(point, &x_local, &y_local);
+	if(this->find_elem_range_by_box(x_local, y_local, x_local, y_local, &ix_min, &iy_min, &ix_max, &iy_max)==false){
+		return index;
+	}
+	for(int j=iy_min; j<= iy_max && index<0; j++){
+		for(int i=ix_min; i<= ix_max; i++){
+			this->set_raster_polygon(j*this->geo_info.number_x+i);
+			if(this->raster_elem.check_point_inside(point)==true){
+				index=j*this->geo_info.number_x+i;
+				break;
+			}
+		}
 	}
 	return index;
 }
 //Find the index of a raster element where a given point is inside or at boundary
 int Hyd_Floodplain_Raster::find_elem_index_by_point_withboundary(Geo_Point *point){
 	int index=-1;
-
-	for(int i=0; i< this->number_polygons;i++){
-		this->set_raster_polygon(i);
-		if(this->raster_elem.check_point_inside(point)==true || this->raster_elem.check_point_atboundary(point)==true ){
-			index=i;
-			break;
-		}	
+	//just the element of the point and its neighbours are checked
+	double x_local=0.0;
+	double y_local=0.0;
+	int ix_min=0;
+	int iy_min=0;
+	int ix_max=-1;
+	int iy_max=-1;
+	this->transform_global2local(point, &x_local, &y_local);
+	if(this->find_elem_range_by_box(x_local, y_local, x_local, y_local, &ix_min, &iy_min, &ix_max, &iy_max)==false){
+		return index;
+	}
+	for(int j=iy_min; j<= iy_max && index<0; j++){
+		for(int i=ix_min; i<= ix_max; i++){
+			this->set_raster_polygon(j*this->geo_info.number_x+i);
+			if(this->raster_elem.check_point_inside(point)==true || this->raster_elem.check_point_atboundary(point)==true ){
+				index=j*this->geo_info.number_x+i;
+				break;
+			}
+		}
 	}
 	return index;
 }
@@ -787,8 +819,27 @@ void Hyd_Floodplain_Raster::search_convenient_coupling_element(int *elem_index,
 }
 //Set raster segments to noflow, if there are inside or at boundary of a given polygon
 void Hyd_Floodplain_Raster::set_raster_segments2noflow(Hyd_Floodplain_Polygon *polygon){
-	
+	//just the segments inside the bounding box of the polygon are relevant
+	int ix_min=0;
+	int iy_min=0;
+	int ix_max=-1;
+	int iy_max=-1;
+	if(this->find_elem_range_by_polygon(polygon, &ix_min, &iy_min, &ix_max, &iy_max)==false){
+		return;
+	}
+	int ix_1=0;
+	int iy_1=0;
+	int ix_2=0;
+	int iy_2=0;
 	for(int i=0; i< this->number_segments; i++){
+		//the raster points are numbered row by row with number_x+1 points per row
+		ix_1=this->raster_segments[i].get_firstpoint_index()%(this->geo_info.number_x+1);
+		iy_1=this->raster_segments[i].get_firstpoint_index()/(this->geo_info.number_x+1);
+		ix_2=this->raster_segments[i].get_secondpoint_index()%(this->geo_info.number_x+1);
+		iy_2=this->raster_segments[i].get_secondpoint_index()/(this->geo_info.number_x+1);
+		if(min(ix_1,ix_2)<ix_min || max(ix_1,ix_2)>ix_max+1 || min(iy_1,iy_2)<iy_min || max(iy_1,iy_2)>iy_max+1){
+			continue;
+		}
 		if(polygon->check_segment_is_inside(&this->raster_segments[i])==true){
 			this->raster_segments[i].assign_value_flag2floodplain_element(0.0,constant::poleni_const, true);
 		}
@@ -966,6 +1017,187 @@ void Hyd_Floodplain_Raster::set_raster_polygon(const int element_index){
 	//set the pointer to the floodplain element
 	this->raster_elem.set_ptr2floodplain_element(&(this->floodplain_pointer[element_index]));
 }
+//Transform a point in global coordinates into the local raster coordinates
+void Hyd_Floodplain_Raster::transform_global2local(Geo_Point *point, double *x_local, double *y_local){
+	double rad_angle=_Geo_Geometrie::grad_to_rad(this->geo_info.angle);
+	double delta_x=point->get_xcoordinate()-this->geo_info.origin_global_x;
+	double delta_y=point->get_ycoordinate()-this->geo_info.origin_global_y;
+	//inverse of Geo_Point::transform_coordinate_system(angle, x_origin, y_origin)
+	*x_local=delta_x*cos(rad_angle)-delta_y*sin(rad_angle);
+	*y_local=delta_x*sin(rad_angle)+delta_y*cos(rad_angle);
+}
+//Find the range of element indices in x- and y-direction, which cover a given bounding box in local raster coordinates; false is returned if the box is outside the raster
+bool Hyd_Floodplain_Raster::find_elem_range_by_box(const double x_min, const double y_min, const double x_max, const double y_max, int *ix_min, int *iy_min, int *ix_max, int *iy_max){
+	if(this->geo_info.number_x<=0 || this->geo_info.number_y<=0 || this->geo_info.width_x<=0.0 || this->geo_info.width_y<=0.0){
+		return false;
+	}
+	//the box is enlarged by a tolerance; points at the element boundary are also found in the neighbouring elements
+	const double margin=10.0*constant::meter_epsilon;
+	double buff_min_x=floor((x_min-margin)/this->geo_info.width_x);
+	double buff_max_x=floor((x_max+margin)/this->geo_info.width_x);
+	double buff_min_y=floor((y_min-margin)/this->geo_info.width_y);
+	double buff_max_y=floor((y_max+margin)/this->geo_info.width_y);
+
+	if(buff_max_x<0.0 || buff_max_y<0.0 || buff_min_x>(double)(this->geo_info.number_x-1) || buff_min_y>(double)(this->geo_info.number_y-1)){
+		return false;
+	}
+	*ix_min=(int)max(buff_min_x, 0.0);
+	*iy_min=(int)max(buff_min_y, 0.0);
+	*ix_max=(int)min(buff_max_x, (double)(this->geo_info.number_x-1));
+	*iy_max=(int)min(buff_max_y, (double)(this->geo_info.number_y-1));
+	return true;
+}
+//Find the range of element indices in x- and y-direction, which cover the bounding box of a given polygon; false is returned if the polygon is outside the raster
+bool Hyd_Floodplain_Raster::find_elem_range_by_polygon(_Geo_Polygon *polygon, int *ix_min, int *iy_min, int *ix_max, int *iy_max){
+	if(polygon->get_number_points()<=0){
+		return false;
+	}
+	double x_local=0.0;
+	double y_local=0.0;
+	this->transform_global2local(polygon->get_point(0), &x_local, &y_local);
+	double x_min=x_local;
+	double x_max=x_local;
+	double y_min=y_local;
+	double y_max=y_local;
+	for(int i=1; i< polygon->get_number_points(); i++){
+		this->transform_global2local(polygon->get_point(i), &x_local, &y_local);
+		x_min=min(x_min, x_local);
+		x_max=max(x_max, x_local);
+		y_min=min(y_min, y_local);
+		y_max=max(y_max, y_local);
+	}
+	return this->find_elem_range_by_box(x_min, y_min, x_max, y_max, ix_min, iy_min, ix_max, iy_max);
+}
+//Find the candidate pairs of raster elements and segments of a polysegment, which may intercept each other; they are sorted by the element index and the segment index
+int Hyd_Floodplain_Raster::find_candidates_polysegment(Geo_Polysegment *line, _hyd_raster_candidate **candidates){
+	*candidates=NULL;
+	if(this->number_polygons<=0 || line->get_number_segments()<=0){
+		return 0;
+	}
+	//the segments are divided into pieces not longer than an element; the bounding box of each piece covers just a few elements
+	double step=min(this->geo_info.width_x, this->geo_info.width_y);
+	double x_1=0.0;
+	double y_1=0.0;
+	double x_2=0.0;
+	double y_2=0.0;
+	double x_a=0.0;
+	double y_a=0.0;
+	double x_b=0.0;
+	double y_b=0.0;
+	int number_pieces=0;
+	int ix_min=0;
+	int iy_min=0;
+	int ix_max=-1;
+	int iy_max=-1;
+	int number=0;
+	int counter=0;
+
+	//first run: count the candidates; second run: set them
+	for(int run=0; run<2; run++){
+		counter=0;
+		for(int j=0; j< line->get_number_segments(); j++){
+			this->transform_global2local(&(line->my_segment[j].point1), &x_1, &y_1);
+			this->transform_global2local(&(line->my_segment[j].point2), &x_2, &y_2);
+			number_pieces=(int)ceil(max(abs(x_2-x_1), abs(y_2-y_1))/step);
+			if(number_pieces<1){
+				number_pieces=1;
+			}
+			for(int k=0; k< number_pieces; k++){
+				x_a=x_1+(x_2-x_1)*(double)k/(double)number_pieces;
+				y_a=y_1+(y_2-y_1)*(double)k/(double)number_pieces;
+				x_b=x_1+(x_2-x_1)*(double)(k+1)/(double)number_pieces;
+				y_b=y_1+(y_2-y_1)*(double)(k+1)/(double)number_pieces;
+				if(this->find_elem_range_by_box(min(x_a,x_b), min(y_a,y_b), max(x_a,x_b), max(y_a,y_b), &ix_min, &iy_min, &ix_max, &iy_max)==false){
+					continue;
+				}
+				for(int iy=iy_min; iy<= iy_max; iy++){
+					for(int ix=ix_min; ix<= ix_max; ix++){
+						if(run==1){
+							(*candidates)[counter].elem_index=iy*this->geo_info.number_x+ix;
+							(*candidates)[counter].segment_index=j;
+						}
+						counter++;
+					}
+				}
+			}
+		}
+		if(run==0){
+			number=counter;
+			if(number==0){
+				return 0;
+			}
+			try{
+				*candidates=new _hyd_raster_candidate[number];
+			}
+			catch(bad_alloc &t){
+				Error msg=this->set_error(3);
+				ostringstream info;
+				info<< "Info bad alloc: " << t.what() << endl;
+				msg.make_second_info(info.str());
+				throw msg;
+			}
+		}
+	}
+
+	//sort them by the element index and remove the double candidates
+	sort(*candidates, *candidates+number, compare_raster_candidates);
+	counter=0;
+	for(int i=0; i< number; i++){
+		if(counter==0 || (*candidates)[i].elem_index!=(*candidates)[counter-1].elem_index || (*candidates)[i].segment_index!=(*candidates)[counter-1].segment_index){
+			(*candidates)[counter]=(*candidates)[i];
+			counter++;
+		}
+	}
+	return counter;
+}
+//Calculate the interception points of a polysegment with the raster elements; just the candidate elements are checked
+void Hyd_Floodplain_Raster::calculate_polysegment_interception_candidates(Geo_Interception_Point_List *intercept_list, Geo_Polysegment *line){
+	_hyd_raster_candidate *candidates=NULL;
+	int *segment_index=NULL;
+	int number=0;
+	int start=0;
+	try{
+		number=this->find_candidates_polysegment(line, &candidates);
+		if(number==0){
+			return;
+		}
+		segment_index=new int[number];
+		for(int i=0; i< number; i++){
+			segment_index[i]=candidates[i].segment_index;
+		}
+		//the elements are checked in ascending order like a complete search over the raster
+		for(int i=1; i<= number; i++){
+			if(i==number || candidates[i].elem_index!=candidates[start].elem_index){
+				//set the polygon
+				this->set_raster_polygon(candidates[start].elem_index);
+				//make the interception
+				this->raster_elem.calculate_polysegment_interception(intercept_list, line, &(segment_index[start]), i-start);
+				start=i;
+			}
+		}
+	}
+	catch(bad_alloc &t){
+		if(candidates!=NULL){
+			delete []candidates;
+		}
+		Error msg=this->set_error(3);
+		ostringstream info;
+		info<< "Info bad alloc: " << t.what() << endl;
+		msg.make_second_info(info.str());
+		throw msg;
+	}
+	catch(Error msg){
+		if(candidates!=NULL){
+			delete []candidates;
+		}
+		if(segment_index!=NULL){
+			delete []segment_index;
+		}
+		throw msg;
+	}
+	delete []candidates;
+	delete []segment_index;
+}
 //Assign values (heights or noflow flags) and the corresponding index of a point to raster_point_list
 void Hyd_Floodplain_Raster::assign_points_value2list(Hyd_Floodplain_Polysegment *line){
 	//for assigning the element type of intercepted elements
@@ -1878,6 +2110,12 @@ Error Hyd_Floodplain_Raster::set_error(const int err_type){
 			help="Check the memory";
 			type=10;
 			break;
+		case 3://bad alloc
+			place.append("find_candidates_polysegment(Geo_Polysegment *line, _hyd_raster_candidate **candidates)");
+			reason="Can not allocate the memory";
+			help="Check the memory";
+			type=10;
+			break;
 		default:
 			place.append("set_error(const int err_type)");
 			reason ="Unknown flag!";
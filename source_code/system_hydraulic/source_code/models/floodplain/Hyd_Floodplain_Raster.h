@@ -26,6 +26,14 @@
 //geo classes
 #include "Geo_Point_List.h"
 
+///Data structure for a candidate pair of a raster element and a segment of a polysegment, which may intercept each other \ingroup hyd
+struct _hyd_raster_candidate{
+	///Index of the raster element
+	int elem_index;
+	///Index of the segment of the polysegment
+	int segment_index;
+};
+
 ///Geometrical raster of the floodplain model \ingroup hyd
 /**
 The raster consists of polygons, always rectangular, segments and points.
@@ -33,6 +41,9 @@ For the sake of compuation time the segments and the points of the raster are
 generated and stored during the geometrical interceptions of the floodplain with other models, e.g.
 ither floodplain models, dike lines, noflow polygons, river models etc.
 In constrast the polygons are for every interception action generated with the help of the segments.
+The raster is uniform, thus it is used as its own spatial index: before a geometrical action the relevant
+elements are found directly via the local raster coordinates of the intercepting geometry, instead of
+checking every element of the raster.
 
 \see Hyd_Model_Floodplain, Hyd_Floodplainraster_Segment, Hyd_Floodplainraster_Polygon, Hyd_Floodplainraster_Point
 */
@@ -204,6 +215,17 @@ private:
 	///Find element index, when one segments index and one point index are given
 	int points_segment_index2elem_index(const int seg_index , const int point_index, const _hyd_floodplain_polysegment_type type);
 
+	///Transform a point in global coordinates into the local raster coordinates
+	void transform_global2local(Geo_Point *point, double *x_local, double *y_local);
+	///Find the range of element indices in x- and y-direction, which cover a given bounding box in local raster coordinates; false is returned if the box is outside the raster
+	bool find_elem_range_by_box(const double x_min, const double y_min, const double x_max, const double y_max, int *ix_min, int *iy_min, int *ix_max, int *iy_max);
+	///Find the range of element indices in x- and y-direction, which cover the bounding box of a given polygon; false is returned if the polygon is outside the raster
+	bool find_elem_range_by_polygon(_Geo_Polygon *polygon, int *ix_min, int *iy_min, int *ix_max, int *iy_max);
+	///Find the candidate pairs of raster elements and segments of a polysegment, which may intercept each other; they are sorted by the element index and the segment index
+	int find_candidates_polysegment(Geo_Polysegment *line, _hyd_raster_candidate **candidates);
+	///Calculate the interception points of a polysegment with the raster elements; just the candidate elements are checked
+	void calculate_polysegment_interception_candidates(Geo_Interception_Point_List *intercept_list, Geo_Polysegment *line);
+
 	///Set an element type (_hyd_elem_type) to the element with the given element index
 	void set_elem_type_per_elemindex(const int elem_index, _hyd_elem_type type);
 
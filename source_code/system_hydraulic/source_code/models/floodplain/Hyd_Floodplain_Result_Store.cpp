@@ -0,0 +1,464 @@
+#include "Hyd_Headers_Precompiled.h"
+//#include "Hyd_Floodplain_Result_Store.h"
+
+//Default constructor
+Hyd_Floodplain_Result_Store::Hyd_Floodplain_Result_Store(void){
+	this->chunk_buffer=NULL;
+	this->mapped=NULL;
+	this->reset_members();
+	//count the memory
+	Sys_Memory_Count::self()->add_mem(sizeof(Hyd_Floodplain_Result_Store), _sys_system_modules::HYD_SYS);
+}
+//Default destructor
+Hyd_Floodplain_Result_Store::~Hyd_Floodplain_Result_Store(void){
+	try{
+		this->close_store();
+	}
+	catch(Error msg){
+		msg.output_msg(2);
+	}
+	//count the memory
+	Sys_Memory_Count::self()->minus_mem(sizeof(Hyd_Floodplain_Result_Store), _sys_system_modules::HYD_SYS);
+}
+//____________
+//public
+//Open a new store for writing; an existing file is overwritten
+void Hyd_Floodplain_Result_Store::open_store2write(const string filename, const _hyd_floodplain_geo_info geo_info, const int number_series, const int chunk_size){
+	this->close_store();
+	this->filename=filename;
+	this->geo_info=geo_info;
+	this->number_series=number_series;
+	this->chunk_size=chunk_size;
+	if(this->chunk_size<1){
+		this->chunk_size=Hyd_Floodplain_Result_Store::default_chunk_size;
+	}
+	this->number_chunks_x=(this->geo_info.number_x+this->chunk_size-1)/this->chunk_size;
+	this->number_chunks_y=(this->geo_info.number_y+this->chunk_size-1)/this->chunk_size;
+
+	try{
+		this->chunk_buffer=new float[this->chunk_size*this->chunk_size*this->number_series];
+		Sys_Memory_Count::self()->add_mem(sizeof(float)*this->chunk_size*this->chunk_size*this->number_series, _sys_system_modules::HYD_SYS);
+	}
+	catch(bad_alloc &t){
+		Error msg=this->set_error(1);
+		ostringstream info;
+		info<< "Info bad alloc: " << t.what() << endl;
+		msg.make_second_info(info.str());
+		throw msg;
+	}
+
+	this->file.setFileName(this->filename.c_str());
+	if(this->file.open(QIODevice::WriteOnly|QIODevice::Truncate)==false){
+		Error msg=this->set_error(0);
+		ostringstream info;
+		info << "Filename " << this->filename << endl;
+		msg.make_second_info(info.str());
+		this->close_store();
+		throw msg;
+	}
+	this->write_flag=true;
+
+	//header
+	qint32 header[6];
+	header[0]=Hyd_Floodplain_Result_Store::store_version;
+	header[1]=this->geo_info.number_x;
+	header[2]=this->geo_info.number_y;
+	header[3]=this->chunk_size;
+	header[4]=this->number_series;
+	header[5]=0;
+	double geo[5];
+	geo[0]=this->geo_info.origin_global_x;
+	geo[1]=this->geo_info.origin_global_y;
+	geo[2]=this->geo_info.width_x;
+	geo[3]=this->geo_info.width_y;
+	geo[4]=this->geo_info.angle;
+	if(this->file.write((const char*)header, sizeof(header))!=sizeof(header) || this->file.write((const char*)geo, sizeof(geo))!=sizeof(geo)){
+		Error msg=this->set_error(3);
+		ostringstream info;
+		info << "Filename " << this->filename << endl;
+		msg.make_second_info(info.str());
+		this->write_flag=false;
+		this->close_store();
+		throw msg;
+	}
+}
+//Write the results of one output time (values: number of series * number of elements, series by series)
+void Hyd_Floodplain_Result_Store::write_frame(const double time, const double *values){
+	if(this->write_flag==false){
+		return;
+	}
+	const int number_elems=this->geo_info.number_x*this->geo_info.number_y;
+	int x_start=0;
+	int x_end=0;
+	int y_start=0;
+	int y_end=0;
+	int number_in_chunk=0;
+	int count=0;
+	QByteArray block;
+	//the frame is added to the index after all blocks are written
+	QVector<qint64> position;
+	QVector<qint64> size;
+
+	for(int c=0; c<this->get_number_chunks(); c++){
+		this->get_chunk_range(c, &x_start, &x_end, &y_start, &y_end);
+		number_in_chunk=(x_end-x_start)*(y_end-y_start);
+		//series by series, the elements row by row
+		for(int s=0; s<this->number_series; s++){
+			count=s*number_in_chunk;
+			for(int j=y_start; j<y_end; j++){
+				for(int i=x_start; i<x_end; i++){
+					this->chunk_buffer[count]=(float)values[s*number_elems+j*this->geo_info.number_x+i];
+					count++;
+				}
+			}
+		}
+		block=qCompress((const uchar*)this->chunk_buffer, (int)(sizeof(float)*number_in_chunk*this->number_series));
+		position.append(this->file.pos());
+		size.append(block.size());
+		if(this->file.write(block)!=block.size()){
+			//the store is incomplete: no footer is written
+			this->write_flag=false;
+			Error msg=this->set_error(3);
+			ostringstream info;
+			info << "Filename " << this->filename << endl;
+			info << "Time point " << time << label::sec << endl;
+			msg.make_second_info(info.str());
+			throw msg;
+		}
+	}
+	this->frame_time.append(time);
+	this->block_position.append(position);
+	this->block_size.append(size);
+}
+//Open an existing store for reading; the file is mapped into memory
+void Hyd_Floodplain_Result_Store::open_store2read(const string filename){
+	this->close_store();
+	this->filename=filename;
+	this->file.setFileName(this->filename.c_str());
+
+	const qint64 header_size=sizeof(qint32)*6+sizeof(double)*5;
+	const qint64 trailer_size=sizeof(qint64)*2;
+	if(this->file.open(QIODevice::ReadOnly)==true && this->file.size()>=header_size+trailer_size){
+		this->mapped=this->file.map(0, this->file.size());
+	}
+	if(this->mapped==NULL){
+		Error msg=this->set_error(2);
+		ostringstream info;
+		info << "Filename " << this->filename << endl;
+		msg.make_second_info(info.str());
+		this->close_store();
+		throw msg;
+	}
+
+	//header
+	qint32 header[6];
+	double geo[5];
+	memcpy(header, this->mapped, sizeof(header));
+	memcpy(geo, this->mapped+sizeof(header), sizeof(geo));
+	this->geo_info.number_x=header[1];
+	this->geo_info.number_y=header[2];
+	this->chunk_size=header[3];
+	this->number_series=header[4];
+	this->geo_info.origin_global_x=geo[0];
+	this->geo_info.origin_global_y=geo[1];
+	this->geo_info.width_x=geo[2];
+	this->geo_info.width_y=geo[3];
+	this->geo_info.angle=geo[4];
+
+	//trailer
+	qint64 trailer[2];
+	memcpy(trailer, this->mapped+this->file.size()-trailer_size, sizeof(trailer));
+
+	bool valid=(header[0]==Hyd_Floodplain_Result_Store::store_version && this->chunk_size>0 && this->number_series>0 && this->geo_info.number_x>0 && this->geo_info.number_y>0);
+	if(valid==true){
+		this->number_chunks_x=(this->geo_info.number_x+this->chunk_size-1)/this->chunk_size;
+		this->number_chunks_y=(this->geo_info.number_y+this->chunk_size-1)/this->chunk_size;
+		const qint64 frame_size=sizeof(double)+sizeof(qint64)*2*this->get_number_chunks();
+		valid=(trailer[1]>=0 && trailer[1]<=this->file.size()/frame_size && trailer[0]>=header_size && trailer[0]+trailer[1]*frame_size==this->file.size()-trailer_size);
+	}
+	//footer: the blocks have to be between the header and the footer
+	const uchar *footer=this->mapped+trailer[0];
+	double time=0.0;
+	qint64 block[2];
+	for(qint64 f=0; f<trailer[1] && valid==true; f++){
+		memcpy(&time, footer, sizeof(double));
+		footer=footer+sizeof(double);
+		this->frame_time.append(time);
+		for(int c=0; c<this->get_number_chunks(); c++){
+			memcpy(block, footer, sizeof(block));
+			footer=footer+sizeof(block);
+			if(block[0]<header_size || block[1]<=(qint64)sizeof(quint32) || block[1]>trailer[0]-block[0]){
+				valid=false;
+				break;
+			}
+			this->block_position.append(block[0]);
+			this->block_size.append(block[1]);
+		}
+	}
+	if(valid==false){
+		Error msg=this->set_error(2);
+		ostringstream info;
+		info << "Filename " << this->filename << endl;
+		info << "The file is not a complete floodplain result store" << endl;
+		msg.make_second_info(info.str());
+		this->close_store();
+		throw msg;
+	}
+}
+//Get the number of frames (output times) in the store
+int Hyd_Floodplain_Result_Store::get_number_frames(void){
+	return this->frame_time.size();
+}
+//Get the number of result series per frame
+int Hyd_Floodplain_Result_Store::get_number_series(void){
+	return this->number_series;
+}
+//Get the geometrical information of the raster
+_hyd_floodplain_geo_info Hyd_Floodplain_Result_Store::get_geometrical_info(void){
+	return this->geo_info;
+}
+//Get the time point of a frame
+double Hyd_Floodplain_Result_Store::get_frame_time(const int frame){
+	if(frame<0 || frame>=this->frame_time.size()){
+		return 0.0;
+	}
+	return this->frame_time.at(frame);
+}
+//Get the value of one series for one element at one frame
+double Hyd_Floodplain_Result_Store::get_value(const int frame, const int series, const int index){
+	if(frame<0 || frame>=this->frame_time.size() || series<0 || series>=this->number_series || index<0 || index>=this->geo_info.number_x*this->geo_info.number_y){
+		Error msg=this->set_error(5);
+		ostringstream info;
+		info << "Filename " << this->filename << endl;
+		info << "Frame " << frame << "; series " << series << "; element " << index << endl;
+		msg.make_second_info(info.str());
+		throw msg;
+	}
+	int pos_in_chunk=0;
+	int number_in_chunk=0;
+	int chunk=this->get_chunk_element(index, &pos_in_chunk, &number_in_chunk);
+	this->read_block(frame, chunk);
+	return (double)(((const float*)this->cached_block.constData())[series*number_in_chunk+pos_in_chunk]);
+}
+//Get the time series of one series for one element (values: number of frames)
+void Hyd_Floodplain_Result_Store::get_time_series(const int series, const int index, double *values){
+	for(int f=0; f<this->frame_time.size(); f++){
+		values[f]=this->get_value(f, series, index);
+	}
+}
+//Get the values of one series for all elements at one frame (values: number of elements)
+void Hyd_Floodplain_Result_Store::get_frame(const int frame, const int series, double *values){
+	int x_start=0;
+	int x_end=0;
+	int y_start=0;
+	int y_end=0;
+	int number_in_chunk=0;
+	const float *block=NULL;
+	//read the first value to check the range
+	this->get_value(frame, series, 0);
+	for(int c=0; c<this->get_number_chunks(); c++){
+		this->get_chunk_range(c, &x_start, &x_end, &y_start, &y_end);
+		number_in_chunk=(x_end-x_start)*(y_end-y_start);
+		this->read_block(frame, c);
+		block=((const float*)this->cached_block.constData())+series*number_in_chunk;
+		for(int j=y_start; j<y_end; j++){
+			for(int i=x_start; i<x_end; i++){
+				values[j*this->geo_info.number_x+i]=(double)(*block);
+				block++;
+			}
+		}
+	}
+}
+//Get if the store is open
+bool Hyd_Floodplain_Result_Store::get_store_is_open(void){
+	return this->file.isOpen();
+}
+//Close the store; in case of writing the index footer is written
+void Hyd_Floodplain_Result_Store::close_store(void){
+	bool footer_error=false;
+	if(this->write_flag==true && this->file.isOpen()==true){
+		footer_error=!this->file.seek(this->file.size());
+		if(footer_error==false){
+			this->write_footer();
+			footer_error=(this->file.error()!=QFileDevice::NoError);
+		}
+	}
+	if(this->mapped!=NULL){
+		this->file.unmap(this->mapped);
+		this->mapped=NULL;
+	}
+	if(this->file.isOpen()==true){
+		this->file.close();
+	}
+	if(this->chunk_buffer!=NULL){
+		delete []this->chunk_buffer;
+		this->chunk_buffer=NULL;
+		Sys_Memory_Count::self()->minus_mem(sizeof(float)*this->chunk_size*this->chunk_size*this->number_series, _sys_system_modules::HYD_SYS);
+	}
+	string buffer=this->filename;
+	this->reset_members();
+	if(footer_error==true){
+		Error msg=this->set_error(3);
+		ostringstream info;
+		info << "Filename " << buffer << endl;
+		msg.make_second_info(info.str());
+		throw msg;
+	}
+}
+//____________
+//private
+//Get the number of chunks per frame
+int Hyd_Floodplain_Result_Store::get_number_chunks(void){
+	return this->number_chunks_x*this->number_chunks_y;
+}
+//Get the chunk of an element and the position of the element in the chunk
+int Hyd_Floodplain_Result_Store::get_chunk_element(const int index, int *pos_in_chunk, int *number_in_chunk){
+	const int index_x=index%this->geo_info.number_x;
+	const int index_y=index/this->geo_info.number_x;
+	const int chunk=(index_y/this->chunk_size)*this->number_chunks_x+index_x/this->chunk_size;
+	int x_start=0;
+	int x_end=0;
+	int y_start=0;
+	int y_end=0;
+	this->get_chunk_range(chunk, &x_start, &x_end, &y_start, &y_end);
+	*number_in_chunk=(x_end-x_start)*(y_end-y_start);
+	*pos_in_chunk=(index_y-y_start)*(x_end-x_start)+(index_x-x_start);
+	return chunk;
+}
+//Get the range of the elements of a chunk
+void Hyd_Floodplain_Result_Store::get_chunk_range(const int chunk, int *x_start, int *x_end, int *y_start, int *y_end){
+	*x_start=(chunk%this->number_chunks_x)*this->chunk_size;
+	*y_start=(chunk/this->number_chunks_x)*this->chunk_size;
+	*x_end=min(*x_start+this->chunk_size, this->geo_info.number_x);
+	*y_end=min(*y_start+this->chunk_size, this->geo_info.number_y);
+}
+//Read and uncompress a block into the cache
+void Hyd_Floodplain_Result_Store::read_block(const int frame, const int chunk){
+	if(frame==this->cached_frame && chunk==this->cached_chunk){
+		return;
+	}
+	const int id=frame*this->get_number_chunks()+chunk;
+	int x_start=0;
+	int x_end=0;
+	int y_start=0;
+	int y_end=0;
+	this->get_chunk_range(chunk, &x_start, &x_end, &y_start, &y_end);
+	const int expected_size=(int)(sizeof(float)*(x_end-x_start)*(y_end-y_start)*this->number_series);
+	//the block starts with the uncompressed size (big-endian); it is checked before the memory is allocated
+	const uchar *data=this->mapped+this->block_position.at(id);
+	const quint32 stored_size=((quint32)data[0]<<24)|((quint32)data[1]<<16)|((quint32)data[2]<<8)|(quint32)data[3];
+	if(stored_size==(quint32)expected_size){
+		this->cached_block=qUncompress(data, (int)this->block_size.at(id));
+	}
+	else{
+		this->cached_block.clear();
+	}
+	if(this->cached_block.size()!=expected_size){
+		this->cached_frame=-1;
+		this->cached_chunk=-1;
+		Error msg=this->set_error(4);
+		ostringstream info;
+		info << "Filename " << this->filename << endl;
+		info << "Frame " << frame << "; chunk " << chunk << endl;
+		msg.make_second_info(info.str());
+		throw msg;
+	}
+	this->cached_frame=frame;
+	this->cached_chunk=chunk;
+}
+//Write the index footer and the trailer
+void Hyd_Floodplain_Result_Store::write_footer(void){
+	qint64 trailer[2];
+	trailer[0]=this->file.pos();
+	trailer[1]=this->frame_time.size();
+	double time=0.0;
+	qint64 block[2];
+	for(int f=0; f<this->frame_time.size(); f++){
+		time=this->frame_time.at(f);
+		this->file.write((const char*)&time, sizeof(double));
+		for(int c=0; c<this->get_number_chunks(); c++){
+			block[0]=this->block_position.at(f*this->get_number_chunks()+c);
+			block[1]=this->block_size.at(f*this->get_number_chunks()+c);
+			this->file.write((const char*)block, sizeof(block));
+		}
+	}
+	this->file.write((const char*)trailer, sizeof(trailer));
+}
+//Reset the members
+void Hyd_Floodplain_Result_Store::reset_members(void){
+	this->filename=label::not_set;
+	this->write_flag=false;
+	this->geo_info.width_x=0.0;
+	this->geo_info.width_y=0.0;
+	this->geo_info.angle=0.0;
+	this->geo_info.number_x=0;
+	this->geo_info.number_y=0;
+	this->geo_info.origin_global_x=0.0;
+	this->geo_info.origin_global_y=0.0;
+	this->number_series=0;
+	this->chunk_size=Hyd_Floodplain_Result_Store::default_chunk_size;
+	this->number_chunks_x=0;
+	this->number_chunks_y=0;
+	this->frame_time.clear();
+	this->block_position.clear();
+	this->block_size.clear();
+	this->cached_block.clear();
+	this->cached_frame=-1;
+	this->cached_chunk=-1;
+}
+//Set error(s)
+Error Hyd_Floodplain_Result_Store::set_error(const int err_type){
+	string place="Hyd_Floodplain_Result_Store::";
+	string help;
+	string reason;
+	int type=0;
+	bool fatal=false;
+	stringstream info;
+	Error msg;
+	switch (err_type){
+		case 0://file can not be opened
+			place.append("open_store2write(const string filename, const _hyd_floodplain_geo_info geo_info, const int number_series, const int chunk_size)");
+			reason="Can not open the file of the floodplain result store for writing";
+			help="Check the file and the output folder";
+			type=5;
+			break;
+		case 1://bad alloc
+			place.append("open_store2write(const string filename, const _hyd_floodplain_geo_info geo_info, const int number_series, const int chunk_size)");
+			reason="Can not allocate the memory";
+			help="Check the memory";
+			type=10;
+			break;
+		case 2://file can not be opened or mapped
+			place.append("open_store2read(const string filename)");
+			reason="Can not open and map the file of the floodplain result store";
+			help="Check the file; the store has to be closed correctly after writing";
+			type=5;
+			break;
+		case 3://file can not be written
+			place.append("write_frame(const double time, const double *values)/close_store(void)");
+			reason="Can not write to the file of the floodplain result store";
+			help="Check the file and the free disk space";
+			type=5;
+			break;
+		case 4://block can not be uncompressed
+			place.append("read_block(const int frame, const int chunk)");
+			reason="Can not uncompress a block of the floodplain result store";
+			help="Check the file";
+			type=5;
+			break;
+		case 5://out of range
+			place.append("get_value(const int frame, const int series, const int index)");
+			reason="The frame, the series or the element index is not in the floodplain result store";
+			help="Check the requested values";
+			type=6;
+			break;
+		default:
+			place.append("set_error(const int err_type)");
+			reason ="Unknown flag!";
+			help="Check the flags";
+			type=6;
+	}
+	msg.set_msg(place, reason, help, type, fatal);
+	msg.make_second_info(info.str());
+	return msg;
+}
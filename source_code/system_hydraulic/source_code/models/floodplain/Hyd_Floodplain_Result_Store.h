@@ -0,0 +1,136 @@
+#pragma once
+/**\class Hyd_Floodplain_Result_Store
+	\author Daniel Bachmann et al.
+	\author produced by the Institute of Hydraulic Engineering (IWW), RWTH Aachen University
+	\version 0.0.1
+	\date 2009
+*/
+#ifndef HYD_FLOODPLAIN_RESULT_STORE_H
+#define HYD_FLOODPLAIN_RESULT_STORE_H
+
+//qt libs
+#include <QFile>
+#include <QVector>
+#include <QByteArray>
+
+//system hyd libs
+//container class for the floodplain parameter
+#include "Hyd_Param_FP.h"
+
+///Class for a chunked binary store of the raster results of a floodplain model per output time \ingroup hyd
+/**
+The store is one file per floodplain model. The raster is divided into quadratic chunks (tiles) of
+chunk_size x chunk_size elements; per output time (frame) each chunk is written as one compressed block,
+which contains all result series of the chunk elements (series by series, float values). At the end of
+the calculation an index footer with the time points and the file positions of all blocks is written.
+
+File layout:
+	- header: int32 {version, number x, number y, chunk size, number of series, reserved}; double {origin x, origin y, width x, width y, angle}
+	- compressed blocks of the frames, chunk by chunk (row-major)
+	- footer: per frame the time point (double) and per chunk the file position and the size of the block (int64)
+	- trailer: int64 {position of the footer, number of frames}
+
+For reading the file is mapped into memory; the value of an element at one time or the time series of
+one element is found via the footer without reading the other blocks. The index of an element is the
+index of the floodplain element (index x + index y * number x).
+
+\see Hyd_Model_Floodplain
+*/
+class Hyd_Floodplain_Result_Store
+{
+public:
+	///Default constructor
+	Hyd_Floodplain_Result_Store(void);
+	///Default destructor
+	~Hyd_Floodplain_Result_Store(void);
+
+	//members
+	///Default number of elements per side of a chunk
+	static const int default_chunk_size=256;
+	///Version of the file layout
+	static const int store_version=1;
+
+	//methods
+	///Open a new store for writing; an existing file is overwritten
+	void open_store2write(const string filename, const _hyd_floodplain_geo_info geo_info, const int number_series, const int chunk_size=Hyd_Floodplain_Result_Store::default_chunk_size);
+	///Write the results of one output time (values: number of series * number of elements, series by series)
+	void write_frame(const double time, const double *values);
+
+	///Open an existing store for reading; the file is mapped into memory
+	void open_store2read(const string filename);
+	///Get the number of frames (output times) in the store
+	int get_number_frames(void);
+	///Get the number of result series per frame
+	int get_number_series(void);
+	///Get the geometrical information of the raster
+	_hyd_floodplain_geo_info get_geometrical_info(void);
+	///Get the time point of a frame
+	double get_frame_time(const int frame);
+	///Get the value of one series for one element at one frame
+	double get_value(const int frame, const int series, const int index);
+	///Get the time series of one series for one element (values: number of frames)
+	void get_time_series(const int series, const int index, double *values);
+	///Get the values of one series for all elements at one frame (values: number of elements)
+	void get_frame(const int frame, const int series, double *values);
+
+	///Get if the store is open
+	bool get_store_is_open(void);
+	///Close the store; in case of writing the index footer is written
+	void close_store(void);
+
+private:
+	//members
+	///File of the store
+	QFile file;
+	///Name of the file
+	string filename;
+	///Flag if the store is opened for writing
+	bool write_flag;
+	///Mapped file content in case of reading
+	uchar *mapped;
+
+	///Geometrical information of the raster
+	_hyd_floodplain_geo_info geo_info;
+	///Number of result series per frame
+	int number_series;
+	///Number of elements per side of a chunk
+	int chunk_size;
+	///Number of chunks in x-direction
+	int number_chunks_x;
+	///Number of chunks in y-direction
+	int number_chunks_y;
+
+	///Time points of the frames
+	QVector<double> frame_time;
+	///File positions of the compressed blocks (frame by frame, chunk by chunk)
+	QVector<qint64> block_position;
+	///Sizes of the compressed blocks (frame by frame, chunk by chunk)
+	QVector<qint64> block_size;
+
+	///Buffer for the values of one chunk before compression
+	float *chunk_buffer;
+	///Uncompressed block, which was read last
+	QByteArray cached_block;
+	///Frame of the cached block
+	int cached_frame;
+	///Chunk of the cached block
+	int cached_chunk;
+
+	//methods
+	///Get the number of chunks per frame
+	int get_number_chunks(void);
+	///Get the chunk of an element and the position of the element in the chunk
+	int get_chunk_element(const int index, int *pos_in_chunk, int *number_in_chunk);
+	///Get the range of the elements of a chunk
+	void get_chunk_range(const int chunk, int *x_start, int *x_end, int *y_start, int *y_end);
+	///Read and uncompress a block into the cache
+	void read_block(const int frame, const int chunk);
+	///Write the index footer and the trailer
+	void write_footer(void);
+	///Reset the members
+	void reset_members(void);
+
+	///Set error(s)
+	Error set_error(const int err_type);
+};
+#endif
@@ -4,11 +4,13 @@
 //Default constructor
 Hyd_Gis2Promraster_Converter::Hyd_Gis2Promraster_Converter(void){
 
-	this->second_infos=NULL;
+	this->element_values=NULL;
+	this->number_values=NULL;
 	this->prom_raster=true;
 	this->noinfo_value=-9999.0;
 	this->file_name=label::not_set;
-	this->last_found_id=0;
+	this->charac_position=0;
+	this->charac_line=0;
 	//count the memory
 	Sys_Memory_Count::self()->add_mem(sizeof(Hyd_Gis2Promraster_Converter), _sys_system_modules::HYD_SYS);
 }
@@ -23,6 +25,9 @@ Hyd_Gis2Promraster_Converter::~Hyd_Gis2Promraster_Converter(void){
 //Ask the input files for the conversion per dialog
 //Read in and set the Gis raster
 void Hyd_Gis2Promraster_Converter::input_gis_raster(QString file_name){
+	/**Just the raster information is read in; the characteristics of the elements are read block by block
+	in the interception (see intercept_rasters()), thus the GIS-raster is not kept in memory.
+	*/
 
 	ostringstream prefix;
 	prefix << "GIS2PROM> ";
@@ -57,15 +62,14 @@ void Hyd_Gis2Promraster_Converter::input_gis_raster(QString file_name){
 		Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
 
 		this->set_geometric_info(this->geo_info);
-		this->generate_alloc_points_segments();
+		this->number_polygons=this->geo_info.number_x*this->geo_info.number_y;
 		this->make_boundary2polygon();
-		this->allocate_secondary_info();
 		Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
 
-		//read raster elem info
-		this->read_raster_elem_characteristic(&ifile, &line_counter);
-		Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
-		this->sort_raster_characteristics();
+		//search the begin of the raster elem info and keep the position for the interception
+		this->find_raster_elem_characteristic(&ifile, &line_counter);
+		this->charac_position=ifile.tellg();
+		this->charac_line=line_counter;
 
 		//init raster
 
@@ -127,7 +131,7 @@ void Hyd_Gis2Promraster_Converter::input_prom_raster(QString file_name){
 		Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
 		//init raster
 		this->set_geometric_info(this->geo_info);
-		this->generate_alloc_points_segments();
+		this->number_polygons=this->geo_info.number_x*this->geo_info.number_y;
 		this->make_boundary2polygon();
 		this->allocate_secondary_info();
 		Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
@@ -165,22 +169,6 @@ Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
 		Sys_Common_Output::output_hyd->output_txt(&cout);
 		return false;
 	}
-	double perc=this->geometrical_bound.calculate_area()/int_area;
-	//set just the list, if 0.8 percent is outside
-	if(perc<0.8){
-		//fill the list
-		this->outside_list.clear();
-		for(int i=0; i<this->number_polygons; i++){
-			this->outside_list.append(false);
-		}
-		//set which elements are completly outside 
-		this->set_completly_ouside_elements(&gis_raster->geometrical_bound);
-	}
-
-	
-
-
-
 
 	//check the diagonals 
 	bool identical=this->check_raster_identical(gis_raster);
@@ -216,27 +204,14 @@ Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
 	}
 
 
-	//make the interception per element mid-point
-	Geo_Point mid;
-	for(int i=0; i< gis_raster->number_polygons; i++){
-		Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
-
-		if(i%1000==0 && i>0){
-			cout << "Interception for elements (GIS-raster) "<< i <<" to " << i+1000 <<" ("<<gis_raster->geo_info.number_x*gis_raster->geo_info.number_y<<")..."<< endl;
-			Sys_Common_Output::output_hyd->output_txt(&cout);
-		}
-		if(abs(gis_raster->second_infos[i].last()-gis_raster->noinfo_value)<=constant::zero_epsilon){
-			continue;
-		}
-
-		gis_raster->set_geometrical_raster_polygon(i);
-		gis_raster->raster_elem.set_mid_point(&mid);
-		if(this->geometrical_bound.check_point_inside_atboundary(&mid)==true){
-			this->search_element(&mid, gis_raster, i);
-		}
+	//make the interception per element mid-point; the GIS-raster is read block by block
+	try{
+		this->intercept_gis_characteristics(gis_raster);
+	}
+	catch(Error msg){
+		Sys_Common_Output::output_hyd->rewind_userprefix();
+		throw msg;
 	}
-
-
 
 	//calculate the final value per element
 	this->calculate_value_element(gis_raster->noinfo_value);
@@ -290,9 +265,17 @@ void Hyd_Gis2Promraster_Converter::output_prom_raster2file(void){
 	output<<"# elementnr[-]	z-value[m] mattype[#;default:7]	init-condition[m]  boundarycondition[true/false] stationary/instationary[true/false]    boundaryvalue_stat[m3/s]/boundary-curvenr_instat[-]   boundary-type(area[(m/s)/m], point[m/s])"<<endl;
 	output<<"!BEGIN"<<endl;
 
+	//the lines are collected and written in blocks
+	ostringstream block;
 	for(int i=0; i< this->number_polygons; i++){
-		output << " " <<i<<"   "<< this->second_infos[i].last()<< "    " << 7 << "   " << 0.0 <<"   "<<"false     false    0"<<endl; 
+		block << " " <<i<<"   "<< this->element_values[i]<< "    " << 7 << "   " << 0.0 <<"   "<<"false     false    0"<<"\n";
+		if((i+1)%Hyd_Gis2Promraster_Converter::block_lines==0){
+			output << block.str();
+			block.str("");
+			Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
+		}
 	}
+	output << block.str();
 	output<<"!END"<<endl;
 
 
@@ -363,17 +346,9 @@ void Hyd_Gis2Promraster_Converter::read_raster_infos(ifstream *ifile, int *line_
 	//check the raster information
 	this->check_raster_info();
 }
-//Read the charactersistics of the elements per file
-void Hyd_Gis2Promraster_Converter::read_raster_elem_characteristic(ifstream *ifile, int *line_counter){
-
-	if(this->prom_raster==true){
-		return;
-	}
-
-
-	//read in
+//Search the begin of the charactersistics of the elements per file
+void Hyd_Gis2Promraster_Converter::find_raster_elem_characteristic(ifstream *ifile, int *line_counter){
 	string myline;
-	stringstream my_stream;
 	bool found_flag=false;
 
 	//search for the begin
@@ -391,97 +366,75 @@ void Hyd_Gis2Promraster_Converter::read_raster_elem_characteristic(ifstream *ifi
 	if(found_flag==false){
 		Error msg=this->set_error(10);
 		throw msg;
-
 	}
-	else{
-		found_flag=false;
-	}
-
-	int counter_col=0;
+}
+//Read a block of rows of the charactersistics of the elements per file (values: number of rows * number x, in order of the file); the number of read rows is returned
+int Hyd_Gis2Promraster_Converter::read_raster_elem_rows(ifstream *ifile, int *line_counter, double *values, const int number_rows, bool *end_found){
+	/**The reading stops after the given number of rows or at the end of the characteristics. With a number of
+	rows of 0 it is checked that the end of the characteristics follows.
+	*/
+	string myline;
 	int counter_row=0;
-	int counter_total=0;
+	int counter_col=0;
 	int pos=-1;
 	double buffer_info=0.0;
+	*end_found=false;
 
-	//read in the charactersistics
-	do{
+	while(ifile->eof()==false){
+		if(number_rows>0 && counter_row==number_rows){
+			break;
+		}
 		getline(*ifile, myline,'\n');
 		(*line_counter)++;
 		functions::clean_string(&myline);
 		pos=myline.find(hyd_label::end_charac);
 		if(pos>=0){
-			found_flag=true;
+			*end_found=true;
 			break;
 		}
-		if(counter_row==this->geo_info.number_y){
+		if(myline.empty()==true){
+			continue;
+		}
+		if(number_rows==0){
+			//a further row instead of the end
 			break;
 		}
-		if(myline.empty()==false){
-			counter_row++;
-			do{
-				string buffer= functions::get_column(&myline);
-				my_stream << buffer;
-				my_stream >> buffer_info;
-				Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
-				this->second_infos[counter_total].append(buffer_info);
-
-				if(my_stream.fail()==true){
-					my_stream.clear();
-					ostringstream info;
-					info << "Wrong input sequenze  : " << my_stream.str() << myline << endl;
-					Error msg=this->set_error(12);
-					msg.make_second_info(info.str());
-					throw msg;
-				}
-				my_stream.str("");
-				my_stream.clear();
-				counter_col++;
-				counter_total++;
-
-				if(counter_col==this->geo_info.number_x){
-					break;
-				}
-			}
-			while(myline.empty()==false);
-		
 
-			if(myline.empty()!=false){
-				Warning msg=this->set_warning(2);
-				ostringstream info;
-				info<< "No. of columns required :" << this->geo_info.number_x << endl;
-				info<< "No. of columns found    :" << counter_col;
-				info <<"Error occurs near line  : "<< line_counter << endl;
-				msg.make_second_info(info.str());
-				msg.output_msg(2);
-
-			}
-			if(counter_col<this->geo_info.number_x){
-				Error msg=this->set_error(11);
+		//read the columns of the row
+		istringstream my_stream(myline);
+		double *row=&values[counter_row*this->geo_info.number_x];
+		counter_col=0;
+		while(counter_col<this->geo_info.number_x && (my_stream >> buffer_info)){
+			row[counter_col]=buffer_info;
+			counter_col++;
+		}
+		if(counter_col<this->geo_info.number_x){
+			if(my_stream.eof()==false){
 				ostringstream info;
-				info<< "No. of columns required :" << this->geo_info.number_x << endl;
-				info<< "No. of columns found    :" << counter_col;
+				info << "Wrong input sequenze  : " << myline << endl;
+				Error msg=this->set_error(12);
 				msg.make_second_info(info.str());
 				throw msg;
 			}
-			counter_col=0;
+			Error msg=this->set_error(11);
+			ostringstream info;
+			info<< "No. of columns required :" << this->geo_info.number_x << endl;
+			info<< "No. of columns found    :" << counter_col;
+			msg.make_second_info(info.str());
+			throw msg;
 		}
-
-	}
-	while(ifile->eof()==false);
-
-	if(counter_total!=this->number_polygons){
-		Error msg=this->set_error(13);
-		ostringstream info;
-		info<< "No. of characteristics required :" << this->number_polygons << endl;
-		info<< "No. of characteristics found    :" << counter_total;
-		msg.make_second_info(info.str());
-		throw msg;
-
-	}
-	if(found_flag==false){
-		Error msg=this->set_error(14);
-		throw msg;
+		my_stream >> ws;
+		if(my_stream.eof()==false){
+			Warning msg=this->set_warning(2);
+			ostringstream info;
+			info<< "No. of columns required :" << this->geo_info.number_x << endl;
+			info <<"Error occurs near line  : "<< *line_counter << endl;
+			msg.make_second_info(info.str());
+			msg.output_msg(2);
+		}
+		counter_row++;
 	}
+	return counter_row;
 }
 //Find the key values for the file input
 void Hyd_Gis2Promraster_Converter::find_key_values_file(string myline , int *must_found_counter){
@@ -624,22 +577,38 @@ void Hyd_Gis2Promraster_Converter::find_key_values_file(string myline , int *mus
 }
 //Allocate the secondary information per raster element
 void Hyd_Gis2Promraster_Converter::allocate_secondary_info(void){
+	this->delete_secondary_info();
 	try{
-		this->second_infos=new QList<double>[this->number_polygons];
+		this->element_values=new double[this->number_polygons];
+		this->number_values=new int[this->number_polygons];
 	}
 	catch(bad_alloc &t){
+		if(this->element_values!=NULL){
+			delete []this->element_values;
+			this->element_values=NULL;
+		}
 		Error msg=this->set_error(0);
 		ostringstream info;
 		info << t.what() << endl;
 		msg.make_second_info(info.str());
 		throw msg;
 	}
+	//count the memory
+	Sys_Memory_Count::self()->add_mem((sizeof(double)+sizeof(int))*this->number_polygons, _sys_system_modules::HYD_SYS);
+	for(int i=0; i< this->number_polygons; i++){
+		this->element_values[i]=0.0;
+		this->number_values[i]=0;
+	}
 }
 //Delete the secondary information per raster element 
 void Hyd_Gis2Promraster_Converter::delete_secondary_info(void){
-	if(this->second_infos!=NULL){
-		delete []this->second_infos;
-		this->second_infos=NULL;
+	if(this->element_values!=NULL){
+		delete []this->element_values;
+		this->element_values=NULL;
+		delete []this->number_values;
+		this->number_values=NULL;
+		//count the memory
+		Sys_Memory_Count::self()->minus_mem((sizeof(double)+sizeof(int))*this->number_polygons, _sys_system_modules::HYD_SYS);
 	}
 }
 //Check the geometrical information of the raster
@@ -683,46 +652,6 @@ void Hyd_Gis2Promraster_Converter::check_raster_info(void){
 	}
 
 }
-//Sort raster characteristics from read down-right to up-left
-void Hyd_Gis2Promraster_Converter::sort_raster_characteristics(void){
-	double *buffer=NULL;
-	//allocate the buffer
-	try{
-		buffer=new double[this->number_polygons];
-		//count the memory
-		Sys_Memory_Count::self()->add_mem(sizeof(double)*this->number_polygons, _sys_system_modules::HYD_SYS);
-	}
-	catch(bad_alloc &t){
-		Error msg=this->set_error(15);
-		ostringstream info;
-		info<< "Info bad alloc: " << t.what() << endl;
-		msg.make_second_info(info.str());
-		throw msg;
-	}
-
-	//copy it
-	for(int i=0; i< this->number_polygons; i++){
-		buffer[i]=this->second_infos[i].at(0);
-	}
-
-
-	//sort it
-	int counter=0;
-	for(int i=0; i< this->geo_info.number_y; i++){
-		for(int j=0; j< this->geo_info.number_x; j++){
-			this->second_infos[counter].replace(0,buffer[this->number_polygons-(i+1)*(this->geo_info.number_x)+j]);	
-			counter++;
-		}
-	}
-
-	//delete the buffer
-	if(buffer!=NULL){
-		delete []buffer;
-		//count the memory
-		Sys_Memory_Count::self()->minus_mem(sizeof(double)*this->number_polygons, _sys_system_modules::HYD_SYS);
-		buffer=NULL;
-	}
-}
 //Check raster as identical
 bool Hyd_Gis2Promraster_Converter::check_raster_identical(Hyd_Gis2Promraster_Converter *gis_raster){
 	if(abs(this->geo_info.angle-gis_raster->geo_info.angle)>constant::angle_epsilon){
@@ -750,140 +679,165 @@ bool Hyd_Gis2Promraster_Converter::check_raster_identical(Hyd_Gis2Promraster_Con
 	return true;
 
 }
-//Search for the elemet
-void Hyd_Gis2Promraster_Converter::search_element(Geo_Point *mid, Hyd_Gis2Promraster_Converter *gis_raster, const int id_element){
-
-	bool list_required=false;
-	if(this->outside_list.count()>0){
-		list_required=true;
+//Intercept the characteristics of the GIS-raster with the elements; the characteristics are read and intercepted block by block
+void Hyd_Gis2Promraster_Converter::intercept_gis_characteristics(Hyd_Gis2Promraster_Converter *gis_raster){
+	ifstream ifile;
+	ifile.open(gis_raster->file_name.c_str(), ios_base::in);
+	if(ifile.is_open()==false){
+		Error msg=this->set_error(1);
+		ostringstream info;
+		info << "Filename: " << gis_raster->file_name << endl;
+		msg.make_second_info(info.str());
+		throw msg;
 	}
+	ifile.seekg(gis_raster->charac_position);
+	int line_counter=gis_raster->charac_line;
 
-	//direction search
-	int buff_id=this->last_found_id;
-	//last one
-	this->set_geometrical_raster_polygon(buff_id);
-	if(this->raster_elem.check_point_inside_atboundary(mid)==true){
-			this->second_infos[buff_id].append(gis_raster->second_infos[id_element].last());
-			return;
+	//allocate the buffers for one block of rows
+	int rows_per_block=Hyd_Gis2Promraster_Converter::block_values/gis_raster->geo_info.number_x;
+	if(rows_per_block<1){
+		rows_per_block=1;
 	}
-	//next x
-	_hyd_all_element_direction dir;
-	dir=_hyd_all_element_direction::X_DIRECT;
-	buff_id=this->convert_2neighbouring_elemindex(dir, this->last_found_id);
-	if(buff_id>=0){
-		this->set_geometrical_raster_polygon(buff_id);
-		if(this->raster_elem.check_point_inside_atboundary(mid)==true){
-				this->second_infos[buff_id].append(gis_raster->second_infos[id_element].last());
-				this->last_found_id=buff_id;
-				return;
-		}
+	if(rows_per_block>gis_raster->geo_info.number_y){
+		rows_per_block=gis_raster->geo_info.number_y;
 	}
-	//next xy
-	dir=_hyd_all_element_direction::XY_DIRECT;
-	buff_id=this->convert_2neighbouring_elemindex(dir, this->last_found_id);
-	if(buff_id>=0){
-		this->set_geometrical_raster_polygon(buff_id);
-		if(this->raster_elem.check_point_inside_atboundary(mid)==true){
-				this->second_infos[buff_id].append(gis_raster->second_infos[id_element].last());
-				this->last_found_id=buff_id;
-				return;
-		}
-	}
-	//next y
-	dir=_hyd_all_element_direction::Y_DIRECT;
-	buff_id=this->convert_2neighbouring_elemindex(dir, this->last_found_id);
-	if(buff_id>=0){
-		this->set_geometrical_raster_polygon(buff_id);
-		if(this->raster_elem.check_point_inside_atboundary(mid)==true){
-				this->second_infos[buff_id].append(gis_raster->second_infos[id_element].last());
-				this->last_found_id=buff_id;
-				return;
-		}
+	const int number_block=rows_per_block*gis_raster->geo_info.number_x;
+	double *values=NULL;
+	int *index=NULL;
+	try{
+		values=new double[number_block];
+		index=new int[number_block];
 	}
-	//next y-x
-	dir=_hyd_all_element_direction::YMINUS_X_DIRECT;
-	buff_id=this->convert_2neighbouring_elemindex(dir, this->last_found_id);
-	if(buff_id>=0){
-		this->set_geometrical_raster_polygon(buff_id);
-		if(this->raster_elem.check_point_inside_atboundary(mid)==true){
-				this->second_infos[buff_id].append(gis_raster->second_infos[id_element].last());
-				this->last_found_id=buff_id;
-				return;
+	catch(bad_alloc &t){
+		if(values!=NULL){
+			delete []values;
 		}
+		ifile.close();
+		Error msg=this->set_error(15);
+		ostringstream info;
+		info<< "Info bad alloc: " << t.what() << endl;
+		msg.make_second_info(info.str());
+		throw msg;
 	}
-	//next -x
-	dir=_hyd_all_element_direction::MINUS_X_DIRECT;
-	buff_id=this->convert_2neighbouring_elemindex(dir, this->last_found_id);
-	if(buff_id>=0){
-		this->set_geometrical_raster_polygon(buff_id);
-		if(this->raster_elem.check_point_inside_atboundary(mid)==true){
-				this->second_infos[buff_id].append(gis_raster->second_infos[id_element].last());
-				this->last_found_id=buff_id;
-				return;
+	//count the memory
+	Sys_Memory_Count::self()->add_mem((sizeof(double)+sizeof(int))*number_block, _sys_system_modules::HYD_SYS);
+
+	ostringstream cout;
+	int first_row=0;
+	int number_rows=0;
+	bool end_found=false;
+	try{
+		while(first_row<gis_raster->geo_info.number_y && end_found==false){
+			Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
+			number_rows=min(rows_per_block, gis_raster->geo_info.number_y-first_row);
+			number_rows=gis_raster->read_raster_elem_rows(&ifile, &line_counter, values, number_rows, &end_found);
+			if(number_rows==0){
+				break;
+			}
+			cout << "Interception for rows (GIS-raster) "<< first_row <<" to " << first_row+number_rows <<" ("<<gis_raster->geo_info.number_y<<")..."<< endl;
+			Sys_Common_Output::output_hyd->output_txt(&cout);
+			this->intercept_gis_block(gis_raster, values, index, first_row, number_rows);
+			first_row=first_row+number_rows;
 		}
-	}
-	//next -x-y
-	dir=_hyd_all_element_direction::MINUS_X_MINUS_Y_DIRECT;
-	buff_id=this->convert_2neighbouring_elemindex(dir, this->last_found_id);
-	if(buff_id>=0){
-		this->set_geometrical_raster_polygon(buff_id);
-		if(this->raster_elem.check_point_inside_atboundary(mid)==true){
-				this->second_infos[buff_id].append(gis_raster->second_infos[id_element].last());
-				this->last_found_id=buff_id;
-				return;
+
+		if(first_row!=gis_raster->geo_info.number_y){
+			Error msg=this->set_error(13);
+			ostringstream info;
+			info<< "No. of characteristics required :" << gis_raster->number_polygons << endl;
+			info<< "No. of characteristics found    :" << first_row*gis_raster->geo_info.number_x;
+			msg.make_second_info(info.str());
+			throw msg;
 		}
-	}
-	//next -y
-	dir=_hyd_all_element_direction::MINUS_Y_DIRECT;
-	buff_id=this->convert_2neighbouring_elemindex(dir, this->last_found_id);
-	if(buff_id>=0){
-		this->set_geometrical_raster_polygon(buff_id);
-		if(this->raster_elem.check_point_inside_atboundary(mid)==true){
-				this->second_infos[buff_id].append(gis_raster->second_infos[id_element].last());
-				this->last_found_id=buff_id;
-				return;
+		//check the end of the characteristics
+		if(end_found==false){
+			gis_raster->read_raster_elem_rows(&ifile, &line_counter, values, 0, &end_found);
+			if(end_found==false){
+				Error msg=this->set_error(14);
+				throw msg;
+			}
 		}
 	}
-	//next x-y
-	dir=_hyd_all_element_direction::MINUS_Y_X_DIRECT;
-	buff_id=this->convert_2neighbouring_elemindex(dir, this->last_found_id);
-	if(buff_id>=0){
-		this->set_geometrical_raster_polygon(buff_id);
-		if(this->raster_elem.check_point_inside_atboundary(mid)==true){
-				this->second_infos[buff_id].append(gis_raster->second_infos[id_element].last());
-				this->last_found_id=buff_id;
-				return;
-		}
+	catch(Error msg){
+		delete []values;
+		delete []index;
+		Sys_Memory_Count::self()->minus_mem((sizeof(double)+sizeof(int))*number_block, _sys_system_modules::HYD_SYS);
+		ifile.close();
+		ostringstream info;
+		info << "Error occurs near line: "<< line_counter << endl;
+		info << "Filename              : "<< gis_raster->file_name << endl;
+		info<< "GIS-raster expected"<<endl;
+		msg.make_second_info(info.str());
+		throw msg;
 	}
-	
-	
-
 
-	//normal search
-	int start=this->last_found_id;
-	if(start!=0){
-		start=start-1;
-	}
-	int counter=0;
-	for(int i=start; i< this->number_polygons; i++){
-		if(list_required==true && this->outside_list.at(i)==true){
+	delete []values;
+	delete []index;
+	Sys_Memory_Count::self()->minus_mem((sizeof(double)+sizeof(int))*number_block, _sys_system_modules::HYD_SYS);
+	ifile.close();
+}
+//Intercept a block of rows of the GIS-raster with the elements (values: number of rows * number x of the GIS-raster, in order of the file)
+void Hyd_Gis2Promraster_Converter::intercept_gis_block(Hyd_Gis2Promraster_Converter *gis_raster, const double *values, int *index, const int first_row, const int number_rows){
+	/**The element, where the mid-point of a GIS-element is inside, is calculated directly via the local coordinates
+	of this raster; it is independent per GIS-element and is done in parallel. The values are summed up afterwards.
+	*/
+	const int number_x=gis_raster->geo_info.number_x;
+	const int number=number_rows*number_x;
+	const double no_info=gis_raster->noinfo_value;
+	const double rad_gis=_Geo_Geometrie::grad_to_rad(gis_raster->geo_info.angle);
+	const double cos_gis=cos(rad_gis);
+	const double sin_gis=sin(rad_gis);
+	const double rad_prom=_Geo_Geometrie::grad_to_rad(this->geo_info.angle);
+	const double cos_prom=cos(rad_prom);
+	const double sin_prom=sin(rad_prom);
+	const double length_x=this->geo_info.width_x*(double)this->geo_info.number_x;
+	const double length_y=this->geo_info.width_y*(double)this->geo_info.number_y;
+	//points at the boundary of the raster are also taken
+	const double margin=10.0*constant::meter_epsilon;
+
+	#pragma omp parallel for schedule(static) if(number>=10000)
+	for(int k=0; k< number; k++){
+		index[k]=-1;
+		if(abs(values[k]-no_info)<=constant::zero_epsilon){
 			continue;
 		}
-
-		this->set_geometrical_raster_polygon(i);
-		counter++;
-		if(this->raster_elem.check_point_inside_atboundary(mid)==true){
-			this->second_infos[i].append(gis_raster->second_infos[id_element].last());
-			this->last_found_id=i;
-			break;
+		//the rows in file are ordered from top to bottom
+		int index_y=gis_raster->geo_info.number_y-1-(first_row+k/number_x);
+		int index_x=k%number_x;
+		//mid-point in global coordinates (see Geo_Point::transform_coordinate_system)
+		double x_local=((double)index_x+0.5)*gis_raster->geo_info.width_x;
+		double y_local=((double)index_y+0.5)*gis_raster->geo_info.width_y;
+		double x_global=gis_raster->geo_info.origin_global_x+x_local*cos_gis+y_local*sin_gis;
+		double y_global=gis_raster->geo_info.origin_global_y-x_local*sin_gis+y_local*cos_gis;
+		//local coordinates of this raster (see Hyd_Floodplain_Raster::transform_global2local)
+		double delta_x=x_global-this->geo_info.origin_global_x;
+		double delta_y=y_global-this->geo_info.origin_global_y;
+		x_local=delta_x*cos_prom-delta_y*sin_prom;
+		y_local=delta_x*sin_prom+delta_y*cos_prom;
+		if(x_local<-margin || y_local<-margin || x_local>length_x+margin || y_local>length_y+margin){
+			continue;
 		}
-		if(i==this->number_polygons-1 && counter<this->number_polygons){
-			start=0;
-			i=0;
+		int elem_x=(int)floor(x_local/this->geo_info.width_x);
+		int elem_y=(int)floor(y_local/this->geo_info.width_y);
+		if(elem_x<0){
+			elem_x=0;
 		}
-		if(counter==this->number_polygons){
-			this->last_found_id=0;
-			break;
+		else if(elem_x>=this->geo_info.number_x){
+			elem_x=this->geo_info.number_x-1;
+		}
+		if(elem_y<0){
+			elem_y=0;
+		}
+		else if(elem_y>=this->geo_info.number_y){
+			elem_y=this->geo_info.number_y-1;
+		}
+		index[k]=elem_y*this->geo_info.number_x+elem_x;
+	}
+
+	//sum up the values per element
+	for(int k=0; k< number; k++){
+		if(index[k]>=0){
+			this->element_values[index[k]]=this->element_values[index[k]]+values[k];
+			this->number_values[index[k]]++;
 		}
 	}
 }
@@ -893,44 +847,18 @@ void Hyd_Gis2Promraster_Converter::calculate_value_element(const double no_info)
 	cout << "Calculate the values of the secondary information per element of the ProMaIdes HYD-raster..."<<endl;
 	Sys_Common_Output::output_hyd->output_txt(&cout);
 
-
-	double sum=0.0;
 	for(int i=0; i< this->number_polygons; i++){
-		if(this->second_infos[i].count()==0){
-			this->second_infos[i].append(no_info);
+		if(this->number_values[i]==0){
+			this->element_values[i]=no_info;
 		}
 		else{
-			sum=0.0;
-			for(int j=0; j< this->second_infos[i].count(); j++){
-				sum=sum+this->second_infos[i].at(j);
-			}
-			sum=sum/(double)this->second_infos[i].count();
-			this->second_infos[i].append(sum);
+			this->element_values[i]=this->element_values[i]/(double)this->number_values[i];
 		}
 	}
 
 	cout << "Calculation of the values of the secondary information per element of the ProMaIdes HYD-raster is finished!"<<endl;
 	Sys_Common_Output::output_hyd->output_txt(&cout);
 }
-//Set if elements are completely outside the raster
-void Hyd_Gis2Promraster_Converter::set_completly_ouside_elements(Hyd_Floodplain_Polygon *gis_bound){
-
-	ostringstream cout;
-	cout << "Set the completly ouside-falgs for each element of the ProMaIdes HYD-raster..."<<endl;
-	Sys_Common_Output::output_hyd->output_txt(&cout);
-
-	Geo_Point mid;
-	for(int i=0; i<this->number_polygons; i++){
-		this->set_geometrical_raster_polygon(i);
-		this->raster_elem.set_mid_point(&mid);
-		if(gis_bound->check_point_outside(&mid)==true){
-			this->outside_list.replace(i,true);
-		}
-	}
-	cout << "The setting of the completly ouside-falgs for each element of the ProMaIdes HYD-raster is finished!"<<endl;
-	Sys_Common_Output::output_hyd->output_txt(&cout);
-
-}
 //Set warning(s)
 Warning Hyd_Gis2Promraster_Converter::set_warning(const int warn_type){
 		string place="Hyd_Gis2Promraster_Converter::";
@@ -956,8 +884,8 @@ Warning Hyd_Gis2Promraster_Converter::set_warning(const int warn_type){
 			type=1;
 			break;
 		case 2://more columns to read in than required
-			place.append("read_raster_elem_characteristic(ifstream *ifile, int *line_counter)");
-			reason="There are not enough columns in file for the input of the element charactersistics";
+			place.append("read_raster_elem_rows(ifstream *ifile, int *line_counter, double *values, const int number_rows, bool *end_found)");
+			reason="There are more columns in file than required for the input of the element charactersistics";
 			help="Check the raster element information in file";
 			reaction="The surplus columns are ignored";
 			type=1;
@@ -1056,37 +984,37 @@ Error Hyd_Gis2Promraster_Converter::set_error(const int err_type){
 			type=1;
 			break;
 		case 10://do not find the begin of the characteristics of the raster elements in file
-			place.append("read_raster_elem_characteristic(ifstream *ifile, int *line_counter)");
+			place.append("find_raster_elem_characteristic(ifstream *ifile, int *line_counter)");
 			reason="Can not find the begin of the characterstic information of the raster elements in file";
 			help="The raster information has to start with !$BEGIN_CHARAC";
 			type=1;
 			break;
 		case 11://not enough columns to read in the characteristis
-			place.append("read_raster_elem_characteristic(ifstream *ifile, int *line_counter)");
+			place.append("read_raster_elem_rows(ifstream *ifile, int *line_counter, double *values, const int number_rows, bool *end_found)");
 			reason="There are not enough columns in file for the input of the element characteristics";
 			help="Check the raster element information in file";
 			type=1;
 			break;
 		case 12://wrong input
-			place.append("read_raster_elem_characteristic(ifstream *ifile, int *line_counter)");
+			place.append("read_raster_elem_rows(ifstream *ifile, int *line_counter, double *values, const int number_rows, bool *end_found)");
 			reason="There is a problem with the input; wrong sign is read in";
 			help="Check the raster element characteristics in file";
 			type=1;
 			break;
 		case 13://not enough values to read in the characteristis
-			place.append("read_raster_elem_characteristic(ifstream *ifile, int *line_counter)");
+			place.append("intercept_gis_characteristics(Hyd_Gis2Promraster_Converter *gis_raster)");
 			reason="The number of given characteristics in file do not correspond to the required number";
 			help="Check the raster element characteristics in file";
 			type=1;
 			break;
 		case 14://do not find the end of the characteristics of the raster elements in file
-			place.append("read_raster_elem_characteristic(ifstream *ifile, int *line_counter)");
+			place.append("intercept_gis_characteristics(Hyd_Gis2Promraster_Converter *gis_raster)");
 			reason="Can not find the end of the characterstic information of the raster elements in file";
 			help="The raster information has to start with !$END_CHARAC";
 			type=1;
 			break;
 		case 15://bad alloc
-			place.append("sort_raster_characteristics(void)");
+			place.append("intercept_gis_characteristics(Hyd_Gis2Promraster_Converter *gis_raster)");
 			reason="Can not allocate the memory";
 			help="Check the memory";
 			type=10;
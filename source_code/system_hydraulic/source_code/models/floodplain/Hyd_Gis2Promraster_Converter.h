@@ -18,6 +18,9 @@
 /**
 The ProMaIDes-raster can be rotated, the element can be rectangular. The output of ArcGis is the main source
 for the conversion.
+The characteristics of the GIS-raster are not kept in memory: they are read in blocks of rows and intercepted
+block by block. The element of the ProMaIDes-raster per mid-point of a GIS-element is calculated directly via the
+local raster coordinates (in parallel, if OpenMP is available).
 
 \see Hyd_Floodplain_Raster
 */
@@ -47,8 +50,15 @@ private:
 
 
 	//members
-	///List of the secondary information per raster element
-	QList<double> *second_infos;
+	///Number of values of the GIS-raster, which are read and intercepted as one block
+	static const int block_values=1048576;
+	///Number of lines, which are written as one block to the output file
+	static const int block_lines=10000;
+
+	///Secondary information per raster element (sum of the intercepted values; after the calculation the mean value)
+	double *element_values;
+	///Number of the intercepted values per raster element
+	int *number_values;
 
 	///Type of the raster
 	bool prom_raster;
@@ -59,18 +69,19 @@ private:
 	///File name
 	string file_name;
 
-	//Last found index of the element
-	int last_found_id;
-
-	///List where a flag is stored, if a element is completly outside a given raster
-	QList<bool> outside_list;
+	///Position of the characteristics of the elements in the file of the GIS-raster
+	streampos charac_position;
+	///Line number of the characteristics of the elements in the file of the GIS-raster
+	int charac_line;
 
 
 	//Method
 	///Read the raster information per file
 	void read_raster_infos(ifstream *ifile, int *line_counter);
-	///Read the charactersistics of the elements per file
-	void read_raster_elem_characteristic(ifstream *ifile, int *line_counter);
+	///Search the begin of the charactersistics of the elements per file
+	void find_raster_elem_characteristic(ifstream *ifile, int *line_counter);
+	///Read a block of rows of the charactersistics of the elements per file (values: number of rows * number x, in order of the file); the number of read rows is returned
+	int read_raster_elem_rows(ifstream *ifile, int *line_counter, double *values, const int number_rows, bool *end_found);
 	///Find the key values for the file input
 	void find_key_values_file(string myline , int *must_found_counter);
 
@@ -82,21 +93,18 @@ private:
 	///Check the geometrical information of the raster
 	void check_raster_info(void);
 
-	///Sort raster characteristics from read down-right to up-left
-	void sort_raster_characteristics(void);
 	///Check raster as identical
 	bool check_raster_identical(Hyd_Gis2Promraster_Converter *gis_raster);
 
-	///Search for the elemet
-	void search_element(Geo_Point *mid, Hyd_Gis2Promraster_Converter *gis_raster, const int id_element); 
+	///Intercept the characteristics of the GIS-raster with the elements; the characteristics are read and intercepted block by block
+	void intercept_gis_characteristics(Hyd_Gis2Promraster_Converter *gis_raster);
+	///Intercept a block of rows of the GIS-raster with the elements (values: number of rows * number x of the GIS-raster, in order of the file)
+	void intercept_gis_block(Hyd_Gis2Promraster_Converter *gis_raster, const double *values, int *index, const int first_row, const int number_rows);
 
 
 	///Calculate the value for each element
 	void calculate_value_element(const double no_info);
 
-	///Set if elements are completely outside the raster
-	void set_completly_ouside_elements(Hyd_Floodplain_Polygon *gis_bound);
-
 	///Set warning(s)
 	Warning set_warning(const int warn_type);
 	///Set error(s)
@@ -66,9 +66,10 @@ Hyd_Model_Floodplain::Hyd_Model_Floodplain(void){
 	this->old_discharge_2_error=0.0;
     //default 4
     this->ilu_number=4;
+	this->binary_frame=NULL;
 
 	//count the memory
-	Sys_Memory_Count::self()->add_mem(sizeof(Hyd_Model_Floodplain)-sizeof(Hyd_Floodplain_Raster)-sizeof(Hyd_Param_FP), _sys_system_modules::HYD_SYS);
+	Sys_Memory_Count::self()->add_mem(sizeof(Hyd_Model_Floodplain)-sizeof(Hyd_Floodplain_Raster)-sizeof(Hyd_Param_FP)-sizeof(Hyd_Floodplain_Result_Store), _sys_system_modules::HYD_SYS);
 }
 //destructor
 Hyd_Model_Floodplain::~Hyd_Model_Floodplain(void){
@@ -79,8 +80,14 @@ Hyd_Model_Floodplain::~Hyd_Model_Floodplain(void){
     this->delete_opt_data_coup();
 	this->delete_dikeline_polysegments();
 	this->delete_noflow_polygons();
+	try{
+		this->close_binary_output();
+	}
+	catch(Error msg){
+		msg.output_msg(2);
+	}
 	//count the memory
-	Sys_Memory_Count::self()->minus_mem(sizeof(Hyd_Model_Floodplain)-sizeof(Hyd_Floodplain_Raster)-sizeof(Hyd_Param_FP), _sys_system_modules::HYD_SYS);
+	Sys_Memory_Count::self()->minus_mem(sizeof(Hyd_Model_Floodplain)-sizeof(Hyd_Floodplain_Raster)-sizeof(Hyd_Param_FP)-sizeof(Hyd_Floodplain_Result_Store), _sys_system_modules::HYD_SYS);
 }
 //_________________________________
 //public
@@ -1008,6 +1015,7 @@ void Hyd_Model_Floodplain::reset_model(Hyd_Param_Global *global_params){
 	this->error_zero_outflow_volume=0.0;
 	this->warn_counter=0;
 	this->tol_reduce_counter=0;
+	this->close_binary_output();
 	for(int i=0; i< this->NEQ; i++){
 		this->floodplain_elems[i].element_type->reset_hydrobalance_maxvalues();
 	}
@@ -1050,11 +1058,14 @@ void Hyd_Model_Floodplain::init_solver(Hyd_Param_Global *global_params){
 //Reinitialize the solver
 void Hyd_Model_Floodplain::reinit_solver(Hyd_Param_Global *global_params){
 
-	//test opti
-
-	this->allocate_opt_data();
+	//the optimized data are kept, if they are already allocated; the preconditioner of the solver refers to them
+	if(this->opt_h==NULL){
+		this->allocate_opt_data();
+	}
     this->init_opt_data();
-    this->allocate_opt_data_reduced();
+	if(this->id_y==NULL){
+		this->allocate_opt_data_reduced();
+	}
     this->init_reduced_id();
     //this->NEQ_real=this->NEQ;
     _Hyd_Model::reinit_solver(global_params);
@@ -2315,26 +2326,76 @@ void Hyd_Model_Floodplain::output_result2paraview(const double timepoint, const
 	output.close();
 	
 }
+//Output the result members per timestep to the chunked binary result store
+void Hyd_Model_Floodplain::output_result2binary(const double timepoint){
+/**One frame per output time is written with the series h, s, v_x, v_y, h_max, v_total_max and the wet duration.
+The values are taken from the elements, thus the store is filled in the same way by the cpu- and the gpu-solver.
+*/
+	const int number_series=Hyd_Model_Floodplain::number_binary_series;
+	if(this->binary_store.get_store_is_open()==false){
+		string filename=this->Param_FP.get_filename_result(hyd_label::binary);
+		if(filename==label::not_set){
+			return;
+		}
+		filename += hyd_label::bin;
+		try{
+			this->binary_frame=new double[number_series*this->NEQ];
+			Sys_Memory_Count::self()->add_mem(sizeof(double)*number_series*this->NEQ, _sys_system_modules::HYD_SYS);
+		}
+		catch(bad_alloc &t){
+			Error msg=this->set_error(28);
+			ostringstream info;
+			info<< "Info bad alloc: " << t.what() << endl;
+			msg.make_second_info(info.str());
+			throw msg;
+		}
+		try{
+			this->binary_store.open_store2write(filename, this->Param_FP.get_geometrical_info(), number_series);
+		}
+		catch(Error msg){
+			this->close_binary_output();
+			throw msg;
+		}
+	}
+	_Hyd_Element_Floodplain_Type *elem=NULL;
+	for(int i=0; i<this->NEQ; i++){
+		elem=this->floodplain_elems[i].element_type;
+		this->binary_frame[i]=elem->get_h_value();
+		this->binary_frame[this->NEQ+i]=elem->get_s_value();
+		this->binary_frame[2*this->NEQ+i]=elem->get_flowvelocity_vx_out();
+		this->binary_frame[3*this->NEQ+i]=elem->get_flowvelocity_vy_out();
+		this->binary_frame[4*this->NEQ+i]=elem->get_max_h_value().maximum;
+		this->binary_frame[5*this->NEQ+i]=elem->get_max_v_total().maximum;
+		this->binary_frame[6*this->NEQ+i]=elem->get_wet_duration();
+	}
+	this->binary_store.write_frame(timepoint, this->binary_frame);
+}
+//Close the chunked binary result store; the last frame contains the final maximum values and the wet duration
+void Hyd_Model_Floodplain::close_binary_output(void){
+	if(this->binary_frame!=NULL){
+		delete []this->binary_frame;
+		this->binary_frame=NULL;
+		Sys_Memory_Count::self()->minus_mem(sizeof(double)*Hyd_Model_Floodplain::number_binary_series*this->NEQ, _sys_system_modules::HYD_SYS);
+	}
+	this->binary_store.close_store();
+}
 //Output the result members per timestep to database
 void Hyd_Model_Floodplain::output_result2database(QSqlDatabase *ptr_database, const string break_sz, const double timepoint, const int timestep_number, const string time) {
 
 
-	//evaluate the global identifier
-	int id_glob = Hyd_Element_Floodplain::get_max_glob_id_erg_instat_table(ptr_database) + 1;
-
-	//Set the query
-	QSqlQuery query_buff(*ptr_database);
-
-
-
-	//get the header for the query
-	string query_header;
-	query_header = Hyd_Element_Floodplain::get_insert_header_erg_instat_data_table(ptr_database);
+	//reserve the global identifiers for the elements, which are output
+	int number = 0;
+	for (int i = 0; i < this->NEQ; i++) {
+		if (this->floodplain_elems[i].get_instat_result_required(i) == true) {
+			number++;
+		}
+	}
+	int id_glob = Hyd_Element_Floodplain::reserve_glob_id_erg_instat_table(ptr_database, number);
 
-	ostringstream query_data;
-	ostringstream query_total;
-	int counter = 0;
-	string buffer_data;
+	//the rows are sent in packages by the bulk writer
+	Sys_Database_Bulk_Writer writer(ptr_database);
+	Hyd_Element_Floodplain::set_bulk_writer_erg_instat_table(&writer, ptr_database);
+	double values[_Hyd_Element_Floodplain_Type::number_instat_values];
 
 	 //time string
 	//string time;
@@ -2354,59 +2415,73 @@ void Hyd_Model_Floodplain::output_result2database(QSqlDatabase *ptr_database, co
 	for (int i = 0; i < this->NEQ; i++) {
 
 
-		buffer_data = this->floodplain_elems[i].get_datastring_erg_instat_2database(i, this->Param_FP.get_floodplain_number(), id_glob, break_sz, time, this->Param_FP.get_geometrical_info());
-		if (buffer_data != label::not_set) {
-			query_data << buffer_data << " ,";
+		if (this->floodplain_elems[i].get_instat_result_values(i, values) == true) {
+			bool ok = this->floodplain_elems[i].add_erg_instat2bulk_writer(&writer, this->Param_FP.get_floodplain_number(), id_glob, break_sz, time, values);
 			//count the global index
 			id_glob++;
-			counter++;
-		}
-
-		//send packages of 100
-		if (counter == 100) {
-			query_total << query_header << query_data.str();
-			//delete last komma
-			string buff = query_total.str();
-			buff.erase(buff.length() - 1);
-			Data_Base::database_request(&query_buff, buff, ptr_database);
-
-			counter = 0;
-			if (query_buff.lastError().isValid()) {
+			if (ok == false) {
 				Warning msg = this->set_warning(3);
 				ostringstream info;
 				info << "Table Name                : " << Hyd_Element_Floodplain::erg_instat_table->get_table_name() << endl;
-				info << "Table error info          : " << query_buff.lastError().text().toStdString() << endl;
-				info << "Data string               : " << query_data.str() << endl;
+				info << "Table error info          : " << writer.get_last_error() << endl;
 				msg.make_second_info(info.str());
 				msg.output_msg(2);
 			}
-			//delete them
-			query_total.str("");
-			query_data.str("");
-			query_buff.clear();
 		}
 	}
 	//send the rest
-	if (counter != 0) {
-		query_total << query_header << query_data.str();
-		//delete last komma
-		string buff = query_total.str();
-		buff.erase(buff.length() - 1);
-		Data_Base::database_request(&query_buff, buff, ptr_database);
-		//delete them
-		query_total.str("");
-		query_data.str("");
-		counter = 0;
-		if (query_buff.lastError().isValid()) {
-			Warning msg = this->set_warning(4);
+	if (writer.finish() == false) {
+		Warning msg = this->set_warning(4);
+		ostringstream info;
+		info << "Table Name                : " << Hyd_Element_Floodplain::erg_instat_table->get_table_name() << endl;
+		info << "Table error info          : " << writer.get_last_error() << endl;
+		msg.make_second_info(info.str());
+		msg.output_msg(2);
+	}
+
+}
+//Copy the instationary result values of the elements, which are output to database, to the given buffers (index: number of elements; values: number of elements*_Hyd_Element_Floodplain_Type::number_instat_values); the number of copied elements is returned
+int Hyd_Model_Floodplain::copy_instat_results2snapshot(int *index, double *values) {
+	int number = 0;
+	for (int i = 0; i < this->NEQ; i++) {
+		if (this->floodplain_elems[i].get_instat_result_values(i, &values[number*_Hyd_Element_Floodplain_Type::number_instat_values]) == true) {
+			index[number] = i;
+			number++;
+		}
+	}
+	return number;
+}
+//Output the instationary result values of a snapshot (see copy_instat_results2snapshot()) to database; just the fixed members of the elements are used, thus it can run parallel to the calculation
+void Hyd_Model_Floodplain::output_snapshot2database(QSqlDatabase *ptr_database, const string break_sz, const string time, const int number, const int *index, const double *values) {
+	//reserve the global identifiers
+	int id_glob = Hyd_Element_Floodplain::reserve_glob_id_erg_instat_table(ptr_database, number);
+
+	//the rows are sent in packages by the bulk writer
+	Sys_Database_Bulk_Writer writer(ptr_database);
+	Hyd_Element_Floodplain::set_bulk_writer_erg_instat_table(&writer, ptr_database);
+
+	for (int i = 0; i < number; i++) {
+		bool ok = this->floodplain_elems[index[i]].add_erg_instat2bulk_writer(&writer, this->Param_FP.get_floodplain_number(), id_glob, break_sz, time, &values[i*_Hyd_Element_Floodplain_Type::number_instat_values]);
+		//count the global index
+		id_glob++;
+		if (ok == false) {
+			Warning msg = this->set_warning(7);
 			ostringstream info;
 			info << "Table Name                : " << Hyd_Element_Floodplain::erg_instat_table->get_table_name() << endl;
-			info << "Table error info          : " << query_buff.lastError().text().toStdString() << endl;
+			info << "Table error info          : " << writer.get_last_error() << endl;
 			msg.make_second_info(info.str());
 			msg.output_msg(2);
 		}
 	}
-
+	//send the rest
+	if (writer.finish() == false) {
+		Warning msg = this->set_warning(7);
+		ostringstream info;
+		info << "Table Name                : " << Hyd_Element_Floodplain::erg_instat_table->get_table_name() << endl;
+		info << "Table error info          : " << writer.get_last_error() << endl;
+		msg.make_second_info(info.str());
+		msg.output_msg(2);
+	}
 }
 //output solver errors
 void Hyd_Model_Floodplain::output_solver_errors(const double time_point, const int step_counter, const string timestring, const string realtime, const double diff_time, const int total_internal, const int internal_steps){
@@ -3483,24 +3558,16 @@ void Hyd_Model_Floodplain::output_result_max2database(QSqlDatabase *ptr_database
 	cout <<"Transfer hydraulic results of the Floodplainmodel " << this->Param_FP.FPNumber <<" to database ..."<<endl;
 	Sys_Common_Output::output_hyd->output_txt(&cout);
 
-	//evaluate the global identifier
-	int id_glob=Hyd_Element_Floodplain::get_max_glob_id_erg_table(ptr_database)+1;
-
-	//Set the query
-	QSqlQuery query_buff(*ptr_database);
+	//reserve the global identifiers; not required ones stay unused
+	int id_glob=Hyd_Element_Floodplain::reserve_glob_id_erg_table(ptr_database, this->NEQ);
 
 	//for(int i=0; i<this->NEQ;i++){
 	//	this->floodplain_elems[i].output_maximum_calculated_values(&id_glob, &model, ptr_database, this->Param_FP.FPNumber, this->Param_FP.get_geometrical_info(), break_sz);
 	//}
 
-	//get the header for the query
-	string query_header;
-	query_header=Hyd_Element_Floodplain::get_insert_header_erg_data_table(ptr_database);
-
-	ostringstream query_data;
-	ostringstream query_total;
-	int counter=0;
-	string buffer_data;
+	//the rows are sent in packages by the bulk writer
+	Sys_Database_Bulk_Writer writer(ptr_database);
+	Hyd_Element_Floodplain::set_bulk_writer_erg_table(&writer, ptr_database);
 	bool must_output2=false;
 	for(int i=0; i<this->NEQ; i++){
 		if(i==this->NEQ-1 && must_output==true && *was_output==false){
@@ -3512,58 +3579,29 @@ void Hyd_Model_Floodplain::output_result_max2database(QSqlDatabase *ptr_database
 			Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
 		}
 
-		buffer_data = this->floodplain_elems[i].get_datastring_erg2database(id_glob, this->Param_FP.get_floodplain_number(), this->Param_FP.get_geometrical_info(), break_sz, must_output2);
-		if(buffer_data!=label::not_set){
-			query_data <<  buffer_data << " ,";
+		if(this->floodplain_elems[i].get_max_result_required(must_output2)==true){
+			bool ok=this->floodplain_elems[i].add_erg2bulk_writer(&writer, id_glob, this->Param_FP.get_floodplain_number(), this->Param_FP.get_geometrical_info(), break_sz);
 			//count the global index
 			id_glob++;
-			counter++;
 			*was_output=true;
-		}
-
-		//send packages of 100
-		if(counter==100){
-			query_total<< query_header << query_data.str();
-			//delete last komma
-			string buff=query_total.str();
-			buff.erase(buff.length()-1);
-			Data_Base::database_request(&query_buff, buff, ptr_database);
-
-			counter=0;
-			if(query_buff.lastError().isValid()){
+			if(ok==false){
 				Warning msg=this->set_warning(3);
 				ostringstream info;
 				info << "Table Name                : " << Hyd_Element_Floodplain::erg_table->get_table_name() << endl;
-				info << "Table error info          : " << query_buff.lastError().text().toStdString() << endl;
-				info << "Data string               : " << query_data.str()<<endl;
+				info << "Table error info          : " << writer.get_last_error() << endl;
 				msg.make_second_info(info.str());
 				msg.output_msg(2);
 			}
-			//delete them
-			query_total.str("");
-			query_data.str("");
-			query_buff.clear();
 		}
 	}
 	//send the rest
-	if(counter!=0){
-		query_total<< query_header << query_data.str();
-		//delete last komma
-		string buff=query_total.str();
-		buff.erase(buff.length()-1);
-		Data_Base::database_request(&query_buff, buff, ptr_database);
-		//delete them
-		query_total.str("");
-		query_data.str("");
-		counter=0;
-		if(query_buff.lastError().isValid()){
-			Warning msg=this->set_warning(3);
-			ostringstream info;
-			info << "Table Name                : " << Hyd_Element_Floodplain::erg_table->get_table_name() << endl;
-			info << "Table error info          : " << query_buff.lastError().text().toStdString() << endl;
-			msg.make_second_info(info.str());
-			msg.output_msg(2);
-		}
+	if(writer.finish()==false){
+		Warning msg=this->set_warning(3);
+		ostringstream info;
+		info << "Table Name                : " << Hyd_Element_Floodplain::erg_table->get_table_name() << endl;
+		info << "Table error info          : " << writer.get_last_error() << endl;
+		msg.make_second_info(info.str());
+		msg.output_msg(2);
 	}
 }
 //Calculated the area of the floodplain, which was wetted during simulation
@@ -4419,17 +4457,11 @@ void Hyd_Model_Floodplain::transfer_element_members2database(QSqlDatabase *ptr_d
 
 	int id_glob=Hyd_Element_Floodplain::elem_table->maximum_int_of_column(Hyd_Element_Floodplain::elem_table->get_column_name(hyd_label::elemdata_glob_id),ptr_database)+1;
 
-	//Set the query
-	QSqlQuery query_buff(*ptr_database);
-
-	//get the header for the query
-	string query_header;
-	query_header=Hyd_Element_Floodplain::get_insert_header_data_table(ptr_database);
-
-	ostringstream query_data;
-	ostringstream query_total;
-	int counter=0;
-	string buffer_data;
+	//the rows are sent in packages by the bulk writer; the base data of the model is imported completely in one transaction
+	//or not at all: a failed package is thrown and the transaction is rolled back by the writer
+	Sys_Database_Bulk_Writer writer(ptr_database);
+	Hyd_Element_Floodplain::set_bulk_writer_data_table(&writer, ptr_database);
+	writer.set_rows_per_transaction(this->NEQ+1);
 
 	for(int i=0; i<this->NEQ; i++){
 		if(i%10000==0 && i>0){
@@ -4438,57 +4470,28 @@ void Hyd_Model_Floodplain::transfer_element_members2database(QSqlDatabase *ptr_d
 			Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
 		}
 
-		buffer_data = this->floodplain_elems[i].get_datastring2database(ptr_database, id_glob, this->Param_FP.get_floodplain_number(), this->Param_FP.get_geometrical_info());
-
-		query_data <<  buffer_data << " ,";
+		bool ok=this->floodplain_elems[i].add_data2bulk_writer(&writer, id_glob, this->Param_FP.get_floodplain_number(), this->Param_FP.get_geometrical_info());
 		//count the global index
 		id_glob++;
-		counter++;
 
-		//send packages of 100
-		if(counter==100){
-			query_total<< query_header << query_data.str();
-			//delete last komma
-			string buff=query_total.str();
-			buff.erase(buff.length()-1);
-			Data_Base::database_request(&query_buff, buff, ptr_database);
-
-			counter=0;
-			if(query_buff.lastError().isValid()){
-				Warning msg=this->set_warning(2);
-				ostringstream info;
-				info << "Table Name                : " << Hyd_Element_Floodplain::elem_table->get_table_name() << endl;
-				info << "Table error info          : " << query_buff.lastError().text().toStdString() << endl;
-				info << "Data string               : " << query_data.str()<<endl;
-				msg.make_second_info(info.str());
-				msg.output_msg(2);
-			}
-			//delete them
-			query_total.str("");
-			query_data.str("");
-			query_buff.clear();
-		}
-	}
-	//send the rest
-	if(counter!=0){
-		query_total<< query_header << query_data.str();
-		//delete last komma
-		string buff=query_total.str();
-		buff.erase(buff.length()-1);
-		Data_Base::database_request(&query_buff, buff, ptr_database);
-		//delete them
-		query_total.str("");
-		query_data.str("");
-		counter=0;
-		if(query_buff.lastError().isValid()){
-			Warning msg=this->set_warning(2);
+		if(ok==false){
+			Error msg=this->set_error(29);
 			ostringstream info;
 			info << "Table Name                : " << Hyd_Element_Floodplain::elem_table->get_table_name() << endl;
-			info << "Table error info          : " << query_buff.lastError().text().toStdString() << endl;
+			info << "Table error info          : " << writer.get_last_error() << endl;
 			msg.make_second_info(info.str());
-			msg.output_msg(2);
+			throw msg;
 		}
 	}
+	//send the rest and commit
+	if(writer.finish()==false){
+		Error msg=this->set_error(29);
+		ostringstream info;
+		info << "Table Name                : " << Hyd_Element_Floodplain::elem_table->get_table_name() << endl;
+		info << "Table error info          : " << writer.get_last_error() << endl;
+		msg.make_second_info(info.str());
+		throw msg;
+	}
 
 	//QSqlQuery model(*ptr_database);
 	//for(int i=0; i< this->NEQ; i++){
@@ -4736,18 +4739,27 @@ void Hyd_Model_Floodplain::connect_elems2instat_boundarycurves(Hyd_Coast_Model *
 		cout <<"Connect the floodplain elements with the instationary boundary curves..."<<endl;
 		Sys_Common_Output::output_hyd->output_txt(&cout);
 
-		//search for the link
+		//index of the curves by their curve number; the last curve with the same number is taken
+		QHash<int, int> curve_index;
+		curve_index.reserve(this->Param_FP.number_instat_boundary);
 		for(int i=0; i< this->Param_FP.number_instat_boundary;i++){//loop over all curves
-			for(int j=0; j< this->NEQ; j++){//loop over all elems
-				try{
-					this->floodplain_elems[j].element_type->connect_instat_boundarycurve(&this->instat_boundary_curves[i]);
-				}
-				catch(Error msg){
-					ostringstream info;
-					info <<"Elementnumber: "<< j << endl;
-					msg.make_second_info(info.str());
-					throw msg;
-				}
+			curve_index.insert(this->instat_boundary_curves[i].get_curve_number(), i);
+		}
+		//search for the link
+		for(int j=0; j< this->NEQ; j++){//loop over all elems
+			if(this->floodplain_elems[j].element_type->get_bound_flag()==false){
+				continue;
+			}
+			//stationary boundaries are connected with any curve
+			int index=curve_index.value(this->floodplain_elems[j].get_boundary_data().curve_number, 0);
+			try{
+				this->floodplain_elems[j].element_type->connect_instat_boundarycurve(&this->instat_boundary_curves[index]);
+			}
+			catch(Error msg){
+				ostringstream info;
+				info <<"Elementnumber: "<< j << endl;
+				msg.make_second_info(info.str());
+				throw msg;
 			}
 		}
 	}
@@ -5308,6 +5320,12 @@ Warning Hyd_Model_Floodplain::set_warning(const int warn_type){
 			reaction = "The CPU scheme will be used";
 			type = 11;
 			break;
+		case 7://result datas can not submitted
+			place.append("output_snapshot2database(QSqlDatabase *ptr_database, const string break_sz, const string time, const int number, const int *index, const double *values)");
+			reason = "Can not submit the instationary result element data of the HYD raster to the database";
+			help = "Check the database";
+			type = 2;
+			break;
 
 		default:
 			place.append("set_warning(const int warn_type)");
@@ -5501,6 +5519,18 @@ Error Hyd_Model_Floodplain::set_error(const int err_type){
 			help = "Please read message above.";
 			type = 35;
 			break;
+		case 28://bad alloc
+			place.append("output_result2binary(const double timepoint)");
+			reason = "Can not allocate the memory";
+			help = "Check the memory";
+			type = 10;
+			break;
+		case 29://base data can not be transferred
+			place.append("transfer_element_members2database(QSqlDatabase *ptr_database)");
+			reason = "Can not transfer the element data of the floodplain model to the database; the import of the elements is rolled back";
+			help = "Check the database";
+			type = 2;
+			break;
 
 		default:
 			place.append("set_error(const int err_type)");
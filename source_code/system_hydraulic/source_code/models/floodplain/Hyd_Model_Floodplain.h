@@ -21,6 +21,8 @@
 #include "Hyd_Floodplain_Polysegment.h"
 //class of the fllodplain raster
 #include "Hyd_Floodplain_Raster.h"
+//class of the chunked binary result store
+#include "Hyd_Floodplain_Result_Store.h"
 //class for counting the couplings
 #include "Hyd_Coupling_Model_List.h"
 //info class about the hydraulic boundary szenario data
@@ -172,9 +174,17 @@ public:
     void output_result2bluekenue(const double timepoint, const int timestep_number, const double start_time);
 	///Output the result members per timestep to Paraview
 	void output_result2paraview(const double timepoint, const int timestep_number);
+	///Output the result members per timestep to the chunked binary result store
+	void output_result2binary(const double timepoint);
+	///Close the chunked binary result store; the last frame contains the final maximum values and the wet duration
+	void close_binary_output(void);
 
 	///Output the result members per timestep to database
 	void output_result2database(QSqlDatabase *ptr_database, const string break_sz, const double timepoint, const int timestep_number, const string time);
+	///Copy the instationary result values of the elements, which are output to database, to the given buffers (index: number of elements; values: number of elements*_Hyd_Element_Floodplain_Type::number_instat_values); the number of copied elements is returned
+	int copy_instat_results2snapshot(int *index, double *values);
+	///Output the instationary result values of a snapshot (see copy_instat_results2snapshot()) to database; just the fixed members of the elements are used, thus it can run parallel to the calculation
+	void output_snapshot2database(QSqlDatabase *ptr_database, const string break_sz, const string time, const int number, const int *index, const double *values);
 
 	///Output solver errors for one solver step
 	void output_solver_errors(const double time_point, const int step_counter, const string timestring, const string realtime, const double diff_time, const int total_internal, const int internal_steps);
@@ -322,6 +332,13 @@ private:
 	///Total volume error due to outflow of an element, if there is no more watervolume left in the element
 	double total_volume_error_zero_outflow;
 
+	///Chunked binary store of the raster results per output time
+	Hyd_Floodplain_Result_Store binary_store;
+	///Buffer for the values of one frame of the binary result store
+	double *binary_frame;
+	///Number of result series per frame of the binary result store (h, s, v_x, v_y, h_max, v_total_max, wet duration)
+	static const int number_binary_series=7;
+
 	///The error in the hydrological balance due to a setted outflow but no watervolume is left in the element
 	double error_zero_outflow_volume;
 	///Error discharge due to a setted outflow but no watervolume is left in the element
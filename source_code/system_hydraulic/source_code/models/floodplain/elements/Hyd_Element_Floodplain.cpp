@@ -18,7 +18,7 @@ Hyd_Element_Floodplain::Hyd_Element_Floodplain(void){
 	this->buffer_boundary_data=NULL;
 	this->buffer_flow_data=NULL;
 	this->z_value=0.0;
-	this->polygon_string=label::not_set;
+	this->polygon_wkb_hex="";
 	this->hyd_sz=NULL;
 
 	try{
@@ -34,7 +34,7 @@ Hyd_Element_Floodplain::Hyd_Element_Floodplain(void){
 Hyd_Element_Floodplain::~Hyd_Element_Floodplain(void){
 	this->delete_element_type();
 	this->delete_data_buffer();
-	this->polygon_string="";
+	this->polygon_wkb_hex="";
 
 	//count the memory
 	Sys_Memory_Count::self()->minus_mem(sizeof(Hyd_Element_Floodplain), _sys_system_modules::HYD_SYS);
@@ -127,16 +127,7 @@ void Hyd_Element_Floodplain::transfer_element_members2database(const int glob_el
 
 	query_string << "true" << " , " ;
 
-	if(this->polygon_string==label::not_set){
-		//set the polgon points
-		Geo_Raster_Polygon poly_buff;
-		poly_buff.set_points(&this->mid_point, geo_info.width_x, geo_info.width_y, geo_info.angle, geo_info.origin_global_x, geo_info.origin_global_y);
-		this->polygon_string=poly_buff.get_polygon2sql_string();
-		query_string << this->polygon_string <<" ) ";
-	}
-	else{
-		query_string << this->polygon_string <<" ) ";
-	}
+	query_string << _Geo_Polygon::convert_wkb_hex2sql_string(this->get_polygon_wkb_hex(geo_info)) <<" ) ";
 
 	Data_Base::database_request(model, query_string.str(), ptr_database);
 
@@ -153,76 +144,47 @@ void Hyd_Element_Floodplain::transfer_element_members2database(const int glob_el
 	//appending tables
 	this->transfer_element_boundarydata2database(ptr_database, glob_elem_id);
 }
-//Get a string for transfering the data to database
-string Hyd_Element_Floodplain::get_datastring2database(QSqlDatabase *ptr_database, const int glob_elem_id, const int fp_number, const _hyd_floodplain_geo_info geo_info){
-	string buffer;
-
-	ostringstream query_string;
-	query_string << " ( ";
-	query_string << fp_number << " , " ;
-	query_string << this->elem_number<< " , " ;
-	query_string << this->z_value<< " , " ;
-	query_string << this->get_flow_data().mat_type << " , " ;
-	query_string << this->get_flow_data().init_condition << " , " ;
-	query_string <<  glob_elem_id<< " , " ;
-	query_string << FORMAT_FIXED_REAL << P(8);
-	query_string << this->mid_point.get_xcoordinate()<< " , " ;
-	query_string << this->mid_point.get_ycoordinate()<< " , " ;
-	query_string.clear();
-	query_string << this->system_id.area_state<< " , " ;
-	query_string << this->system_id.measure_nr<< " , " ;
-
-	query_string << "true" << " , " ;
-
-	if(this->polygon_string==label::not_set){
-		//set the polgon points
-		Geo_Raster_Polygon poly_buff;
-		poly_buff.set_points(&this->mid_point, geo_info.width_x, geo_info.width_y, geo_info.angle, geo_info.origin_global_x, geo_info.origin_global_y);
-		this->polygon_string=poly_buff.get_polygon2sql_string();
-		query_string << this->polygon_string <<" ) ";
-	}
-	else{
-		query_string << this->polygon_string <<" ) ";
-	}
-
-	//appending tables
-	//this->transfer_element_boundarydata2database(ptr_database, glob_elem_id);
-	this->glob_elem_number = glob_elem_id;
-
-	buffer=query_string.str();
-	return buffer;
-}
-//Get the header for inserting the element data to database table (static)
-string Hyd_Element_Floodplain::get_insert_header_data_table(QSqlDatabase *ptr_database){
+//Set the table and the columns of the element data to the bulk writer (static)
+void Hyd_Element_Floodplain::set_bulk_writer_data_table(Sys_Database_Bulk_Writer *writer, QSqlDatabase *ptr_database){
 	try{
 		Hyd_Element_Floodplain::set_table(ptr_database);
 	}
 	catch(Error msg){
 		throw msg;
 	}
-	//set the query via a query string
-	ostringstream query_string;
-	query_string << "INSERT INTO  " << Hyd_Element_Floodplain::elem_table->get_table_name();
-	query_string <<" ( ";
-	query_string << Hyd_Element_Floodplain::elem_table->get_column_name(hyd_label::elemdata_fpno) <<" , ";
-	query_string << Hyd_Element_Floodplain::elem_table->get_column_name(hyd_label::elemdata_id) <<" , ";
-	query_string << Hyd_Element_Floodplain::elem_table->get_column_name(hyd_label::elemdata_z) <<" , ";
-	query_string << Hyd_Element_Floodplain::elem_table->get_column_name(hyd_label::elemdata_matid) <<" , ";
-	query_string << Hyd_Element_Floodplain::elem_table->get_column_name(hyd_label::elemdata_init) <<" , ";
-	query_string << Hyd_Element_Floodplain::elem_table->get_column_name(hyd_label::elemdata_glob_id) <<" , ";
-	query_string << Hyd_Element_Floodplain::elem_table->get_column_name(hyd_label::elemdata_mid_x) <<" , ";
-	query_string << Hyd_Element_Floodplain::elem_table->get_column_name(hyd_label::elemdata_mid_y) <<" , ";
-	query_string << Hyd_Element_Floodplain::elem_table->get_column_name(label::areastate_id) <<" , ";
-	query_string << Hyd_Element_Floodplain::elem_table->get_column_name(label::measure_id) <<" , ";
-	query_string << Hyd_Element_Floodplain::elem_table->get_column_name(label::applied_flag) <<" , ";
-
-	query_string << Hyd_Element_Floodplain::elem_table->get_column_name(hyd_label::elemdata_polygon) <<" ) ";
+	writer->set_table(Hyd_Element_Floodplain::elem_table->get_table_name());
+	writer->add_column(Hyd_Element_Floodplain::elem_table->get_column_name(hyd_label::elemdata_fpno));
+	writer->add_column(Hyd_Element_Floodplain::elem_table->get_column_name(hyd_label::elemdata_id));
+	writer->add_column(Hyd_Element_Floodplain::elem_table->get_column_name(hyd_label::elemdata_z));
+	writer->add_column(Hyd_Element_Floodplain::elem_table->get_column_name(hyd_label::elemdata_matid));
+	writer->add_column(Hyd_Element_Floodplain::elem_table->get_column_name(hyd_label::elemdata_init));
+	writer->add_column(Hyd_Element_Floodplain::elem_table->get_column_name(hyd_label::elemdata_glob_id));
+	writer->add_column(Hyd_Element_Floodplain::elem_table->get_column_name(hyd_label::elemdata_mid_x));
+	writer->add_column(Hyd_Element_Floodplain::elem_table->get_column_name(hyd_label::elemdata_mid_y));
+	writer->add_column(Hyd_Element_Floodplain::elem_table->get_column_name(label::areastate_id));
+	writer->add_column(Hyd_Element_Floodplain::elem_table->get_column_name(label::measure_id));
+	writer->add_column(Hyd_Element_Floodplain::elem_table->get_column_name(label::applied_flag));
+	writer->add_column(Hyd_Element_Floodplain::elem_table->get_column_name(hyd_label::elemdata_polygon), _sys_bulk_column_type::bulk_geometry_wkb);
+}
+//Add the element data as row to the bulk writer; false is returned, if a sent package failed
+bool Hyd_Element_Floodplain::add_data2bulk_writer(Sys_Database_Bulk_Writer *writer, const int glob_elem_id, const int fp_number, const _hyd_floodplain_geo_info geo_info){
+	writer->add_int(fp_number);
+	writer->add_int(this->elem_number);
+	writer->add_double(this->z_value);
+	writer->add_int(this->get_flow_data().mat_type);
+	writer->add_double(this->get_flow_data().init_condition);
+	writer->add_int(glob_elem_id);
+	writer->add_double(this->mid_point.get_xcoordinate());
+	writer->add_double(this->mid_point.get_ycoordinate());
+	writer->add_int(this->system_id.area_state);
+	writer->add_int(this->system_id.measure_nr);
+	writer->add_bool(true);
+	writer->add_text(this->get_polygon_wkb_hex(geo_info));
 
-	query_string << " VALUES ";
+	//appending tables
+	this->glob_elem_number = glob_elem_id;
 
-	string buffer;
-	buffer=query_string.str();
-	return buffer;
+	return writer->end_row();
 }
 //Transfer the floodplain element boundary data of an hydraulc boundary scenario to a database
 void Hyd_Element_Floodplain::transfer_hydraulic_boundary_sz2database(QSqlDatabase *ptr_database, const int ){
@@ -1049,6 +1011,54 @@ int Hyd_Element_Floodplain::select_relevant_results_elements_database(QSqlQueryM
 
 	return number;
 }
+//Select the relevant results per floodplain elements for one floodplain model in a database table for a row by row reading (columns: id, h_max, vtot_max, dsdt_max, dur_wet, t_first, hv_max, end_vol) (static)
+void Hyd_Element_Floodplain::stream_relevant_results_elements_database(Sys_Database_Stream_Reader *results, QSqlDatabase *ptr_database, const _sys_system_id id, const int fp_number, const int bound_sz, const string break_sz){
+	try{
+		Hyd_Element_Floodplain::set_erg_table(ptr_database);
+	}
+	catch(Error msg){
+		throw msg;
+	}
+
+	ostringstream test_filter;
+	test_filter<< "SELECT ";
+	test_filter << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemdata_id) << " , ";
+	test_filter << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_h_max) << " , ";
+	test_filter << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_vtot_max) << " , ";
+	test_filter << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_dsdt_max) << " , ";
+	test_filter << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_dur_wet) << " , ";
+	test_filter << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_t_first) << " , ";
+	test_filter << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_hv_max) << " , ";
+	test_filter << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_end_vol) ;
+	test_filter << " FROM " << Hyd_Element_Floodplain::erg_table->get_table_name();
+	test_filter << " WHERE ";
+	test_filter << Hyd_Element_Floodplain::erg_table->get_column_name(risk_label::sz_break_id) << " = '" << break_sz<<"'";
+	test_filter << " AND ";
+	test_filter << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::sz_bound_id) << " = " << bound_sz;
+	test_filter << " AND ";
+	test_filter << Hyd_Element_Floodplain::erg_table->get_column_name(label::applied_flag) << "= true";
+	test_filter << " AND ";
+	test_filter << Hyd_Element_Floodplain::erg_table->get_column_name(label::areastate_id) << " ="  << id.area_state;
+	test_filter << " AND (";
+	test_filter << Hyd_Element_Floodplain::erg_table->get_column_name(label::measure_id) << " = " << 0 ;
+	test_filter << " OR " ;
+	test_filter << Hyd_Element_Floodplain::erg_table->get_column_name(label::measure_id) << " = " << id.measure_nr;
+	test_filter << " ) " ;
+	test_filter << " AND ";
+	test_filter << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemdata_fpno) << " = " << fp_number;
+	test_filter << " ORDER BY " << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemdata_id);
+
+	//check the request
+	if(results->execute(test_filter.str())==false){
+		Error msg;
+		msg.set_msg("Hyd_Element_Floodplain::stream_relevant_results_elements_database(Sys_Database_Stream_Reader *results, QSqlDatabase *ptr_database, const _sys_system_id id, const int fp_number, const int bound_sz, const string break_sz)","Invalid database request", "Check the database", 2, false);
+		ostringstream info;
+		info << "Table Name      : " << Hyd_Element_Floodplain::erg_table->get_table_name() << endl;
+		info << "Table error info: " << results->get_last_error() << endl;
+		msg.make_second_info(info.str());
+		throw msg;
+	}
+}
 //Count the number of relevant results per floodplain elements for one floodplain model in a database table (static)
 int Hyd_Element_Floodplain::count_relevant_results_elements_database(QSqlQueryModel *results, QSqlDatabase *ptr_database, const _sys_system_id id, const int fp_number, const int bound_sz, const string break_sz, const bool with_output){
 			int number=0;
@@ -1571,8 +1581,8 @@ void Hyd_Element_Floodplain::close_erg_table(void){
 		Hyd_Element_Floodplain::erg_table=NULL;
 	}
 }
-//Get the maximum value of the global index of the element result database table (static)
-int Hyd_Element_Floodplain::get_max_glob_id_erg_table(QSqlDatabase *ptr_database){
+//Reserve a number of global indices for new records in the element result database table; the first index is returned (static)
+int Hyd_Element_Floodplain::reserve_glob_id_erg_table(QSqlDatabase *ptr_database, const int number){
 	//the table is set (the name and the column names) and allocated
 	try{
 		Hyd_Element_Floodplain::set_erg_table(ptr_database);
@@ -1581,8 +1591,8 @@ int Hyd_Element_Floodplain::get_max_glob_id_erg_table(QSqlDatabase *ptr_database
 		throw msg;
 	}
 
-	//evaluate the global identifier
-	int id_glob=Hyd_Element_Floodplain::erg_table->maximum_int_of_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemdata_glob_id),ptr_database);
+	//reserve the global identifiers
+	int id_glob=Hyd_Element_Floodplain::erg_table->reserve_int_of_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemdata_glob_id), ptr_database, number);
 	return id_glob;
 }
 //Delete all data in the database table for the results of an hydraulic simulation for the floodplain elements (static)
@@ -1961,7 +1971,6 @@ void Hyd_Element_Floodplain::copy_results(QSqlDatabase *ptr_database, const _sys
 	}
 
 	int glob_id = 0;
-	glob_id = Hyd_Element_Floodplain::erg_table->maximum_int_of_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemdata_glob_id), ptr_database) + 1;
 
 	QSqlQueryModel model;
 	ostringstream test_filter;
@@ -1988,6 +1997,7 @@ void Hyd_Element_Floodplain::copy_results(QSqlDatabase *ptr_database, const _sys
 	ostringstream cout;
 	cout << "Copy " << model.rowCount() << " results of the floodplain element(s) to the new measure state..." << endl;
 	Sys_Common_Output::output_hyd->output_txt(&cout);
+	glob_id = Hyd_Element_Floodplain::erg_table->reserve_int_of_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemdata_glob_id), ptr_database, model.rowCount());
 
 	QSqlQueryModel model1;
 	for (int i = 0; i < model.rowCount(); i++) {
@@ -2065,7 +2075,7 @@ void Hyd_Element_Floodplain::create_erg_instat_table(QSqlDatabase *ptr_database)
 		Sys_Common_Output::output_hyd->output_txt(&cout);
 		//make specific input for this class
 		const string tab_name = hyd_label::tab_fpelem_erg_instat;
-		const int num_col = 18;
+		const int num_col = 17;
 		_Sys_data_tab_column tab_col[num_col];
 		//init
 		for (int i = 0; i < num_col; i++) {
@@ -2153,9 +2163,7 @@ void Hyd_Element_Floodplain::create_erg_instat_table(QSqlDatabase *ptr_database)
 		tab_col[16].type = sys_label::tab_col_type_string;
 		tab_col[16].default_value = "";
 
-		tab_col[17].name = hyd_label::elemdata_polygon;
-		tab_col[17].type = sys_label::tab_col_type_polygon;
-
+		//the element polygons are not stored per time step; they are joined from the element table in the view (see create_erg_instat_view)
 
 		try {
 			Hyd_Element_Floodplain::erg_instat_table = new Tables();
@@ -2191,7 +2199,7 @@ void Hyd_Element_Floodplain::create_erg_instat_table(QSqlDatabase *ptr_database)
 
 
 		Hyd_Element_Floodplain::erg_instat_table->create_index2column(ptr_database, Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::data_time));
-		Hyd_Element_Floodplain::erg_instat_table->create_spatial_index2column(ptr_database, Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemdata_polygon));
+		Hyd_Element_Floodplain::erg_instat_table->create_index2column(ptr_database, Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemdata_glob_id));
 
 
 		Hyd_Element_Floodplain::close_erg_instat_table();	
@@ -2199,8 +2207,8 @@ void Hyd_Element_Floodplain::create_erg_instat_table(QSqlDatabase *ptr_database)
 
 
 }
-//Create the database view for the instationary results of an hydraulic simulation for the floodplain elements
-void Hyd_Element_Floodplain::create_erg_instat_view1(QSqlDatabase *ptr_database) {
+//Create the database view for the instationary results of an hydraulic simulation for the floodplain elements joined with the element polygons (static)
+void Hyd_Element_Floodplain::create_erg_instat_view(QSqlDatabase *ptr_database) {
 
 	//Set tables
 	ostringstream cout;
@@ -2228,6 +2236,7 @@ void Hyd_Element_Floodplain::create_erg_instat_view1(QSqlDatabase *ptr_database)
 	query_string << Hyd_Element_Floodplain::erg_instat_table->get_column_name_table(label::glob_id) << " , ";
 	query_string << Hyd_Element_Floodplain::elem_table->get_column_name_table(hyd_label::elemdata_glob_id) << " , ";
 	query_string << Hyd_Element_Floodplain::elem_table->get_column_name_table(hyd_label::elemdata_fpno) << " , ";
+	query_string << Hyd_Element_Floodplain::elem_table->get_column_name_table(hyd_label::elemdata_id) << " , ";
 	query_string << Hyd_Element_Floodplain::erg_instat_table->get_column_name_table(label::areastate_id) << " , ";
 	query_string << Hyd_Element_Floodplain::erg_instat_table->get_column_name_table(label::measure_id) << " , ";
 	query_string << Hyd_Element_Floodplain::erg_instat_table->get_column_name_table(hyd_label::sz_bound_id) << " , ";
@@ -2253,9 +2262,6 @@ void Hyd_Element_Floodplain::create_erg_instat_view1(QSqlDatabase *ptr_database)
 	query_string << " = ";
 	query_string << Hyd_Element_Floodplain::erg_instat_table->get_column_name_table(hyd_label::elemdata_glob_id) << "  ";
 
-	cout << query_string.str() << endl;
-	Sys_Common_Output::output_hyd->output_txt(&cout);
-
 	Data_Base::database_request(&query, query_string.str(), ptr_database);
 	if (query.lastError().isValid() == true) {
 		Error msg;
@@ -2267,6 +2273,36 @@ void Hyd_Element_Floodplain::create_erg_instat_view1(QSqlDatabase *ptr_database)
 		throw msg;
 	}
 
+}
+//Check if the view for the instationary results of the floodplain elements exists already (static)
+bool Hyd_Element_Floodplain::check_erg_instat_view_exists(QSqlDatabase *ptr_database) {
+
+	QSqlQueryModel query;
+
+	ostringstream query_string;
+	query_string << "SELECT EXISTS ( SELECT * FROM information_schema.tables ";
+	query_string << "WHERE table_schema ='" << Sys_Project::get_complete_project_database_schemata_name() << "' ";
+	query_string << "AND table_name ='" << functions::convert_string2lower_case(hyd_label::view_fpelem_erg_instat) << "' )";
+
+
+	Data_Base::database_request(&query, query_string.str(), ptr_database);
+	if (query.lastError().isValid() == true) {
+		Error msg;
+		msg.set_msg("Hyd_Element_Floodplain::check_erg_instat_view_exists(QSqlDatabase *ptr_database)", "Invalid database request", "Check the database", 2, false);
+		ostringstream info;
+		info << "View Name      : " << hyd_label::view_fpelem_erg_instat << endl;
+		info << "View error info: " << query.lastError().text().toStdString() << endl;
+		msg.make_second_info(info.str());
+		throw msg;
+	}
+
+	//the request always gives one row with the boolean result
+	if (query.rowCount() > 0) {
+		return query.record(0).value(0).toBool();
+	}
+
+	return false;
+
 }
 ///Set the database table for the results of an hydraulic simulation for the floodplain elements: it sets the table name and the name of the columns and allocate them
 void Hyd_Element_Floodplain::set_erg_instat_table(QSqlDatabase *ptr_database, const bool not_close) {
@@ -2274,7 +2310,7 @@ void Hyd_Element_Floodplain::set_erg_instat_table(QSqlDatabase *ptr_database, co
 	if (Hyd_Element_Floodplain::erg_instat_table == NULL) {
 		//make specific input for this class
 		const string tab_id_name = hyd_label::tab_fpelem_erg_instat;
-		string tab_id_col[18];
+		string tab_id_col[17];
 		tab_id_col[0] = label::areastate_id;
 		tab_id_col[1] = label::measure_id;
 		tab_id_col[2] = hyd_label::sz_bound_id;
@@ -2290,9 +2326,8 @@ void Hyd_Element_Floodplain::set_erg_instat_table(QSqlDatabase *ptr_database, co
 		tab_id_col[12] = hyd_label::elemerg_s_max;
 		tab_id_col[13] = label::glob_id;
 		tab_id_col[14] = hyd_label::data_time;
-		tab_id_col[15] = hyd_label::elemdata_polygon;
-		tab_id_col[16] = hyd_label::elemdata_fpno;
-		tab_id_col[17] = hyd_label::elemdata_id;
+		tab_id_col[15] = hyd_label::elemdata_fpno;
+		tab_id_col[16] = hyd_label::elemdata_id;
 
 		try {
 			Hyd_Element_Floodplain::erg_instat_table = new Tables(tab_id_name, tab_id_col, sizeof(tab_id_col) / sizeof(tab_id_col[0]));
@@ -2323,8 +2358,8 @@ void Hyd_Element_Floodplain::close_erg_instat_table(void) {
 	}
 
 }
-///Get the maximum value of the global index of the element instationary result database table
-int Hyd_Element_Floodplain::get_max_glob_id_erg_instat_table(QSqlDatabase *ptr_database){
+//Reserve a number of global indices for new records in the element instationary result database table; the first index is returned (static)
+int Hyd_Element_Floodplain::reserve_glob_id_erg_instat_table(QSqlDatabase *ptr_database, const int number){
 	//the table is set (the name and the column names) and allocated
 	try {
 		Hyd_Element_Floodplain::set_erg_instat_table(ptr_database);
@@ -2333,8 +2368,8 @@ int Hyd_Element_Floodplain::get_max_glob_id_erg_instat_table(QSqlDatabase *ptr_d
 		throw msg;
 	}
 
-	//evaluate the global identifier
-	int id_glob = Hyd_Element_Floodplain::erg_instat_table->maximum_int_of_column(Hyd_Element_Floodplain::erg_instat_table->get_column_name(label::glob_id), ptr_database);
+	//reserve the global identifiers
+	int id_glob = Hyd_Element_Floodplain::erg_instat_table->reserve_int_of_column(Hyd_Element_Floodplain::erg_instat_table->get_column_name(label::glob_id), ptr_database, number);
 	return id_glob;
 
 }
@@ -2474,6 +2509,54 @@ int Hyd_Element_Floodplain::select_relevant_instat_results_elements_database(QSq
 	return number;
 
 }
+//Select the relevant instationary results per floodplain elements for one floodplain model and one time in a database table for a row by row reading (columns: id, h, vtot, dsdt, hv, time) (static)
+void Hyd_Element_Floodplain::stream_relevant_instat_results_elements_database(Sys_Database_Stream_Reader *results, QSqlDatabase *ptr_database, const _sys_system_id id, const int fp_number, const int bound_sz, const string break_sz, const string time_date) {
+	try {
+		Hyd_Element_Floodplain::set_erg_instat_table(ptr_database);
+	}
+	catch (Error msg) {
+		throw msg;
+	}
+
+	ostringstream test_filter;
+	test_filter << "SELECT ";
+	test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemdata_id) << " , ";
+	test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemerg_h_max) << " , ";
+	test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemerg_vtot_max) << " , ";
+	test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemerg_dsdt_max) << " , ";
+	test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemerg_hv_max) << " , ";
+	test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::data_time);
+	test_filter << " FROM " << Hyd_Element_Floodplain::erg_instat_table->get_table_name();
+	test_filter << " WHERE ";
+	test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(risk_label::sz_break_id) << " = '" << break_sz << "'";
+	test_filter << " AND ";
+	test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::sz_bound_id) << " = " << bound_sz;
+	test_filter << " AND ";
+	test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(label::applied_flag) << "= true";
+	test_filter << " AND ";
+	test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(label::areastate_id) << " =" << id.area_state;
+	test_filter << " AND (";
+	test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(label::measure_id) << " = " << 0;
+	test_filter << " OR ";
+	test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(label::measure_id) << " = " << id.measure_nr;
+	test_filter << " ) ";
+	test_filter << " AND ";
+	test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemdata_fpno) << " = " << fp_number;
+	test_filter << " AND ";
+	test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::data_time) << " = '" << time_date<<"'";
+	test_filter << " ORDER BY " << Hyd_Element_Floodplain::erg_instat_table->get_column_name(label::glob_id);
+
+	//check the request
+	if (results->execute(test_filter.str()) == false) {
+		Error msg;
+		msg.set_msg("Hyd_Element_Floodplain::stream_relevant_instat_results_elements_database(Sys_Database_Stream_Reader *results, QSqlDatabase *ptr_database, const _sys_system_id id, const int fp_number, const int bound_sz, const string break_sz, const string time_date)", "Invalid database request", "Check the database", 2, false);
+		ostringstream info;
+		info << "Table Name      : " << Hyd_Element_Floodplain::erg_instat_table->get_table_name() << endl;
+		info << "Table error info: " << results->get_last_error() << endl;
+		msg.make_second_info(info.str());
+		throw msg;
+	}
+}
 //Count the number of relevant instationary results per floodplain elements for one floodplain model in a database table (static)
 int Hyd_Element_Floodplain::count_relevant_instat_results_elements_database(QSqlQueryModel *results, QSqlDatabase *ptr_database, const _sys_system_id id, const int fp_number, const int bound_sz, const string break_sz, const string time_date, const bool with_output) {
 	int number = 0;
@@ -2625,7 +2708,6 @@ void Hyd_Element_Floodplain::copy_instat_results(QSqlDatabase *ptr_database, con
 	}
 
 	int glob_id = 0;
-	glob_id = Hyd_Element_Floodplain::erg_instat_table->maximum_int_of_column(Hyd_Element_Floodplain::erg_instat_table->get_column_name(label::glob_id), ptr_database) + 1;
 
 	QSqlQueryModel model;
 	ostringstream test_filter;
@@ -2652,6 +2734,7 @@ void Hyd_Element_Floodplain::copy_instat_results(QSqlDatabase *ptr_database, con
 	ostringstream cout;
 	cout << "Copy " << model.rowCount() << " instationary results of the floodplain element(s) to the new measure state..." << endl;
 	Sys_Common_Output::output_hyd->output_txt(&cout);
+	glob_id = Hyd_Element_Floodplain::erg_instat_table->reserve_int_of_column(Hyd_Element_Floodplain::erg_instat_table->get_column_name(label::glob_id), ptr_database, model.rowCount());
 
 	QSqlQueryModel model1;
 	for (int i = 0; i < model.rowCount(); i++) {
@@ -2661,12 +2744,31 @@ void Hyd_Element_Floodplain::copy_instat_results(QSqlDatabase *ptr_database, con
 		}
 		test_filter.str("");
 		test_filter << "INSERT INTO " << Hyd_Element_Floodplain::erg_instat_table->get_table_name();
+		test_filter << " ( ";
+		test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(label::glob_id) << " , ";
+		test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(label::areastate_id) << " , ";
+		test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(label::measure_id) << " , ";
+		test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(label::applied_flag) << " , ";
+		test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemdata_glob_id) << " , ";
+		test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemdata_fpno) << " , ";
+		test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemdata_id) << " , ";
+		test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::sz_bound_id) << " , ";
+		test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(risk_label::sz_break_id) << " , ";
+		test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemerg_h_max) << " , ";
+		test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemerg_s_max) << " , ";
+		test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemerg_dsdt_max) << " , ";
+		test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemerg_vx_max) << " , ";
+		test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemerg_vy_max) << " , ";
+		test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemerg_vtot_max) << " , ";
+		test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemerg_hv_max) << " , ";
+		test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::data_time) << " ) ";
 		test_filter << " SELECT " << glob_id << " , ";
 		test_filter << dest.area_state << " , ";
 		test_filter << dest.measure_nr << " , ";
 		test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(label::applied_flag) << " , ";
-		test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemdata_polygon) << " , ";
+		test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemdata_glob_id) << " , ";
 		test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemdata_fpno) << " , ";
+		test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemdata_id) << " , ";
 		test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::sz_bound_id) << " , ";
 		test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(risk_label::sz_break_id) << " , ";
 		test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemerg_h_max) << " , ";
@@ -2676,8 +2778,7 @@ void Hyd_Element_Floodplain::copy_instat_results(QSqlDatabase *ptr_database, con
 		test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemerg_vy_max) << " , ";
 		test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemerg_vtot_max) << " , ";
 		test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemerg_hv_max) << " , ";
-		test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::data_time) << " , ";
-		test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemdata_polygon) << "  ";
+		test_filter << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::data_time) << "  ";
 
 
 		test_filter << " FROM " << Hyd_Element_Floodplain::erg_instat_table->get_table_name() << " ";
@@ -2709,7 +2810,7 @@ void Hyd_Element_Floodplain::clone_element(Hyd_Element_Floodplain *elements){
 
 	this->type=elements->type;
 	this->z_value=elements->z_value;
-	this->polygon_string=elements->polygon_string;
+	this->polygon_wkb_hex=elements->polygon_wkb_hex;
 	this->mid_point=elements->mid_point;
 
 	*this->buffer_flow_data=elements->get_flow_data();
@@ -3389,8 +3490,8 @@ void Hyd_Element_Floodplain::output_header_maximum_calculated_values(ostringstre
 	*cout << "No.";
 	_Hyd_Element_Floodplain_Type::output_header_maximum_calculated_values(cout);
 }
-//Get the header for inserting the element result data to database table (static)
-string Hyd_Element_Floodplain::get_insert_header_erg_data_table(QSqlDatabase *ptr_database){
+//Set the table and the columns of the element result data to the bulk writer (static)
+void Hyd_Element_Floodplain::set_bulk_writer_erg_table(Sys_Database_Bulk_Writer *writer, QSqlDatabase *ptr_database){
 	//the table is set (the name and the column names) and allocated
 	try{
 		Hyd_Element_Floodplain::set_erg_table(ptr_database);
@@ -3398,95 +3499,71 @@ string Hyd_Element_Floodplain::get_insert_header_erg_data_table(QSqlDatabase *pt
 	catch(Error msg){
 		throw msg;
 	}
-
-	//set the query via a query string
-	ostringstream query_string;
-	query_string << "INSERT INTO  " << Hyd_Element_Floodplain::erg_table->get_table_name();
-	query_string <<" ( ";
-	query_string << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemdata_fpno) <<" , ";
-	query_string << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemdata_id) <<" , ";
-	query_string << Hyd_Element_Floodplain::erg_table->get_column_name(label::areastate_id) <<" , ";
-	query_string << Hyd_Element_Floodplain::erg_table->get_column_name(label::measure_id) <<" , ";
-	query_string << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::sz_bound_id) <<" , ";
-	query_string << Hyd_Element_Floodplain::erg_table->get_column_name(risk_label::sz_break_id) <<" , ";
-	query_string << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemdata_glob_id) <<" , ";
+	writer->set_table(Hyd_Element_Floodplain::erg_table->get_table_name());
+	writer->add_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemdata_fpno));
+	writer->add_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemdata_id));
+	writer->add_column(Hyd_Element_Floodplain::erg_table->get_column_name(label::areastate_id));
+	writer->add_column(Hyd_Element_Floodplain::erg_table->get_column_name(label::measure_id));
+	writer->add_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::sz_bound_id));
+	writer->add_column(Hyd_Element_Floodplain::erg_table->get_column_name(risk_label::sz_break_id));
+	writer->add_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemdata_glob_id));
 	//max values
-	query_string << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_h_max) <<" , ";
-	query_string << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_s_max) <<" , ";
-	query_string << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_dsdt_max) <<" , ";
-	query_string << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_vx_max) <<" , ";
-	query_string << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_vy_max) <<" , ";
-	query_string << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_vtot_max) <<" , ";
-	query_string << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_hv_max) <<" , ";
-	query_string << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_t_first) <<" , ";
-	query_string << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_dur_wet) <<" , ";
-	query_string << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_end_vol) <<" , ";
+	writer->add_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_h_max));
+	writer->add_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_s_max));
+	writer->add_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_dsdt_max));
+	writer->add_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_vx_max));
+	writer->add_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_vy_max));
+	writer->add_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_vtot_max));
+	writer->add_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_hv_max));
+	writer->add_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_t_first));
+	writer->add_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_dur_wet));
+	writer->add_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_end_vol));
 	//volumes
-	query_string << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_cv_bound_in) <<" , ";
-	query_string << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_cv_bound_out) <<" , ";
-
-	query_string << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_cv_struc_in) <<" , ";
-	query_string << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_cv_struc_out) <<" , ";
-	query_string << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_cv_dir_in) <<" , ";
-	query_string << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_cv_dir_out) <<" , ";
-
-	query_string << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_cv_rv_ov_in) <<" , ";
-	query_string << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_cv_rv_ov_out) <<" , ";
-	query_string << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_cv_rv_db_in) <<" , ";
-	query_string << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_cv_rv_db_out) <<" , ";
-
-	query_string << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_cv_co_ov_in) <<" , ";
-	query_string << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_cv_co_ov_out) <<" , ";
-	query_string << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_cv_co_db_in) <<" , ";
-	query_string << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_cv_co_db_out) <<" , ";
-
-	query_string << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_cv_fp_in) <<" , ";
-	query_string << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_cv_fp_out) <<" , ";
-
-	query_string << Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemdata_polygon) <<" ) ";
-
-	query_string << " VALUES ";
-
-	string buffer;
-	buffer=query_string.str();
-	return buffer;
+	writer->add_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_cv_bound_in));
+	writer->add_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_cv_bound_out));
+	writer->add_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_cv_struc_in));
+	writer->add_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_cv_struc_out));
+	writer->add_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_cv_dir_in));
+	writer->add_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_cv_dir_out));
+	writer->add_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_cv_rv_ov_in));
+	writer->add_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_cv_rv_ov_out));
+	writer->add_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_cv_rv_db_in));
+	writer->add_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_cv_rv_db_out));
+	writer->add_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_cv_co_ov_in));
+	writer->add_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_cv_co_ov_out));
+	writer->add_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_cv_co_db_in));
+	writer->add_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_cv_co_db_out));
+	writer->add_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_cv_fp_in));
+	writer->add_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemerg_cv_fp_out));
+	writer->add_column(Hyd_Element_Floodplain::erg_table->get_column_name(hyd_label::elemdata_polygon), _sys_bulk_column_type::bulk_geometry_wkb);
 }
-//Get a string for transfering the result data to database
-string Hyd_Element_Floodplain::get_datastring_erg2database(const int glob_elem_id, const int fp_number, const _hyd_floodplain_geo_info geo_info, const string break_sz, const bool must_output){
-	string buffer=label::not_set;
-
+//Get if the maximum results of the element are output (it was wet or the output is required)
+bool Hyd_Element_Floodplain::get_max_result_required(const bool must_output){
 	if(this->element_type->get_was_wet_flag()==false && must_output==false){
-		return buffer;
-	}
-
-	ostringstream query_string;
-	query_string << " ( ";
-	query_string << fp_number << " , " ;
-	query_string << this->elem_number << " , " ;
-	query_string << this->system_id.area_state << " , " ;
-	query_string << this->system_id.measure_nr << " , " ;
-	query_string << this->hyd_sz->get_id() << " , " ;
-	query_string << "'"<<break_sz<< "' , " ;
-	query_string << glob_elem_id << " , " ;
-	this->element_type->set_maximum_value2querystring(&query_string);
-
-	if(this->polygon_string==label::not_set){
-		//set the polgon points
-		Geo_Raster_Polygon poly_buff;
-		poly_buff.set_points(&this->mid_point, geo_info.width_x, geo_info.width_y, geo_info.angle, geo_info.origin_global_x, geo_info.origin_global_y);
-		this->polygon_string=poly_buff.get_polygon2sql_string();
-		query_string << this->polygon_string <<" ) ";
+		return false;
 	}
-	else{
-		query_string << this->polygon_string <<" ) ";
-	}
-	this->polygon_string=label::not_set;
-
-	buffer=query_string.str();
-	return buffer;
+	return true;
+}
+//Add the element result data as row to the bulk writer; false is returned, if a sent package failed
+bool Hyd_Element_Floodplain::add_erg2bulk_writer(Sys_Database_Bulk_Writer *writer, const int glob_elem_id, const int fp_number, const _hyd_floodplain_geo_info geo_info, const string break_sz){
+	writer->add_int(fp_number);
+	writer->add_int(this->elem_number);
+	writer->add_int(this->system_id.area_state);
+	writer->add_int(this->system_id.measure_nr);
+	writer->add_int(this->hyd_sz->get_id());
+	writer->add_text(break_sz);
+	writer->add_int(glob_elem_id);
+	double values[_Hyd_Element_Floodplain_Type::number_maximum_values];
+	this->element_type->get_maximum_values(values);
+	for(int i=0; i<_Hyd_Element_Floodplain_Type::number_maximum_values; i++){
+		writer->add_double(values[i]);
+	}
+	writer->add_text(this->get_polygon_wkb_hex(geo_info));
+
+	return writer->end_row();
 }
-//Get the header for inserting the element instationary result data to database table (static)
-string Hyd_Element_Floodplain::get_insert_header_erg_instat_data_table(QSqlDatabase *ptr_database) {
+//Set the table and the columns of the element instationary result data to the bulk writer (static)
+void Hyd_Element_Floodplain::set_bulk_writer_erg_instat_table(Sys_Database_Bulk_Writer *writer, QSqlDatabase *ptr_database) {
 	//the table is set (the name and the column names) and allocated
 	try {
 		Hyd_Element_Floodplain::set_erg_instat_table(ptr_database);
@@ -3494,82 +3571,58 @@ string Hyd_Element_Floodplain::get_insert_header_erg_instat_data_table(QSqlDatab
 	catch (Error msg) {
 		throw msg;
 	}
-
-	//set the query via a query string
-	ostringstream query_string;
-	query_string << "INSERT INTO  " << Hyd_Element_Floodplain::erg_instat_table->get_table_name();
-	query_string << " ( ";
-	query_string << Hyd_Element_Floodplain::erg_instat_table->get_column_name(label::glob_id) << " , ";
-	query_string << Hyd_Element_Floodplain::erg_instat_table->get_column_name(label::areastate_id) << " , ";
-	query_string << Hyd_Element_Floodplain::erg_instat_table->get_column_name(label::measure_id) << " , ";
-	query_string << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::sz_bound_id) << " , ";
-	query_string << Hyd_Element_Floodplain::erg_instat_table->get_column_name(risk_label::sz_break_id) << " , ";
-	query_string << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemdata_glob_id) << " , ";
-	query_string << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemdata_fpno) << " , ";
-	query_string << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemdata_id) << " , ";
-
-
-	//max values
-	query_string << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemerg_h_max) << " , ";
-	query_string << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemerg_s_max) << " , ";
-	query_string << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemerg_dsdt_max) << " , ";
-	query_string << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemerg_vx_max) << " , ";
-	query_string << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemerg_vy_max) << " , ";
-	query_string << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemerg_vtot_max) << " , ";
-	query_string << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemerg_hv_max) << " , ";
-	query_string << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::data_time) << " , ";
-	query_string << Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemdata_polygon) << " ) ";
-
-	
-
-	query_string << " VALUES ";
-
-	string buffer;
-	buffer = query_string.str();
-	return buffer;
-
+	writer->set_table(Hyd_Element_Floodplain::erg_instat_table->get_table_name());
+	writer->add_column(Hyd_Element_Floodplain::erg_instat_table->get_column_name(label::glob_id));
+	writer->add_column(Hyd_Element_Floodplain::erg_instat_table->get_column_name(label::areastate_id));
+	writer->add_column(Hyd_Element_Floodplain::erg_instat_table->get_column_name(label::measure_id));
+	writer->add_column(Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::sz_bound_id));
+	writer->add_column(Hyd_Element_Floodplain::erg_instat_table->get_column_name(risk_label::sz_break_id));
+	writer->add_column(Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemdata_glob_id));
+	writer->add_column(Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemdata_fpno));
+	writer->add_column(Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemdata_id));
+	//instat values
+	writer->add_column(Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemerg_h_max));
+	writer->add_column(Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemerg_s_max));
+	writer->add_column(Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemerg_dsdt_max));
+	writer->add_column(Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemerg_vx_max));
+	writer->add_column(Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemerg_vy_max));
+	writer->add_column(Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemerg_vtot_max));
+	writer->add_column(Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::elemerg_hv_max));
+	writer->add_column(Hyd_Element_Floodplain::erg_instat_table->get_column_name(hyd_label::data_time));
 }
-//Get a string for transfering the instationary result data to database 
-string Hyd_Element_Floodplain::get_datastring_erg_instat_2database(const int id, const int fp_number, const int elem_id, const string break_sz, const string time, const _hyd_floodplain_geo_info geo_info) {
-	string buffer = label::not_set;
-
-	if (this->element_type->get_was_wet_flag() == false && id !=0 ) {
-		return buffer;
+//Get if the instationary results of the element are output (it was wet or it is the first element)
+bool Hyd_Element_Floodplain::get_instat_result_required(const int id) {
+	if (this->element_type->get_was_wet_flag() == false && id != 0) {
+		return false;
 	}
-
-	ostringstream query_string;
-	query_string << " ( ";
-	query_string << elem_id << " , ";
-	query_string << this->system_id.area_state << " , ";
-	query_string << this->system_id.measure_nr << " , ";
-	query_string << this->hyd_sz->get_id() << " , ";
-	query_string << "'" << break_sz << "' , ";
-	query_string << this->glob_elem_number << " , ";
-	query_string << fp_number << " , ";
-	query_string << this->elem_number << " , ";
-	this->element_type->set_instat_value2querystring(&query_string);
-	query_string << time << " , ";
-
-
-	if (this->polygon_string == label::not_set) {
-		//set the polgon points
-		Geo_Raster_Polygon poly_buff;
-		poly_buff.set_points(&this->mid_point, geo_info.width_x, geo_info.width_y, geo_info.angle, geo_info.origin_global_x, geo_info.origin_global_y);
-		this->polygon_string = poly_buff.get_polygon2sql_string();
-		query_string << this->polygon_string << " ) ";
-	}
-	else {
-		query_string << this->polygon_string << " ) ";
+	return true;
+}
+//Get the instationary result values of the element; false is returned, if the element is not output (never wet and not the first element)
+bool Hyd_Element_Floodplain::get_instat_result_values(const int id, double *values) {
+	if (this->get_instat_result_required(id) == false) {
+		return false;
 	}
-	this->polygon_string = label::not_set;
-
-	
-
-
-	buffer = query_string.str();
-	return buffer;
-
-
+	this->element_type->get_instat_values(values);
+	return true;
+}
+//Add the given instationary result values as row to the bulk writer; just the fixed members of the element are used; false is returned, if a sent package failed
+bool Hyd_Element_Floodplain::add_erg_instat2bulk_writer(Sys_Database_Bulk_Writer *writer, const int fp_number, const int elem_id, const string break_sz, const string time, const double *values) {
+	writer->add_int(elem_id);
+	writer->add_int(this->system_id.area_state);
+	writer->add_int(this->system_id.measure_nr);
+	writer->add_int(this->hyd_sz->get_id());
+	writer->add_text(break_sz);
+	writer->add_int(this->glob_elem_number);
+	writer->add_int(fp_number);
+	writer->add_int(this->elem_number);
+	//instat-values
+	for (int i = 0; i < _Hyd_Element_Floodplain_Type::number_instat_values; i++) {
+		writer->add_double(values[i]);
+	}
+	//the polygon is given by the element table (see view of the instationary results); the time is given as sql-literal
+	writer->add_literal(time);
+
+	return writer->end_row();
 }
 //Output the maximum calculated values to the database table (erg_table)
 void Hyd_Element_Floodplain::output_maximum_calculated_values(int *id_glob, QSqlQuery *model, QSqlDatabase *ptr_database, const int fp_no, const _hyd_floodplain_geo_info geo_info, const string break_sz){
@@ -3639,15 +3692,7 @@ void Hyd_Element_Floodplain::output_maximum_calculated_values(int *id_glob, QSql
 	query_string << *id_glob << " , " ;
 	this->element_type->set_maximum_value2querystring(&query_string);
 
-	if(this->polygon_string==label::not_set){
-		//set the polgon points
-		Geo_Raster_Polygon poly_buff;
-		poly_buff.set_points(&this->mid_point, geo_info.width_x, geo_info.width_y, geo_info.angle, geo_info.origin_global_x, geo_info.origin_global_y);
-		this->polygon_string=poly_buff.get_polygon2sql_string();
-		query_string << this->polygon_string <<" ) ";
-	}
-	else{
-		query_string << this->polygon_string <<" ) ";	}
+	query_string << _Geo_Polygon::convert_wkb_hex2sql_string(this->get_polygon_wkb_hex(geo_info)) <<" ) ";
 
 	Data_Base::database_request(model, query_string.str(), ptr_database);
 
@@ -4132,6 +4177,16 @@ void Hyd_Element_Floodplain::delete_max_result_row_in_table(QSqlDatabase *ptr_da
 	//query.exec(query_string.str().c_str());
 	Data_Base::database_request(&query, query_string.str(), ptr_database);
 }
+//Get the polygon of the element as hex-string of the well-known binary (WKB); it is generated once and kept for all further outputs
+string Hyd_Element_Floodplain::get_polygon_wkb_hex(const _hyd_floodplain_geo_info geo_info){
+	if(this->polygon_wkb_hex.empty()==true){
+		//set the polgon points
+		Geo_Raster_Polygon poly_buff;
+		poly_buff.set_points(&this->mid_point, geo_info.width_x, geo_info.width_y, geo_info.angle, geo_info.origin_global_x, geo_info.origin_global_y);
+		this->polygon_wkb_hex=poly_buff.get_polygon2wkb_hex();
+	}
+	return this->polygon_wkb_hex;
+}
 //Set warning(s)
 Warning Hyd_Element_Floodplain::set_warning(const int warn_type){
 		string place="Hyd_Element_Floodplain::";
@@ -94,10 +94,10 @@ public:
 	void input_value(const string line_of_file);
 	///Transfer the floodplain element data to a database
 	void transfer_element_members2database(const int glob_elem_id, QSqlQuery *model, QSqlDatabase *ptr_database, const int fp_number, const _hyd_floodplain_geo_info geo_info);
-	///Get a string for transfering the data to database 
-	string get_datastring2database(QSqlDatabase *ptr_database, const int glob_elem_id, const int fp_number, const _hyd_floodplain_geo_info geo_info);
-	///Get the header for inserting the element data to database table (static)
-	static string get_insert_header_data_table(QSqlDatabase *ptr_database);
+	///Add the element data as row to the bulk writer; false is returned, if a sent package failed
+	bool add_data2bulk_writer(Sys_Database_Bulk_Writer *writer, const int glob_elem_id, const int fp_number, const _hyd_floodplain_geo_info geo_info);
+	///Set the table and the columns of the element data to the bulk writer (static)
+	static void set_bulk_writer_data_table(Sys_Database_Bulk_Writer *writer, QSqlDatabase *ptr_database);
 	///Transfer the floodplain element boundary data of an hydraulc boundary scenario to a database
 	void transfer_hydraulic_boundary_sz2database(QSqlDatabase *ptr_database, const int fp_number);
 	///Input the floodplain element data with the index from the selected data set of a database table
@@ -153,6 +153,8 @@ public:
 	static int select_relevant_results_elements_database(QSqlQueryModel *results, QSqlDatabase *ptr_database, const _sys_system_id id, const int fp_number, const int bound_sz, const string break_sz, const int offset, const int number_rows, const bool with_output = true);
 	///Count the number of relevant results per floodplain elements for one floodplain model in a database table
 	static int count_relevant_results_elements_database(QSqlQueryModel *results, QSqlDatabase *ptr_database, const _sys_system_id id, const int fp_number, const int bound_sz, const string break_sz, const bool with_output = true);
+	///Select the relevant results per floodplain elements for one floodplain model in a database table for a row by row reading (columns: id, h_max, vtot_max, dsdt_max, dur_wet, t_first, hv_max, end_vol)
+	static void stream_relevant_results_elements_database(Sys_Database_Stream_Reader *results, QSqlDatabase *ptr_database, const _sys_system_id id, const int fp_number, const int bound_sz, const string break_sz);
 
 	///Select the data in the database table for the maximum results of the river profiles specified by the system id and the scenario-ids (static)
 	static int select_data_in_erg_table(QSqlQueryModel *query, QSqlDatabase *ptr_database, const _sys_system_id id, const int bound_sz, const string break_sz , const bool like_flag);
@@ -174,8 +176,8 @@ public:
 
 	///Close and delete the database table for the results of an hydraulic simulation for the floodplain elements
 	static void close_erg_table(void);
-	///Get the maximum value of the global index of the element result database table
-	static int get_max_glob_id_erg_table(QSqlDatabase *ptr_database);
+	///Reserve a number of global indices for new records in the element result database table; the first index is returned
+	static int reserve_glob_id_erg_table(QSqlDatabase *ptr_database, const int number);
 
 	///Delete all data in the database table for the results of an hydraulic simulation for the floodplain elements
 	static void delete_data_in_erg_table(QSqlDatabase *ptr_database);
@@ -202,14 +204,16 @@ public:
 
 	///Create the database table for the instationary results of an hydraulic simulation for the floodplain elements
 	static void create_erg_instat_table(QSqlDatabase *ptr_database);
-	///Create the database view for the instationary results of an hydraulic simulation for the floodplain elements
-	static void create_erg_instat_view1(QSqlDatabase *ptr_database);
+	///Create the database view for the instationary results of an hydraulic simulation for the floodplain elements joined with the element polygons
+	static void create_erg_instat_view(QSqlDatabase *ptr_database);
+	///Check if the view for the instationary results of the floodplain elements exists already
+	static bool check_erg_instat_view_exists(QSqlDatabase *ptr_database);
 	///Set the database table for the instationary results of an hydraulic simulation for the floodplain elements: it sets the table name and the name of the columns and allocate them
 	static void set_erg_instat_table(QSqlDatabase *ptr_database, const bool not_close = false);
 	///Close and delete the database table for the instationary results of an hydraulic simulation for the floodplain elements
 	static void close_erg_instat_table(void);
-	///Get the maximum value of the global index of the element instationary result database table
-	static int get_max_glob_id_erg_instat_table(QSqlDatabase *ptr_database);
+	///Reserve a number of global indices for new records in the element instationary result database table; the first index is returned
+	static int reserve_glob_id_erg_instat_table(QSqlDatabase *ptr_database, const int number);
 
 	///Select and count the number of relevant instationary results per floodplain elements for one floodplain model in a database table
 	static int select_relevant_instat_results_elements_database(QSqlQueryModel *results, QSqlDatabase *ptr_database, const _sys_system_id id, const int fp_number, const int bound_sz, const string break_sz, const bool with_output = true);
@@ -217,6 +221,8 @@ public:
 	static int select_relevant_instat_results_elements_database(QSqlQueryModel *results, QSqlDatabase *ptr_database, const _sys_system_id id, const int fp_number, const int bound_sz, const string break_sz, const int offset, const int number_rows, const string time_date, const bool with_output = true);
 	///Count the number of relevant instationary results per floodplain elements for one floodplain model in a database table
 	static int count_relevant_instat_results_elements_database(QSqlQueryModel *results, QSqlDatabase *ptr_database, const _sys_system_id id, const int fp_number, const int bound_sz, const string break_sz, const string time_date, const bool with_output = true);
+	///Select the relevant instationary results per floodplain elements for one floodplain model and one time in a database table for a row by row reading (columns: id, h, vtot, dsdt, hv, time)
+	static void stream_relevant_instat_results_elements_database(Sys_Database_Stream_Reader *results, QSqlDatabase *ptr_database, const _sys_system_id id, const int fp_number, const int bound_sz, const string break_sz, const string time_date);
 	///Get a list of dicstinct date-time strings from database table
 	static int get_distinct_date_time_instat_results_elements_database(QStringList *list, QSqlDatabase *ptr_database, const _sys_system_id id,  const int bound_sz, const string break_sz, const bool with_output = true);
 
@@ -285,15 +291,21 @@ public:
 	///Ouput the header for the maximum calculated results output
 	static void output_header_maximum_calculated_values(ostringstream *cout);
 
-	///Get the header for inserting the element result data to database table (static)
-	static string get_insert_header_erg_data_table(QSqlDatabase *ptr_database);
-	///Get a string for transfering the result data to database 
-	string get_datastring_erg2database(const int glob_elem_id, const int fp_number, const _hyd_floodplain_geo_info geo_info, const string break_sz, const bool must_output);
+	///Set the table and the columns of the element result data to the bulk writer (static)
+	static void set_bulk_writer_erg_table(Sys_Database_Bulk_Writer *writer, QSqlDatabase *ptr_database);
+	///Get if the maximum results of the element are output (it was wet or the output is required)
+	bool get_max_result_required(const bool must_output);
+	///Add the element result data as row to the bulk writer; false is returned, if a sent package failed
+	bool add_erg2bulk_writer(Sys_Database_Bulk_Writer *writer, const int glob_elem_id, const int fp_number, const _hyd_floodplain_geo_info geo_info, const string break_sz);
 
-	///Get the header for inserting the element instationary result data to database table (static)
-	static string get_insert_header_erg_instat_data_table(QSqlDatabase *ptr_database);
-	///Get a string for transfering the instationary result data to database 
-	string get_datastring_erg_instat_2database(const int id, const int fp_number, const int elem_id, const string break_sz, const string time, const _hyd_floodplain_geo_info geo_info);
+	///Set the table and the columns of the element instationary result data to the bulk writer (static)
+	static void set_bulk_writer_erg_instat_table(Sys_Database_Bulk_Writer *writer, QSqlDatabase *ptr_database);
+	///Get if the instationary results of the element are output (it was wet or it is the first element)
+	bool get_instat_result_required(const int id);
+	///Get the instationary result values of the element; false is returned, if the element is not output (never wet and not the first element)
+	bool get_instat_result_values(const int id, double *values);
+	///Add the given instationary result values as row to the bulk writer; just the fixed members of the element are used; false is returned, if a sent package failed
+	bool add_erg_instat2bulk_writer(Sys_Database_Bulk_Writer *writer, const int fp_number, const int elem_id, const string break_sz, const string time, const double *values);
 
 
 	///Output the maximum calculated results to the database table (erg_table)
@@ -340,8 +352,8 @@ private:
 	///Read-in buffer of the flow data of the element (_hyd_flowdata_floodplain_elem)
 	_hyd_flowdata_floodplain_elem *buffer_flow_data;
 
-	///Polygon-string for inserting the geometrical data of the element (polygon to database)
-	string polygon_string;
+	///Polygon of the element as hex-string of the well-known binary (WKB) for inserting the geometrical data of the element to database; it is generated once and kept for all further outputs
+	string polygon_wkb_hex;
 
 	//methods
 
@@ -376,6 +388,9 @@ private:
 	///Delete the maximum result row in a database table for this element
 	void delete_max_result_row_in_table(QSqlDatabase *ptr_database, const int fp_no, const string break_sz);
 
+	///Get the polygon of the element as hex-string of the well-known binary (WKB); it is generated once and kept for all further outputs
+	string get_polygon_wkb_hex(const _hyd_floodplain_geo_info geo_info);
+
 	///Set warning(s)
 	Warning set_warning(const int warn_type);
 	///Set error(s)
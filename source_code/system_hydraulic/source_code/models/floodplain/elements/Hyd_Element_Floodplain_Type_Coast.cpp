@@ -79,52 +79,34 @@ bool Hyd_Element_Floodplain_Type_Coast::get_was_wet_flag(void){
 double Hyd_Element_Floodplain_Type_Coast::get_wet_duration(void){
 	return this->wet_duration;
 }
-//Set the maximum result values of an element to an query string to transfer them into a database table (Hyd_Element_Floodplain
-void Hyd_Element_Floodplain_Type_Coast::set_maximum_value2querystring(ostringstream *query_string){
+//Get the maximum result values of an element for the transfer into a database table (Hyd_Element_Floodplain); the array has to have number_maximum_values entries
+void Hyd_Element_Floodplain_Type_Coast::get_maximum_values(double *values){
 	//max-values
-	*query_string << this->max_h_value.maximum << " , " ;
-	*query_string << this->max_h_value.maximum + (*this->z_value)<< " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << this->first_arrival_time << " , " ;
-	*query_string << this->wet_duration << " , " ;
-	*query_string << 0.0 << " , " ;
+	values[0]=this->max_h_value.maximum;
+	values[1]=this->max_h_value.maximum+(*this->z_value);
+	values[2]=0.0;
+	values[3]=0.0;
+	values[4]=0.0;
+	values[5]=0.0;
+	values[6]=0.0;
+	values[7]=this->first_arrival_time;
+	values[8]=this->wet_duration;
+	values[9]=0.0;
 	//volumes
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-
+	for(int i=10; i<_Hyd_Element_Floodplain_Type::number_maximum_values; i++){
+		values[i]=0.0;
+	}
 }
-//Set the instationary result values of an element to an query string to transfer them into a database table (Hyd_Element_Floodplain
-void Hyd_Element_Floodplain_Type_Coast::set_instat_value2querystring(ostringstream *query_string) {
+//Get the instationary result values of an element for the transfer into a database table (Hyd_Element_Floodplain)
+void Hyd_Element_Floodplain_Type_Coast::get_instat_values(double *values) {
 	//instat-values
-	*query_string << this->get_h_value() << " , ";
-	*query_string << this->get_s_value() << " , ";
-	*query_string << 0.0 << " , ";
-	*query_string << 0.0 << " , ";
-	*query_string << 0.0 << " , ";
-	*query_string << 0.0 << " , ";
-	*query_string << 0.0 << " , ";
+	values[0] = this->get_h_value();
+	values[1] = this->get_s_value();
+	values[2] = 0.0;
+	values[3] = 0.0;
+	values[4] = 0.0;
+	values[5] = 0.0;
+	values[6] = 0.0;
 }
 //Reset the hydrological balance value and the maximum values
 void Hyd_Element_Floodplain_Type_Coast::reset_hydrobalance_maxvalues(void){
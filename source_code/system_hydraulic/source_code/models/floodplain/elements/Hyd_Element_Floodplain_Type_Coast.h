@@ -56,10 +56,10 @@ public:
 	bool get_was_wet_flag(void);
 	///Get the duration of overflooding
 	double get_wet_duration(void);
-	///Set the maximum result values of an element to an query string to transfer them into a database table (Hyd_Element_Floodplain
-	void set_maximum_value2querystring(ostringstream *query_string);
-	///Set the instationary result values of an element to an query string to transfer them into a database table (Hyd_Element_Floodplain
-	void set_instat_value2querystring(ostringstream *query_string);
+	///Get the maximum result values of an element for the transfer into a database table (Hyd_Element_Floodplain)
+	void get_maximum_values(double *values);
+	///Get the instationary result values of an element for the transfer into a database table (Hyd_Element_Floodplain)
+	void get_instat_values(double *values);
 
 	///Reset the hydrological balance value and the maximum values
 	void reset_hydrobalance_maxvalues(void);
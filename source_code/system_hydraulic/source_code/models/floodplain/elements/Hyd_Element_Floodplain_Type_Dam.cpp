@@ -47,41 +47,23 @@ void Hyd_Element_Floodplain_Type_Dam::set_max_results_directly(const double wate
 	this->max_hv=waterlevel*max_v;
 	this->wet_duration=duration;
 }
-//Set the maximum result values of an element to an query string to transfer them into a database table (Hyd_Element_Floodplain
-void Hyd_Element_Floodplain_Type_Dam::set_maximum_value2querystring(ostringstream *query_string){
+//Get the maximum result values of an element for the transfer into a database table (Hyd_Element_Floodplain); the array has to have number_maximum_values entries
+void Hyd_Element_Floodplain_Type_Dam::get_maximum_values(double *values){
 	//max-values
-	*query_string << this->max_h_value << " , " ;
-	*query_string << this->max_h_value + (*this->z_value)<< " , " ;
-	*query_string << this->max_ds_dt<< " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << this->max_v_total << " , " ;
-	*query_string << this->max_hv << " , " ;
-	*query_string << -1.0 << " , " ;
-	*query_string << this->wet_duration << " , " ;
-	*query_string << 0.0  << " , " ;
+	values[0]=this->max_h_value;
+	values[1]=this->max_h_value+(*this->z_value);
+	values[2]=this->max_ds_dt;
+	values[3]=0.0;
+	values[4]=0.0;
+	values[5]=this->max_v_total;
+	values[6]=this->max_hv;
+	values[7]=-1.0;
+	values[8]=this->wet_duration;
+	values[9]=0.0;
 	//volumes
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-
+	for(int i=10; i<_Hyd_Element_Floodplain_Type::number_maximum_values; i++){
+		values[i]=0.0;
+	}
 }
 //Get the overall was_wet_flag
 bool Hyd_Element_Floodplain_Type_Dam::get_was_wet_flag(void){
@@ -34,8 +34,8 @@ public:
 	///Set the maximum results values directly
 	void set_max_results_directly(const double waterlevel, const double max_v, const double duration, const double dh_dt);
 
-	///Set the maximum result values of an element to an query string to transfer them into a database table (Hyd_Element_Floodplain
-	void set_maximum_value2querystring(ostringstream *query_string);
+	///Get the maximum result values of an element for the transfer into a database table (Hyd_Element_Floodplain)
+	void get_maximum_values(double *values);
 
 	///Get the overall was_wet_flag
 	bool get_was_wet_flag(void);
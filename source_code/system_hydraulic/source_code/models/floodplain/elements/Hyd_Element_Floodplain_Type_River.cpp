@@ -149,52 +149,34 @@ bool Hyd_Element_Floodplain_Type_River::get_was_wet_flag(void){
 double Hyd_Element_Floodplain_Type_River::get_wet_duration(void){
 	return this->wet_duration;
 }
-//Set the maximum result values of an element to an query string to transfer them into a database table (Hyd_Element_Floodplain
-void Hyd_Element_Floodplain_Type_River::set_maximum_value2querystring(ostringstream *query_string){
+//Get the maximum result values of an element for the transfer into a database table (Hyd_Element_Floodplain); the array has to have number_maximum_values entries
+void Hyd_Element_Floodplain_Type_River::get_maximum_values(double *values){
 	//max-values
-	*query_string << this->max_h_value.maximum << " , " ;
-	*query_string << this->max_h_value.maximum + (*this->z_value)<< " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << this->time_wet_start << " , " ;
-	*query_string << this->wet_duration << " , " ;
-	*query_string << this->h_value*(*this->x_width)*(*this->y_width)  << " , " ;
+	values[0]=this->max_h_value.maximum;
+	values[1]=this->max_h_value.maximum+(*this->z_value);
+	values[2]=0.0;
+	values[3]=0.0;
+	values[4]=0.0;
+	values[5]=0.0;
+	values[6]=0.0;
+	values[7]=this->time_wet_start;
+	values[8]=this->wet_duration;
+	values[9]=this->h_value*(*this->x_width)*(*this->y_width);
 	//volumes
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	
+	for(int i=10; i<_Hyd_Element_Floodplain_Type::number_maximum_values; i++){
+		values[i]=0.0;
+	}
 }
-//Set the instationary result values of an element to an query string to transfer them into a database table (Hyd_Element_Floodplain
-void Hyd_Element_Floodplain_Type_River::set_instat_value2querystring(ostringstream *query_string) {
+//Get the instationary result values of an element for the transfer into a database table (Hyd_Element_Floodplain)
+void Hyd_Element_Floodplain_Type_River::get_instat_values(double *values) {
 	//instat-values
-	*query_string << this->get_h_value() << " , ";
-	*query_string << this->get_s_value() << " , ";
-	*query_string << 0.0 << " , ";
-	*query_string << 0.0 << " , ";
-	*query_string << 0.0 << " , ";
-	*query_string << 0.0 << " , ";
-	*query_string << 0.0 << " , ";
+	values[0] = this->get_h_value();
+	values[1] = this->get_s_value();
+	values[2] = 0.0;
+	values[3] = 0.0;
+	values[4] = 0.0;
+	values[5] = 0.0;
+	values[6] = 0.0;
 }
 //Reset the hydrological balance value and the maximum values
 void Hyd_Element_Floodplain_Type_River::reset_hydrobalance_maxvalues(void){
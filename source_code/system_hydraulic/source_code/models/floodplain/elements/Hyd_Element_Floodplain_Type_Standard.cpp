@@ -702,79 +702,57 @@ void Hyd_Element_Floodplain_Type_Standard::add_coupling_discharge_rv_direct(cons
 	}
 	this->coup_mem->coupling_q_rv_direct=this->coup_mem->coupling_q_rv_direct+discharge;
 }
-//Set the maximum result values of an element to an query string to transfer them into a database table (Hyd_Element_Floodplain
-void Hyd_Element_Floodplain_Type_Standard::set_maximum_value2querystring(ostringstream *query_string){
+//Get the maximum result values of an element for the transfer into a database table (Hyd_Element_Floodplain); the array has to have number_maximum_values entries
+void Hyd_Element_Floodplain_Type_Standard::get_maximum_values(double *values){
 	//max-values
-	*query_string << this->max_h_value.maximum << " , " ;
-	*query_string << this->max_h_value.maximum + (*this->z_value)<< " , " ;
-	*query_string << this->max_ds_dt.maximum<< " , " ;
-	*query_string << this->max_v_x.maximum << " , " ;
-	*query_string << this->max_v_y.maximum << " , " ;
-	*query_string << this->max_v_total.maximum << " , " ;
-	*query_string << this->max_hv.maximum << " , " ;
-	*query_string << this->first_arrival_time << " , " ;
-	*query_string << this->wet_duration << " , " ;
-	*query_string << this->watervolume  << " , " ;
+	values[0]=this->max_h_value.maximum;
+	values[1]=this->max_h_value.maximum+(*this->z_value);
+	values[2]=this->max_ds_dt.maximum;
+	values[3]=this->max_v_x.maximum;
+	values[4]=this->max_v_y.maximum;
+	values[5]=this->max_v_total.maximum;
+	values[6]=this->max_hv.maximum;
+	values[7]=this->first_arrival_time;
+	values[8]=this->wet_duration;
+	values[9]=this->watervolume;
 	//volumes
-	if(this->boundary_flag==true){
-		*query_string << this->bound_mem->boundary_volume.volume_in << " , " ;
-		*query_string << this->bound_mem->boundary_volume.volume_out << " , " ;
+	for(int i=10; i<_Hyd_Element_Floodplain_Type::number_maximum_values; i++){
+		values[i]=0.0;
 	}
-	else{
-		*query_string << 0.0 << " , " ;
-		*query_string << 0.0 << " , " ;
+	if(this->boundary_flag==true){
+		values[10]=this->bound_mem->boundary_volume.volume_in;
+		values[11]=this->bound_mem->boundary_volume.volume_out;
 	}
 	if(this->coupling_flag==true){
-		*query_string << this->coup_mem->coupling_volume_structure_rv.volume_in << " , " ;
-		*query_string << this->coup_mem->coupling_volume_structure_rv.volume_out << " , " ;
-		*query_string << this->coup_mem->coupling_volume_direct_rv.volume_in << " , " ;
-		*query_string << this->coup_mem->coupling_volume_direct_rv.volume_out << " , " ;
-
-		*query_string << this->coup_mem->coupling_volume_overflow_rv.volume_in << " , " ;
-		*query_string << this->coup_mem->coupling_volume_overflow_rv.volume_out << " , " ;
-		*query_string << this->coup_mem->coupling_volume_dikebreak_rv.volume_in << " , " ;
-		*query_string <<this->coup_mem->coupling_volume_dikebreak_rv.volume_out << " , " ;
-
-		*query_string << this->coup_mem->coupling_volume_overflow_co.volume_in << " , " ;
-		*query_string << this->coup_mem->coupling_volume_overflow_co.volume_out << " , " ;
-		*query_string << this->coup_mem->coupling_volume_dikebreak_co.volume_in << " , " ;
-		*query_string << this->coup_mem->coupling_volume_dikebreak_co.volume_out << " , " ;
+		values[12]=this->coup_mem->coupling_volume_structure_rv.volume_in;
+		values[13]=this->coup_mem->coupling_volume_structure_rv.volume_out;
+		values[14]=this->coup_mem->coupling_volume_direct_rv.volume_in;
+		values[15]=this->coup_mem->coupling_volume_direct_rv.volume_out;
 
-		*query_string << this->coup_mem->coupling_volume_fp.volume_in << " , " ;
-		*query_string << this->coup_mem->coupling_volume_fp.volume_out << " , " ;
-	}
-	else{
-		*query_string << 0.0 << " , " ;
-		*query_string << 0.0  << " , " ;
-		*query_string << 0.0  << " , " ;
-		*query_string << 0.0  << " , " ;
-
-		*query_string << 0.0  << " , " ;
-		*query_string << 0.0  << " , " ;
-		*query_string << 0.0  << " , " ;
-		*query_string << 0.0  << " , " ;
+		values[16]=this->coup_mem->coupling_volume_overflow_rv.volume_in;
+		values[17]=this->coup_mem->coupling_volume_overflow_rv.volume_out;
+		values[18]=this->coup_mem->coupling_volume_dikebreak_rv.volume_in;
+		values[19]=this->coup_mem->coupling_volume_dikebreak_rv.volume_out;
 
-		*query_string << 0.0  << " , " ;
-		*query_string << 0.0  << " , " ;
-		*query_string << 0.0  << " , " ;
-		*query_string << 0.0 << " , " ;
-
-		*query_string << 0.0  << " , " ;
-		*query_string << 0.0  << " , " ;
+		values[20]=this->coup_mem->coupling_volume_overflow_co.volume_in;
+		values[21]=this->coup_mem->coupling_volume_overflow_co.volume_out;
+		values[22]=this->coup_mem->coupling_volume_dikebreak_co.volume_in;
+		values[23]=this->coup_mem->coupling_volume_dikebreak_co.volume_out;
 
+		values[24]=this->coup_mem->coupling_volume_fp.volume_in;
+		values[25]=this->coup_mem->coupling_volume_fp.volume_out;
 	}
-	
 }
-//Set the instationary result values of an element to an query string to transfer them into a database table (Hyd_Element_Floodplain
-void Hyd_Element_Floodplain_Type_Standard::set_instat_value2querystring(ostringstream *query_string) {
+//Get the instationary result values of an element for the transfer into a database table (Hyd_Element_Floodplain)
+void Hyd_Element_Floodplain_Type_Standard::get_instat_values(double *values) {
 	//instat-values
-	*query_string << this->get_h_value()<< " , ";
-	*query_string << this->get_s_value() << " , ";
-	*query_string << this->get_ds2dt_value() << " , ";
-	*query_string << this->get_flowvelocity_vx_out() << " , ";
-	*query_string << this->get_flowvelocity_vy_out() << " , ";
-	*query_string << this->get_flowvelocity_vtotal() << " , ";
-	*query_string << this->get_h_value() *this->get_flowvelocity_vtotal() << " , ";
+	values[0] = this->get_h_value();
+	values[1] = this->get_s_value();
+	values[2] = this->get_ds2dt_value();
+	values[3] = this->get_flowvelocity_vx_out();
+	values[4] = this->get_flowvelocity_vy_out();
+	values[5] = this->get_flowvelocity_vtotal();
+	values[6] = this->get_h_value() *this->get_flowvelocity_vtotal();
 }
 //Reset the hydrological balance value and the maximum values
 void Hyd_Element_Floodplain_Type_Standard::reset_hydrobalance_maxvalues(void){
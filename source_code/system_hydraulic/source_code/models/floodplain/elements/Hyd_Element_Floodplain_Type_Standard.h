@@ -201,11 +201,11 @@ public:
 	///Add coupling discharge, which comming from a coupled river model directly from the outflow profile (coupling_q_rv_direct)
 	void add_coupling_discharge_rv_direct(const double discharge);
 
-	///Set the maximum result values of an element to an query string to transfer them into a database table (Hyd_Element_Floodplain
-	void set_maximum_value2querystring(ostringstream *query_string);
+	///Get the maximum result values of an element for the transfer into a database table (Hyd_Element_Floodplain)
+	void get_maximum_values(double *values);
 
-	///Set the instationary result values of an element to an query string to transfer them into a database table (Hyd_Element_Floodplain
-	void set_instat_value2querystring(ostringstream *query_string);
+	///Get the instationary result values of an element for the transfer into a database table (Hyd_Element_Floodplain)
+	void get_instat_values(double *values);
 
 
 	///Reset the hydrological balance value and the maximum values
@@ -79,21 +79,13 @@ void Hyd_Floodplainraster_Polygon::is_intercepted_polygon(Hyd_Floodplain_Polygon
 void Hyd_Floodplainraster_Polygon::calculate_polysegment_interception(Geo_Interception_Point_List *intercept_list, Geo_Polysegment *check_polysegment){
 	int number=intercept_list->get_number_points();
 	_Geo_Polygon::calculate_polysegment_interception(intercept_list, check_polysegment);
-	
-	for (int i=intercept_list->get_number_points(); i> number; i--){
-		//the first point of the segment is hit; transfer it to the raster point index
-		if(intercept_list->get_point(i-1).index_point_is_intercepted==0){
-			intercept_list->change_point_index_is_intercepted(i-1,this->segments[intercept_list->get_point(i-1).index_is_intercept].get_firstpoint_index());
-		}
-		//the second point of the segment is hit; transfer it to the raster point index
-		else if(intercept_list->get_point(i-1).index_point_is_intercepted==1){
-			intercept_list->change_point_index_is_intercepted(i-1,this->segments[intercept_list->get_point(i-1).index_is_intercept].get_secondpoint_index());
-
-		}
-		//transfer the segment index to the raster segment index
-		intercept_list->change_index_is_intercepted(i-1,this->segments[intercept_list->get_point(i-1).index_is_intercept].get_segment_index());
-	
-	}
+	this->transfer_interception_indices2raster(intercept_list, number);
+}
+//Calculate the interception points with selected segments of a Geo_Poly_Segment and fill the Geo_Interception_Point_List 
+void Hyd_Floodplainraster_Polygon::calculate_polysegment_interception(Geo_Interception_Point_List *intercept_list, Geo_Polysegment *check_polysegment, const int *segment_index, const int number_index){
+	int number=intercept_list->get_number_points();
+	_Geo_Polygon::calculate_polysegment_interception(intercept_list, check_polysegment, segment_index, number_index);
+	this->transfer_interception_indices2raster(intercept_list, number);
 }
 
 //output members
@@ -125,3 +117,20 @@ void Hyd_Floodplainraster_Polygon::sort_points(void){
 		}
 	}
 }
+//Transfer the polygon segment/point indices of the new interception points (beginning with the given number) to the raster segment/point indices
+void Hyd_Floodplainraster_Polygon::transfer_interception_indices2raster(Geo_Interception_Point_List *intercept_list, const int number){
+	for (int i=intercept_list->get_number_points(); i> number; i--){
+		//the first point of the segment is hit; transfer it to the raster point index
+		if(intercept_list->get_point(i-1).index_point_is_intercepted==0){
+			intercept_list->change_point_index_is_intercepted(i-1,this->segments[intercept_list->get_point(i-1).index_is_intercept].get_firstpoint_index());
+		}
+		//the second point of the segment is hit; transfer it to the raster point index
+		else if(intercept_list->get_point(i-1).index_point_is_intercepted==1){
+			intercept_list->change_point_index_is_intercepted(i-1,this->segments[intercept_list->get_point(i-1).index_is_intercept].get_secondpoint_index());
+
+		}
+		//transfer the segment index to the raster segment index
+		intercept_list->change_index_is_intercepted(i-1,this->segments[intercept_list->get_point(i-1).index_is_intercept].get_segment_index());
+	
+	}
+}
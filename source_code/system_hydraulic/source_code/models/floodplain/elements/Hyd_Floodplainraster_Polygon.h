@@ -51,6 +51,8 @@ public:
 
 	///Calculate the interception points with a Geo_Poly_Segment and fill the Geo_Interception_Point_List 
 	void calculate_polysegment_interception(Geo_Interception_Point_List *intercept_list, Geo_Polysegment *check_polysegment);
+	///Calculate the interception points with selected segments of a Geo_Poly_Segment and fill the Geo_Interception_Point_List 
+	void calculate_polysegment_interception(Geo_Interception_Point_List *intercept_list, Geo_Polysegment *check_polysegment, const int *segment_index, const int number_index);
 	
 	///Assign dikeline values to the raster
 	void assign_values2raster(Hyd_Floodplain_Polysegment *dikeline);
@@ -81,6 +83,8 @@ private:
 	//method
 	///Sort the points
 	void sort_points(void);
+	///Transfer the polygon segment/point indices of the new interception points (beginning with the given number) to the raster segment/point indices
+	void transfer_interception_indices2raster(Geo_Interception_Point_List *intercept_list, const int number);
 
 
 };
@@ -373,50 +373,27 @@ void _Hyd_Element_Floodplain_Type::add_coupling_discharge_rv_direct(const double
 }
 //Set the maximum result values of an element to an query string to transfer them into a database table (Hyd_Element_Floodplain
 void _Hyd_Element_Floodplain_Type::set_maximum_value2querystring(ostringstream *query_string){
+	double values[_Hyd_Element_Floodplain_Type::number_maximum_values];
+	this->get_maximum_values(values);
+	for(int i=0; i<_Hyd_Element_Floodplain_Type::number_maximum_values; i++){
+		*query_string << values[i] << " , " ;
+	}
+}
+//Get the maximum result values of an element for the transfer into a database table (Hyd_Element_Floodplain); the array has to have number_maximum_values entries
+void _Hyd_Element_Floodplain_Type::get_maximum_values(double *values){
+	for(int i=0; i<_Hyd_Element_Floodplain_Type::number_maximum_values; i++){
+		values[i]=0.0;
+	}
 	//max-values
-	*query_string << 0.0 << " , " ;
-	*query_string << (*this->z_value) << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << -1.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	//volumes
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-
-	*query_string << 0.0 << " , " ;
-	*query_string << 0.0 << " , " ;
-
-}
-///Set the instationary result values of an element to an query string to transfer them into a database table (Hyd_Element_Floodplain)
-void _Hyd_Element_Floodplain_Type::set_instat_value2querystring(ostringstream *query_string) {
+	values[1]=(*this->z_value);
+	values[7]=-1.0;
+}
+//Get the instationary result values of an element for the transfer into a database table (Hyd_Element_Floodplain); the array has to have number_instat_values entries
+void _Hyd_Element_Floodplain_Type::get_instat_values(double *values) {
 	//instat-values
-	*query_string << 0.0 << " , ";
-	*query_string << 0.0 << " , ";
-	*query_string << 0.0 << " , ";
-	*query_string << 0.0 << " , ";
-	*query_string << 0.0 << " , ";
-	*query_string << 0.0 << " , ";
-	*query_string << 0.0 << " , ";
+	for (int i = 0; i < _Hyd_Element_Floodplain_Type::number_instat_values; i++) {
+		values[i] = 0.0;
+	}
 }
 //Get the next _hyd_all_element_direction to the given direction counterclockwise (static)
 _hyd_all_element_direction _Hyd_Element_Floodplain_Type::get_next_element_direction_counterclockwise(const _hyd_all_element_direction dir){
@@ -107,6 +107,12 @@ public:
 	///Default destructor
 	virtual ~_Hyd_Element_Floodplain_Type(void);
 
+	//members
+	///Number of the instationary result values of an element (h, s, ds/dt, vx, vy, vtot, h*vtot)
+	static const int number_instat_values=7;
+	///Number of the maximum result values of an element (see get_maximum_values(double *values))
+	static const int number_maximum_values=26;
+
 	//method
 
 	///Initialize the element (call it backward: not from the origin; start at the diagonal corner of the origin)
@@ -282,10 +288,12 @@ public:
 	virtual void add_coupling_discharge_rv_direct(const double discharge);
 
 	///Set the maximum result values of an element to an query string to transfer them into a database table (Hyd_Element_Floodplain
-	virtual void set_maximum_value2querystring(ostringstream *query_string);
+	void set_maximum_value2querystring(ostringstream *query_string);
+	///Get the maximum result values of an element for the transfer into a database table (Hyd_Element_Floodplain); the array has to have number_maximum_values entries
+	virtual void get_maximum_values(double *values);
 
-	///Set the instationary result values of an element to an query string to transfer them into a database table (Hyd_Element_Floodplain)
-	virtual void set_instat_value2querystring(ostringstream *query_string);
+	///Get the instationary result values of an element for the transfer into a database table (Hyd_Element_Floodplain); the array has to have number_instat_values entries
+	virtual void get_instat_values(double *values);
 
 	///Get the next _hyd_all_element_direction to the given direction counterclockwise
 	static _hyd_all_element_direction get_next_element_direction_counterclockwise(const _hyd_all_element_direction dir);
@@ -55,6 +55,14 @@ Hyd_Model_River::Hyd_Model_River(void){
 	this->list_part_profiles=NULL;
 	this->number_part_profiles=0;
 
+	this->table_profile_types=NULL;
+	this->standard_flow_profiles=NULL;
+	this->number_standard_flow_profiles=0;
+	this->special_flow_profiles=NULL;
+	this->number_special_flow_profiles=0;
+	this->segment_half_length=NULL;
+	this->binary_record=NULL;
+
 	this->min_width = -1.0;
 	this->max_width = -1.0;
 
@@ -65,11 +73,13 @@ Hyd_Model_River::Hyd_Model_River(void){
 //destructor
 Hyd_Model_River::~Hyd_Model_River(void){
 	this->delete_part_profile_list();
+	this->delete_solver_profile_lists();
 	if(this->river_profiles!=NULL){
 		delete []this->river_profiles;
 		this->river_profiles=NULL;
 	}
 	this->close_tecplot_output();
+	this->close_binary_output();
 
 
 	//count the memory
@@ -686,19 +696,63 @@ void Hyd_Model_River::init_river_model(Hyd_Param_Material *material_table){
 		//init the first profile
 		this->inflow_river_profile.init_profile(material_table, this->Param_RV.user_setting);
 		//this->inflow_river_profile.typ_of_profile->output_tables();
-		//init the profiles
-		for(int i=0; i< this->Param_RV.RVNofProf-2; i++){
-
-			if(i%50==0 && i>0){
-				cout << "Initialise profiles "<< i+1 <<" to " << i+50 <<"..."<< endl;
-				Sys_Common_Output::output_hyd->output_txt(&cout);
+		//init the profiles; the tables of the profiles are independent from each other and are generated in parallel
+		const int number_profiles=this->Param_RV.RVNofProf-2;
+		if(number_profiles>0){
+			cout << "Initialise profiles 1 to " << number_profiles <<"..."<< endl;
+			Sys_Common_Output::output_hyd->output_txt(&cout);
+		}
+		Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
+		//the warnings are collected per profile and the error of the first failed profile is kept; they are output after the loop
+		int failed_profile=number_profiles;
+		Error failed_msg;
+		vector< vector<Warning> > profile_warnings(max(number_profiles, 0));
+		#pragma omp parallel for schedule(dynamic) if(number_profiles>=constant::min_profiles_parallel_tables)
+		for(int i=0; i< number_profiles; i++){
+			Error msg;
+			bool error_flag=false;
+			try{
+				this->river_profiles[i].init_profile(material_table, this->Param_RV.user_setting, false, &profile_warnings[i]);
+				//this->river_profiles[i].typ_of_profile->output_tables();
 			}
-
-			Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
-			
-			this->river_profiles[i].init_profile(material_table, this->Param_RV.user_setting);
-			//this->river_profiles[i].typ_of_profile->output_tables();
+			catch(Error msg_profile){
+				msg=msg_profile;
+				error_flag=true;
+			}
+			catch(bad_alloc &t){
+				msg=this->set_error(29);
+				ostringstream info;
+				info<< "Info bad alloc: " << t.what() << endl;
+				info << "Profile number: " << this->river_profiles[i].get_profile_number() << endl;
+				msg.make_second_info(info.str());
+				error_flag=true;
+			}
+			catch(...){
+				msg=this->set_error(30);
+				ostringstream info;
+				info << "Profile number: " << this->river_profiles[i].get_profile_number() << endl;
+				msg.make_second_info(info.str());
+				error_flag=true;
+			}
+			if(error_flag==true){
+				#pragma omp critical
+				{
+					if(i<failed_profile){
+						failed_profile=i;
+						failed_msg=msg;
+					}
+				}
+			}
+		}
+		for(int i=0; i< number_profiles; i++){
+			for(int j=0; j<(int)profile_warnings[i].size(); j++){
+				profile_warnings[i][j].output_msg(2);
+			}
+		}
+		if(failed_profile<number_profiles){
+			throw failed_msg;
 		}
+		Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
 		//init the last profile
 		this->outflow_river_profile.init_profile(material_table, this->Param_RV.user_setting);
 
@@ -1600,6 +1654,35 @@ void Hyd_Model_River::output_result2csv_1d(const double timepoint, const int tim
 		output_csv.close();
 	}
 }
+//Append the result members per timestep to the binary result time series as 1d
+void Hyd_Model_River::output_result2binary_1d(const double timepoint){
+/**One record per output time step is appended to the file: the time point followed by the columns of
+the global waterlevel s, the local waterlevel h, the flow velocity v, the discharge q and the width, each
+with one value per profile from the inflow to the outflow profile. All records have the same size, thus
+a reader can map the file and access a time step or a profile series directly.
+*/
+	if(this->binary_output.is_open()==false){
+		this->init_binary_output();
+	}
+	if(this->binary_output.is_open()==false){
+		return;
+	}
+	const int number=this->Param_RV.RVNofProf;
+	_Hyd_River_Profile *profile=NULL;
+	this->binary_record[0]=timepoint;
+	for(int i=0; i<number; i++){
+		profile=this->get_ptr_river_profile(i);
+		this->binary_record[1+i]=profile->typ_of_profile->get_actual_global_waterlevel();
+		this->binary_record[1+number+i]=profile->typ_of_profile->get_actual_local_waterlevel_h();
+		this->binary_record[1+2*number+i]=profile->typ_of_profile->get_actual_flow_velocity();
+		this->binary_record[1+4*number+i]=profile->typ_of_profile->get_width();
+	}
+	//the discharge is taken after the velocity: the inflow profile sets its velocity by the discharge
+	for(int i=0; i<number; i++){
+		this->binary_record[1+3*number+i]=this->get_ptr_river_profile(i)->get_actual_river_discharge();
+	}
+	this->binary_output.write((const char*)this->binary_record, sizeof(double)*(1+5*number));
+}
 //Output the result members per timestep to paraview as 2d
 void Hyd_Model_River::output_result2paraview_2d(const double timepoint, const int timestep_number) {
 
@@ -1759,7 +1842,8 @@ void Hyd_Model_River::output_result2database_2d(QSqlDatabase *ptr_database, cons
 	catch (Error msg) {
 		throw msg;
 	}
-	int glob_id = _Hyd_River_Profile::erg_instat_table->maximum_int_of_column(_Hyd_River_Profile::erg_instat_table->get_column_name(label::glob_id), ptr_database) + 1;
+	//reserve the global identifiers for the inflow, the inbetween and the outflow profiles
+	int glob_id = _Hyd_River_Profile::erg_instat_table->reserve_int_of_column(_Hyd_River_Profile::erg_instat_table->get_column_name(label::glob_id), ptr_database, this->number_inbetween_profiles + 2);
 
 	//polygon string
 	string poly_buffer;
@@ -1901,6 +1985,69 @@ void Hyd_Model_River::output_result_max2csv(void) {
 	}
 
 }
+//Output the maximum result members to a binary file as 1d; the binary result time series is closed
+void Hyd_Model_River::output_result_max2binary(void){
+/**The columns are s_max, t(s_max), h_max, t(h_max), v_max, t(v_max), width_max, t(width_max), q_max and t(q_max),
+each with one value per profile from the inflow to the outflow profile.
+*/
+	this->close_binary_output();
+	if(this->Param_RV.tecplot_outfile_name_1d==label::not_set){
+		return;
+	}
+	string buffer=this->Param_RV.get_filename_result2file_1d_maxvalues(hyd_label::binary);
+	buffer += hyd_label::bin;
+	ofstream output;
+	output.open(buffer.c_str(), ios_base::out|ios_base::binary|ios_base::trunc);
+	if(output.is_open()==false){
+		Error msg=this->set_error(27);
+		ostringstream info;
+		info << "File name " << buffer << endl;
+		msg.make_second_info(info.str());
+		throw msg;
+	}
+	const int number=this->Param_RV.RVNofProf;
+	const int number_series=10;
+	double *column=NULL;
+	try{
+		column=new double[2*number];
+	}
+	catch(bad_alloc &t){
+		Error msg=this->set_error(28);
+		ostringstream info;
+		info<< "Info bad alloc: " << t.what() << endl;
+		msg.make_second_info(info.str());
+		throw msg;
+	}
+	this->output_binary_header(&output, number_series);
+	_hyd_max_values max_value;
+	_Hyd_River_Profile *profile=NULL;
+	//one maximum column and one time point column per value type
+	for(int j=0; j<number_series/2; j++){
+		for(int i=0; i<number; i++){
+			profile=this->get_ptr_river_profile(i);
+			if(j==0){
+				max_value=profile->typ_of_profile->get_max_s();
+			}
+			else if(j==1){
+				max_value=profile->typ_of_profile->get_max_h();
+			}
+			else if(j==2){
+				max_value=profile->typ_of_profile->get_max_vtot();
+			}
+			else if(j==3){
+				max_value=profile->typ_of_profile->get_max_width();
+			}
+			else{
+				max_value=profile->get_max_q();
+			}
+			column[i]=max_value.maximum;
+			column[number+i]=max_value.time_point;
+		}
+		output.write((const char*)column, sizeof(double)*2*number);
+	}
+	delete []column;
+	output.close();
+}
 //Output the maximum result members to paraview as 2d
 void Hyd_Model_River::output_result_max2paraview2d(void) {
 	//get the file name
@@ -2222,6 +2369,7 @@ void Hyd_Model_River::reset_model(Hyd_Param_Global *global_params){
 	this->warn_counter=0;
 	this->tol_reduce_counter=0;
 	this->close_tecplot_output();
+	this->close_binary_output();
 	this->change_abs_tol=this->setted_abs_tol;
 	this->change_rel_tol=this->setted_rel_tol;
 
@@ -2421,6 +2569,11 @@ void Hyd_Model_River::reset_solver(void){
 //solve_model
 void Hyd_Model_River::solve_model(const double next_time_point, const string system_id){
 	try{
+		//the boundary and coupling discharges are constant during the solver step
+		this->inflow_river_profile.sum_boundary_coupling_discharge();
+		for(int i=0; i < this->number_inbetween_profiles; i++){
+			this->river_profiles[i].sum_boundary_coupling_discharge();
+		}
 		//run the solver
 		this->run_solver(next_time_point, system_id);
 
@@ -2948,6 +3101,71 @@ void Hyd_Model_River::delete_part_profile_list(void){
 		this->list_part_profiles=NULL;
 	}
 }
+//Allocate and set the flat profile lists used in the solver function
+void Hyd_Model_River::allocate_solver_profile_lists(void){
+	this->delete_solver_profile_lists();
+	try{
+		this->table_profile_types=new Hyd_River_Profile_Type_Standard*[this->number_inbetween_profiles];
+		this->standard_flow_profiles=new int[this->number_inbetween_profiles];
+		this->special_flow_profiles=new int[this->number_inbetween_profiles];
+		this->segment_half_length=new double[this->number_inbetween_profiles+1];
+		//count the memory
+		Sys_Memory_Count::self()->add_mem((sizeof(Hyd_River_Profile_Type_Standard*)+sizeof(int)*2+sizeof(double))*this->number_inbetween_profiles+sizeof(double), _sys_system_modules::HYD_SYS);
+	}
+	catch(bad_alloc &t){
+		Error msg=this->set_error(26);
+		ostringstream info;
+		info<< "Info bad alloc: " << t.what() << endl;
+		msg.make_second_info(info.str());
+		throw msg;
+	}
+
+	//weir profiles have their own table handling
+	for(int i=0; i<this->number_inbetween_profiles; i++){
+		if(this->river_profiles[i].get_profile_type()==_hyd_profile_types::WEIR_TYPE){
+			this->table_profile_types[i]=NULL;
+		}
+		else{
+			this->table_profile_types[i]=(Hyd_River_Profile_Type_Standard*)this->river_profiles[i].typ_of_profile;
+		}
+	}
+
+	//the first and the last inbetween profile are calculated separately in the solver function
+	this->number_standard_flow_profiles=0;
+	this->number_special_flow_profiles=0;
+	for(int i=1; i<this->number_inbetween_profiles-1; i++){
+		if(this->river_profiles[i].get_profile_type()==_hyd_profile_types::RIVER_TYPE && this->river_profiles[i-1].get_profile_type()==_hyd_profile_types::RIVER_TYPE){
+			this->standard_flow_profiles[this->number_standard_flow_profiles]=i;
+			this->number_standard_flow_profiles++;
+		}
+		else{
+			this->special_flow_profiles[this->number_special_flow_profiles]=i;
+			this->number_special_flow_profiles++;
+		}
+	}
+
+	this->segment_half_length[0]=this->inflow_river_profile.get_distance2downstream()*0.5;
+	for(int i=0; i<this->number_inbetween_profiles; i++){
+		this->segment_half_length[i+1]=(this->river_profiles[i].get_distance2upstream()+this->river_profiles[i].get_distance2downstream())*0.5;
+	}
+}
+//Delete the flat profile lists used in the solver function
+void Hyd_Model_River::delete_solver_profile_lists(void){
+	if(this->table_profile_types!=NULL){
+		delete []this->table_profile_types;
+		this->table_profile_types=NULL;
+		delete []this->standard_flow_profiles;
+		this->standard_flow_profiles=NULL;
+		delete []this->special_flow_profiles;
+		this->special_flow_profiles=NULL;
+		delete []this->segment_half_length;
+		this->segment_half_length=NULL;
+		//count the memory
+		Sys_Memory_Count::self()->minus_mem((sizeof(Hyd_River_Profile_Type_Standard*)+sizeof(int)*2+sizeof(double))*this->number_inbetween_profiles+sizeof(double), _sys_system_modules::HYD_SYS);
+	}
+	this->number_standard_flow_profiles=0;
+	this->number_special_flow_profiles=0;
+}
 //Set the list of the pointer of a part of the river profiles by two given profiles
 void Hyd_Model_River::set_part_profile_list(_Hyd_River_Profile *up, _Hyd_River_Profile *down){
 	this->delete_part_profile_list();
@@ -3656,6 +3874,8 @@ void Hyd_Model_River::set_function2solver(void){
 	//The function CVodeMalloc provides required problem and solution speci�cations, allocates internal memory, and initializes cvode.
 	flag = CVodeInit(this->cvode_mem, f1D_equation2solve, 0.0, this->results);
 
+	//set the flat profile lists for the function
+	this->allocate_solver_profile_lists();
 		
 	this->setted_rel_tol=this->Param_RV.get_relative_solver_tolerance();
 	this->setted_abs_tol=*(this->Param_RV.get_absolute_solver_tolerance());
@@ -3692,6 +3912,20 @@ void Hyd_Model_River::set_function2solver(void){
 		throw msg;
 	}
 }
+//Initialize the linear solver; the direct band solver is used, if it is set in the river parameters
+void Hyd_Model_River::init_linear_solver(Hyd_Param_Global *global_params){
+	if(this->Param_RV.get_direct_solver_flag()==false){
+		_Hyd_Model::init_linear_solver(global_params);
+		return;
+	}
+	//the analytical Jacobian is just given for standard profiles; weirs and bridges use the difference quotient Jacobian of the solver
+	if(this->number_weir_profiles==0 && this->number_bridge_profiles==0){
+		this->init_band_solver(f1D_band_jacobian);
+	}
+	else{
+		this->init_band_solver(NULL);
+	}
+}
 //output final statistics of the solver
 void Hyd_Model_River::output_solver_statistics(void){
 	//set prefix for output
@@ -3768,6 +4002,68 @@ void Hyd_Model_River::init_tecplot_output(void){
 		}
 	}
 }
+//Initialize the output file for the binary result time series
+void Hyd_Model_River::init_binary_output(void){
+	if(this->Param_RV.tecplot_outfile_name_1d==label::not_set || this->binary_output.is_open()==true){
+		return;
+	}
+	try{
+		this->binary_record=new double[1+5*this->Param_RV.RVNofProf];
+		Sys_Memory_Count::self()->add_mem(sizeof(double)*(1+5*this->Param_RV.RVNofProf), _sys_system_modules::HYD_SYS);
+	}
+	catch(bad_alloc &t){
+		Error msg=this->set_error(28);
+		ostringstream info;
+		info<< "Info bad alloc: " << t.what() << endl;
+		msg.make_second_info(info.str());
+		throw msg;
+	}
+	//open the file
+	string buffer=this->Param_RV.get_filename_result2file_1d(hyd_label::binary);
+	buffer += hyd_label::bin;
+	this->binary_output.open(buffer.c_str(), ios_base::out|ios_base::binary|ios_base::trunc);
+	if(this->binary_output.is_open()==false){
+		this->close_binary_output();
+		Error msg=this->set_error(27);
+		ostringstream info;
+		info << "File name " << buffer << endl;
+		msg.make_second_info(info.str());
+		throw msg;
+	}
+	this->output_binary_header(&this->binary_output, 5);
+}
+//Close the output file for the binary result time series
+void Hyd_Model_River::close_binary_output(void){
+	if(this->binary_output.is_open()==true){
+		this->binary_output.close();
+	}
+	this->binary_output.clear();
+	if(this->binary_record!=NULL){
+		delete []this->binary_record;
+		this->binary_record=NULL;
+		Sys_Memory_Count::self()->minus_mem(sizeof(double)*(1+5*this->Param_RV.RVNofProf), _sys_system_modules::HYD_SYS);
+	}
+}
+//Write the header of a binary result file: version, number of profiles, number of series and the riverstations
+void Hyd_Model_River::output_binary_header(ofstream *file, const int number_series){
+/**Layout of the header (little-endian as written by the machine):
+	- 16 bytes: int32 {version, number of profiles, number of series, reserved (0)}
+	- number of profiles * 8 bytes: double riverstation of each profile from the inflow to the outflow profile
+The integer part is padded to 16 bytes, thus the riverstations and all following double records start
+at a position, which is a multiple of 8 bytes.
+*/
+	qint32 header[4];
+	header[0]=2;
+	header[1]=this->Param_RV.RVNofProf;
+	header[2]=number_series;
+	header[3]=0;
+	file->write((const char*)header, sizeof(header));
+	double station=0.0;
+	for(int i=0; i<this->Param_RV.RVNofProf; i++){
+		station=this->get_ptr_river_profile(i)->get_river_station();
+		file->write((const char*)&station, sizeof(double));
+	}
+}
 //Initialize and output to the output file for a tecplot the maximum results (use it after the results per timesteps)
 void Hyd_Model_River::output_maximum_results2tecplot(void){
 
@@ -4313,6 +4609,36 @@ Error Hyd_Model_River::set_error(const int err_type){
 			help="Check the riverstation of outflow profile in file";
 			type=31;
 			break;
+		case 26://bad alloc
+			place.append("allocate_solver_profile_lists(void)");
+			reason="Can not allocate the memory";
+			help="Check the memory";
+			type=10;
+			break;
+		case 27://binary output file can not be opened
+			place.append("init_binary_output(void)/output_result_max2binary(void)");
+			reason="Can not open the file for the binary output of the results";
+			help="Check the file and the output folder";
+			type=5;
+			break;
+		case 28://bad alloc
+			place.append("init_binary_output(void)/output_result_max2binary(void)");
+			reason="Can not allocate the memory";
+			help="Check the memory";
+			type=10;
+			break;
+		case 29://bad alloc
+			place.append("init_river_model(Hyd_Param_Material *material_table)");
+			reason="Can not allocate the memory for the profile tables";
+			help="Check the memory";
+			type=10;
+			break;
+		case 30://unknown exception
+			place.append("init_river_model(Hyd_Param_Material *material_table)");
+			reason="An unknown exception occurred during the generation of the profile tables";
+			help="Check the profile";
+			type=6;
+			break;
 		default:
 			place.append("set_error(const int err_type)");
 			reason ="Unknown flag!";
@@ -4324,6 +4650,59 @@ Error Hyd_Model_River::set_error(const int err_type){
 	return msg;
 }
 //___________________________________________
+//static Analytical band Jacobian of the 1D diffusive wave function for the direct band solver
+#ifdef _WIN32
+	int __cdecl f1D_band_jacobian(int N, int mupper, int mlower, realtype time, N_Vector results, N_Vector da_dt, DlsMat jacobian, void *river_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3) {
+#elif defined(__unix__) || defined(__unix)
+	int __attribute__((cdecl)) f1D_band_jacobian(int N, int mupper, int mlower, realtype time, N_Vector results, N_Vector da_dt, DlsMat jacobian, void *river_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3) {
+#endif
+	//cast the river_data
+	Hyd_Model_River *rv_data=(class Hyd_Model_River*)river_data;
+	//the profile values are set by the last call of the function to solve with the same results (the matrix is set to zero by the solver)
+	//the discharge between two nodes is derived with the normal flow approach; boundary coupling and stabilization discharges are not taken into account
+	const int n=rv_data->number_inbetween_profiles;
+	const bool h_inflow=rv_data->inflow_river_profile.get_h_inflow_is_given();
+	double dq_up=0.0;
+	double dq_down=0.0;
+
+	//discharge through the inbetween profiles: from node i (upstream profile) to node i+1 (this profile)
+	for(int i=0; i<n; i++){
+		Hyd_River_Profile_Type_Standard *upstream_type=NULL;
+		if(i==0){
+			upstream_type=(Hyd_River_Profile_Type_Standard*)rv_data->inflow_river_profile.typ_of_profile;
+		}
+		else{
+			upstream_type=rv_data->table_profile_types[i-1];
+		}
+		rv_data->table_profile_types[i]->calculate_discharge_derivatives(upstream_type, rv_data->river_profiles[i].get_distance2upstream(), false, &dq_up, &dq_down);
+		//the area of the inflow profile is not a variable by a h-inflow boundary
+		if(i==0 && h_inflow==true){
+			dq_up=0.0;
+		}
+		else{
+			BAND_ELEM(jacobian, i, i)=BAND_ELEM(jacobian, i, i)-dq_up/rv_data->segment_half_length[i];
+			BAND_ELEM(jacobian, i, i+1)=BAND_ELEM(jacobian, i, i+1)-dq_down/rv_data->segment_half_length[i];
+		}
+		BAND_ELEM(jacobian, i+1, i)=BAND_ELEM(jacobian, i+1, i)+dq_up/rv_data->segment_half_length[i+1];
+		BAND_ELEM(jacobian, i+1, i+1)=BAND_ELEM(jacobian, i+1, i+1)+dq_down/rv_data->segment_half_length[i+1];
+	}
+
+	//discharge through the outflow profile
+	if(n==0 && h_inflow==true){
+		return 0;
+	}
+	Hyd_River_Profile_Type_Standard *upstream_type=NULL;
+	if(n==0){
+		upstream_type=(Hyd_River_Profile_Type_Standard*)rv_data->inflow_river_profile.typ_of_profile;
+	}
+	else{
+		upstream_type=rv_data->table_profile_types[n-1];
+	}
+	((Hyd_River_Profile_Type_Standard*)rv_data->outflow_river_profile.typ_of_profile)->calculate_discharge_derivatives(upstream_type, rv_data->outflow_river_profile.get_distance2upstream(), !rv_data->outflow_river_profile.get_boundary_waterlevel_flag(), &dq_up, &dq_down);
+	BAND_ELEM(jacobian, n, n)=BAND_ELEM(jacobian, n, n)-dq_up/rv_data->segment_half_length[n];
+
+	return 0;
+}
 //static Main function for 1D diffusive wave modelling
 #ifdef _WIN32
 	int __cdecl f1D_equation2solve(realtype time, N_Vector results, N_Vector da_dt, void* river_data) {
@@ -4402,7 +4781,26 @@ Error Hyd_Model_River::set_error(const int err_type){
 	//Sys_Common_Output::output_hyd->output_txt(&out);
 	
 	//set the flow specific values for the inbetween profiles (the calculated area is given to the first profile of a segment)
+	//the standard profiles are set via the fused profile table without exceptions; the first failed profile is reported below
+	int failed_profile=rv_data->number_inbetween_profiles;
+	#pragma omp parallel for if(rv_data->number_inbetween_profiles>=constant::min_profiles_parallel)
 	for(int i=0; i < rv_data->number_inbetween_profiles; i++){
+		if(rv_data->table_profile_types[i]!=NULL){
+			if(rv_data->table_profile_types[i]->set_profilevalues_by_fused_table(result_data[i+1])!=_hyd_table_lookup_status::TABLE_LOOKUP_OK){
+				#pragma omp critical
+				{
+					if(i<failed_profile){
+						failed_profile=i;
+					}
+				}
+			}
+		}
+	}
+	//profiles with an own table handling (weir) and the failed profile
+	for(int i=0; i < rv_data->number_inbetween_profiles; i++){
+		if(rv_data->table_profile_types[i]!=NULL && i!=failed_profile){
+			continue;
+		}
 		try{
 			rv_data->river_profiles[i].typ_of_profile->set_actuel_profilevalues_by_table((result_data[i+1]));
 			
@@ -4497,8 +4895,15 @@ Error Hyd_Model_River::set_error(const int err_type){
 			rv_data->river_profiles[0].set_actual_river_discharge(&(rv_data->inflow_river_profile), &(rv_data->river_profiles[1]));
 
 
-			//set the discharge for the inbetween profiles
-			for(int i=1; i< rv_data->number_inbetween_profiles-1; i++){
+			//set the discharge for the inbetween profiles between two river profiles; they are independent from each other
+			#pragma omp parallel for if(rv_data->number_standard_flow_profiles>=constant::min_profiles_parallel)
+			for(int j=0; j< rv_data->number_standard_flow_profiles; j++){
+				const int i=rv_data->standard_flow_profiles[j];
+				rv_data->river_profiles[i].set_actual_river_discharge(&(rv_data->river_profiles[i-1]), &(rv_data->river_profiles[i+1]));
+			}
+			//set the discharge for the inbetween profiles with an involved weir or bridge profile (in downstream order)
+			for(int j=0; j< rv_data->number_special_flow_profiles; j++){
+				const int i=rv_data->special_flow_profiles[j];
 				rv_data->river_profiles[i].set_actual_river_discharge(&(rv_data->river_profiles[i-1]), &(rv_data->river_profiles[i+1]));
 			}
 
@@ -4561,9 +4966,8 @@ Error Hyd_Model_River::set_error(const int err_type){
 
 	
 		//transform discharge [m�/s] into areas per second [m�/s] by dividing through the half segment length upstream/downstream
-		dh_da_data[0]=dh_da_data[0]/(rv_data->inflow_river_profile.get_distance2downstream()*0.5);
-		for(int i=0; i<rv_data->number_inbetween_profiles; i++){
-			dh_da_data[i+1]=dh_da_data[i+1]/((rv_data->river_profiles[i].get_distance2upstream()+rv_data->river_profiles[i].get_distance2downstream())*0.5);
+		for(int i=0; i<=rv_data->number_inbetween_profiles; i++){
+			dh_da_data[i]=dh_da_data[i]/rv_data->segment_half_length[i];
 		}
 
 
@@ -163,6 +163,8 @@ public:
 	void output_result2tecplot_2d(const double timepoint, const int timestep_number);
 	///Output the result members per timestep to csv as 1d
 	void output_result2csv_1d(const double timepoint, const int timestep_number);
+	///Append the result members per timestep to the binary result time series as 1d
+	void output_result2binary_1d(const double timepoint);
 	///Output the result members per timestep to paraview as 2d
 	void output_result2paraview_2d(const double timepoint, const int timestep_number);
 	///Output the result members per timestep to database as 2d
@@ -177,6 +179,8 @@ public:
 	void output_result_max2tecplot(void);
 	///Output the maximum result members to csv
 	void output_result_max2csv(void);
+	///Output the maximum result members to a binary file as 1d; the binary result time series is closed
+	void output_result_max2binary(void);
 	///Output the maximum result members to paraview as 2d
 	void output_result_max2paraview2d(void);
 	///Output the maximum result members to a database table
@@ -267,6 +271,10 @@ private:
 	ofstream tecplot_output_2d;
 	///Output file for the 2d tecplot output for the geometrie
 	ofstream tecplot_output_2d_geo;
+	///Output file for the binary result time series
+	ofstream binary_output;
+	///Buffer for one time step record of the binary result time series
+	double *binary_record;
 
 
 	///Total hydrological balance of the lateral boundary discharges to the river segment up to the profile
@@ -311,6 +319,19 @@ private:
 	///Number of the profiles stored in the list list_part_profiles
 	int number_part_profiles;
 
+	///Profile types of the inbetween profiles, which are set via the fused profile table in the solver function; NULL for profile types with an own table handling (weir)
+	Hyd_River_Profile_Type_Standard **table_profile_types;
+	///Indices of the inbetween profiles, where the discharge is calculated between two river profiles; they are independent from each other
+	int *standard_flow_profiles;
+	///Number of the indices stored in standard_flow_profiles
+	int number_standard_flow_profiles;
+	///Indices of the inbetween profiles, where a weir or a bridge profile is involved in the discharge calculation
+	int *special_flow_profiles;
+	///Number of the indices stored in special_flow_profiles
+	int number_special_flow_profiles;
+	///Half length of the river segments for the transformation of the discharges into areas per second
+	double *segment_half_length;
+
 	//methods
 
 	///Allocate the river profile with number of profiles
@@ -328,6 +349,11 @@ private:
 	///Set the list of the pointer of a part of the river profiles by two given profiles
 	void set_part_profile_list(_Hyd_River_Profile *up, _Hyd_River_Profile *down);
 
+	///Allocate and set the flat profile lists used in the solver function
+	void allocate_solver_profile_lists(void);
+	///Delete the flat profile lists used in the solver function
+	void delete_solver_profile_lists(void);
+
 	///Input the river profile data per file
 	void input_river_profiles_perfile(void);
 	///Transfer the river profile data to a database
@@ -346,6 +372,8 @@ private:
 
 	///Set function to solve to the solver
 	void set_function2solver(void);
+	///Initialize the linear solver; the direct band solver is used, if it is set in the river parameters
+	void init_linear_solver(Hyd_Param_Global *global_params);
 	///Set the init condition to the result vector
 	void set_initcond2resultvector(void);
 
@@ -364,6 +392,12 @@ private:
 	void output_solver_statistics(void);
 	///Initialize the output file for a tecplot output 
 	void init_tecplot_output(void);
+	///Initialize the output file for the binary result time series
+	void init_binary_output(void);
+	///Close the output file for the binary result time series
+	void close_binary_output(void);
+	///Write the header of a binary result file: version, number of profiles, number of series, a reserved value (16 bytes) and the riverstations
+	void output_binary_header(ofstream *file, const int number_series);
 
 	///Initialize and output to the output file for tecplot the maximum results (use it after the results per timesteps)
 	void output_maximum_results2tecplot(void);
@@ -400,11 +434,19 @@ private:
 	#elif defined(__unix__) || defined(__unix) 
     friend int  __attribute__((cdecl)) f1D_equation2solve( realtype time, N_Vector results, N_Vector da_dt, void *river_data);
 	#endif
+	///Analytical band Jacobian of the 1D diffusive wave function for the direct band solver
+	#ifdef _WIN32
+    friend int  __cdecl f1D_band_jacobian(int N, int mupper, int mlower, realtype time, N_Vector results, N_Vector da_dt, DlsMat jacobian, void *river_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3);
+	#elif defined(__unix__) || defined(__unix) 
+    friend int  __attribute__((cdecl)) f1D_band_jacobian(int N, int mupper, int mlower, realtype time, N_Vector results, N_Vector da_dt, DlsMat jacobian, void *river_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3);
+	#endif
 };
 #ifdef _WIN32
 int __cdecl f1D_equation2solve( realtype time, N_Vector results, N_Vector da_dt, void *river_data);
+int __cdecl f1D_band_jacobian(int N, int mupper, int mlower, realtype time, N_Vector results, N_Vector da_dt, DlsMat jacobian, void *river_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3);
 #elif defined(__unix__) || defined(__unix)
 int __attribute__((cdecl)) f1D_equation2solve( realtype time, N_Vector results, N_Vector da_dt, void *river_data);
+int __attribute__((cdecl)) f1D_band_jacobian(int N, int mupper, int mlower, realtype time, N_Vector results, N_Vector da_dt, DlsMat jacobian, void *river_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3);
 #endif
 
 #endif
\ No newline at end of file
@@ -20,6 +20,7 @@ Hyd_Param_RV::Hyd_Param_RV(void):default_rel_tol(1.0e-7),default_abs_tol(1.0e-8)
 
 	this->user_setting.explict_v_is_used=false;
 	this->user_setting.use_interface=false;
+	this->direct_solver_flag=false;
 
 	
 
@@ -44,6 +45,7 @@ Hyd_Param_RV::Hyd_Param_RV(const Hyd_Param_RV& par):default_rel_tol(1.0e-7),defa
 	this->rel_tolerance=par.rel_tolerance;
 
 	this->user_setting=par.user_setting;
+	this->direct_solver_flag=par.direct_solver_flag;
 
 
 
@@ -101,6 +103,10 @@ double* Hyd_Param_RV::get_absolute_solver_tolerance(void){
 double Hyd_Param_RV::get_relative_solver_tolerance(void){
 	return this->rel_tolerance;
 }
+//Get the flag if the direct band solver with the analytical Jacobian is used
+bool Hyd_Param_RV::get_direct_solver_flag(void){
+	return this->direct_solver_flag;
+}
 //output the members of the floodplain
 void Hyd_Param_RV::output_members(void){
 	//set prefix for output
@@ -127,6 +133,7 @@ void Hyd_Param_RV::output_members(void){
 	cout << " Relative solver tolerance    : " << W(7) << P(2)<< FORMAT_SCIENTIFIC_REAL<< this->rel_tolerance  <<endl;
 	cout << " Use velocity-head explicit   : " << functions::convert_boolean2string(this->user_setting.explict_v_is_used) <<endl;
 	cout << " Use interface (mid to bank)  : " << functions::convert_boolean2string(this->user_setting.use_interface)  <<endl;
+	cout << " Use direct band solver       : " << functions::convert_boolean2string(this->direct_solver_flag)  <<endl;
 
 	if(this->tecplot_outfile_name_1d!=label::not_set){
 		cout << "1D-RESULTFILE     " << endl;
@@ -283,6 +290,7 @@ Hyd_Param_RV& Hyd_Param_RV::operator= (const Hyd_Param_RV& par){
 	this->abs_tolerance=par.abs_tolerance;
 	this->rel_tolerance=par.rel_tolerance;
 	this->user_setting=par.user_setting;
+	this->direct_solver_flag=par.direct_solver_flag;
 
 
 
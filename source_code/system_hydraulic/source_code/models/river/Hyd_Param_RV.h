@@ -53,6 +53,8 @@ public:
 	double* get_absolute_solver_tolerance(void);
 	///Get the relative tolerance for the solver
 	double get_relative_solver_tolerance(void);
+	///Get the flag if the direct band solver with the analytical Jacobian is used
+	bool get_direct_solver_flag(void);
 
 	///Output the members of the river model
 	void output_members(void);
@@ -113,6 +115,8 @@ private:
 
 	///User settings for specifc calculation flags
 	_hyd_profile_calc_setting user_setting;
+	///Flag if the direct band solver with the analytical Jacobian is used instead of the Krylov solver
+	bool direct_solver_flag;
 
 	///Number of instationary boundary curves used
 	int number_instat_boundary;
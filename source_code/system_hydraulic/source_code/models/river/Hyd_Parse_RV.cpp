@@ -297,6 +297,11 @@ void Hyd_Parse_RV::parse_calculation_limits(_hyd_keyword_file Key, word Command)
 				buffer >>buff1;
 				this->rv_params.user_setting.explict_v_is_used=_Hyd_Parse_IO::transform_string2boolean(buff1);
 			}
+			else if(Key == eDIRECT_SOLVER){
+				string buff1;
+				buffer >>buff1;
+				this->rv_params.direct_solver_flag=_Hyd_Parse_IO::transform_string2boolean(buff1);
+			}
 			if(buffer.fail()==true){
 				ostringstream info;
 				info << "Wrong input sequenze " << buffer.str() << endl;
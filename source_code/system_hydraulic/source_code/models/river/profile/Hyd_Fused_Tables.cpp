@@ -0,0 +1,303 @@
+//#include "Hyd_Fused_Tables.h"
+#include "Hyd_Headers_Precompiled.h"
+
+//constructor
+Hyd_Fused_Tables::Hyd_Fused_Tables(void){
+	this->shared_values=NULL;
+	this->rows=NULL;
+	this->extrapolation=NULL;
+	this->number_rows=0;
+	this->number_columns=0;
+	this->row_size=1;
+	this->old_node=0;
+	this->table_type_name=label::not_set;
+	//count the memory
+	Sys_Memory_Count::self()->add_mem(sizeof(Hyd_Fused_Tables), _sys_system_modules::HYD_SYS);
+}
+//destructor
+Hyd_Fused_Tables::~Hyd_Fused_Tables(void){
+	this->delete_table();
+	//count the memory
+	Sys_Memory_Count::self()->minus_mem(sizeof(Hyd_Fused_Tables), _sys_system_modules::HYD_SYS);
+}
+//______________________
+//public
+//Set the table name => the table type
+void Hyd_Fused_Tables::set_table_type(const string type_name){
+	this->table_type_name=type_name;
+}
+//Fuse the given tables; the independent values of the first table are taken for all tables
+void Hyd_Fused_Tables::fuse_tables(const int number_tables, Hyd_Tables **tables){
+	this->delete_table();
+	this->number_columns=number_tables;
+	this->row_size=1+2*this->number_columns;
+	this->number_rows=0;
+	this->old_node=0;
+	if(this->number_columns<=0){
+		return;
+	}
+	this->number_rows=tables[0]->get_number_values();
+	for(int j=1; j<this->number_columns; j++){
+		if(tables[j]->get_number_values()!=this->number_rows){
+			Error msg=this->set_error(1);
+			this->number_rows=0;
+			throw msg;
+		}
+	}
+
+	try{
+		this->allocate_table();
+	}
+	catch(Error msg){
+		throw msg;
+	}
+
+	_hyd_table_values buffer;
+	for(int i=0; i<this->number_rows; i++){
+		double *row=&this->rows[i*this->row_size];
+		row[0]=tables[0]->get_values(i).independentvalue;
+		for(int j=0; j<this->number_columns; j++){
+			buffer=tables[j]->get_values(i);
+			row[1+j]=buffer.dependingvalue;
+		}
+	}
+	this->calculate_coefficients();
+}
+//Get the number of dependent values (columns) per row
+int Hyd_Fused_Tables::get_number_columns(void){
+	return this->number_columns;
+}
+//Get the interpolated values of all columns for the given value; the status of the lookup is returned
+_hyd_table_lookup_status Hyd_Fused_Tables::get_interpolated_values(const double value2interpolation, double *values){
+	const double *row=this->rows;
+	//check if value to interploated is smaller than min value
+	if(value2interpolation < row[0]){
+		return TABLE_LOOKUP_BELOW_MIN;
+	}
+	if(value2interpolation == row[0]){
+		for(int j=0; j<this->number_columns; j++){
+			values[j]=row[1+j];
+		}
+		return TABLE_LOOKUP_OK;
+	}
+	const double max_value=this->rows[(this->number_rows-1)*this->row_size];
+	//value to extrapolate is greater than max value in table
+	if(value2interpolation>max_value){
+		this->old_node=this->number_rows-1;
+		for(int j=0; j<this->number_columns; j++){
+			values[j]=this->extrapolation[2*j]*value2interpolation+this->extrapolation[2*j+1];
+		}
+		return TABLE_LOOKUP_OK;
+	}
+	//not a number
+	if(!(value2interpolation>row[0])){
+		return TABLE_LOOKUP_INVALID;
+	}
+
+	const int node=this->search_interval(value2interpolation);
+
+	//linear interploation scheme with the slopes to the next row
+	row=&this->rows[node*this->row_size];
+	const double delta=value2interpolation-row[0];
+	for(int j=0; j<this->number_columns; j++){
+		values[j]=row[1+j]+row[1+this->number_columns+j]*delta;
+	}
+	return TABLE_LOOKUP_OK;
+}
+//Get the gradients of all columns to the independent value for the given value; the status of the lookup is returned
+_hyd_table_lookup_status Hyd_Fused_Tables::get_interpolated_gradients(const double value2interpolation, double *gradients){
+	const double *row=this->rows;
+	//check if value to interploated is smaller than min value
+	if(value2interpolation < row[0]){
+		return TABLE_LOOKUP_BELOW_MIN;
+	}
+	const double max_value=this->rows[(this->number_rows-1)*this->row_size];
+	//value is greater than max value in table: gradient of the extrapolation
+	if(value2interpolation>max_value){
+		for(int j=0; j<this->number_columns; j++){
+			gradients[j]=this->extrapolation[2*j];
+		}
+		return TABLE_LOOKUP_OK;
+	}
+	//not a number
+	if(!(value2interpolation>=row[0])){
+		return TABLE_LOOKUP_INVALID;
+	}
+
+	//at the minimum value the gradient of the first interval is taken
+	int node=0;
+	if(value2interpolation>row[0]){
+		node=this->search_interval(value2interpolation);
+	}
+	row=&this->rows[node*this->row_size];
+	for(int j=0; j<this->number_columns; j++){
+		gradients[j]=row[1+this->number_columns+j];
+	}
+	return TABLE_LOOKUP_OK;
+}
+//Clone the fused tables
+void Hyd_Fused_Tables::clone_tables(Hyd_Fused_Tables *table){
+	this->delete_table();
+	this->table_type_name=table->table_type_name;
+	this->number_rows=table->number_rows;
+	this->number_columns=table->number_columns;
+	this->row_size=table->row_size;
+	this->old_node=0;
+	if(this->number_rows<=0 || this->number_columns<=0){
+		return;
+	}
+	//the values are not copied, but shared
+	this->shared_values=Hyd_Tables::reference_shared_values(table->shared_values);
+	this->rows=this->shared_values->values;
+	this->extrapolation=&this->shared_values->values[this->number_rows*this->row_size];
+}
+//_________________
+//private
+//Allocate the rows and the extrapolation coefficients
+void Hyd_Fused_Tables::allocate_table(void){
+	try{
+		this->shared_values=Hyd_Tables::allocate_shared_values(this->number_rows*this->row_size+2*this->number_columns);
+	}
+	catch(bad_alloc &t){
+		Error msg=this->set_error(0);
+		ostringstream info;
+		info<< "Info bad alloc: " << t.what() << endl;
+		msg.make_second_info(info.str());
+		throw msg;
+	}
+	this->rows=this->shared_values->values;
+	this->extrapolation=&this->shared_values->values[this->number_rows*this->row_size];
+}
+//Delete the rows and the extrapolation coefficients
+void Hyd_Fused_Tables::delete_table(void){
+	Hyd_Tables::release_shared_values(this->shared_values);
+	this->shared_values=NULL;
+	this->rows=NULL;
+	this->extrapolation=NULL;
+}
+//Calculate the slopes and the extrapolation coefficients
+void Hyd_Fused_Tables::calculate_coefficients(void){
+	//slopes to the next row; the last row has no slope
+	for(int i=0; i<this->number_rows-1; i++){
+		double *row=&this->rows[i*this->row_size];
+		double *next_row=&this->rows[(i+1)*this->row_size];
+		for(int j=0; j<this->number_columns; j++){
+			row[1+this->number_columns+j]=(next_row[1+j]-row[1+j])/(next_row[0]-row[0]);
+		}
+	}
+	if(this->number_rows<2){
+		return;
+	}
+	//extrapolation over the last three (two) rows
+	const double *last=&this->rows[(this->number_rows-1)*this->row_size];
+	const double *first=NULL;
+	if(this->number_rows>2){
+		first=&this->rows[(this->number_rows-3)*this->row_size];
+	}
+	else{
+		first=&this->rows[(this->number_rows-2)*this->row_size];
+	}
+	for(int j=0; j<this->number_columns; j++){
+		this->extrapolation[2*j]=(last[1+j]-first[1+j])/(last[0]-first[0]);
+		this->extrapolation[2*j+1]=first[1+j]-this->extrapolation[2*j]*first[0];
+	}
+}
+//Search the interpolation interval for a value inside the table (minimum value < value <= maximum value)
+int Hyd_Fused_Tables::search_interval(const double value2interpolation){
+	const double max_value=this->rows[(this->number_rows-1)*this->row_size];
+	int node=0;
+	if(value2interpolation>=this->rows[this->old_node*this->row_size] && value2interpolation<max_value){
+		node=this->search_upwards(value2interpolation);
+	}
+	else if(value2interpolation<this->rows[this->old_node*this->row_size]){
+		node=this->search_downwards(value2interpolation, this->old_node);
+	}
+	else{
+		node=this->search_downwards(value2interpolation, this->number_rows-1);
+	}
+	this->old_node=node;
+	return node;
+}
+//Search the interpolation interval upwards from the old interpolation interval
+int Hyd_Fused_Tables::search_upwards(const double value2interpolation){
+	//the value is in [value(low), value(high)) during the search
+	int low=this->old_node;
+	int step=1;
+	int high=low+step;
+	while(high<this->number_rows-1 && value2interpolation>=this->rows[high*this->row_size]){
+		low=high;
+		step=step*2;
+		high=low+step;
+	}
+	if(high>this->number_rows-1){
+		high=this->number_rows-1;
+	}
+	while(high-low>1){
+		int mid=(low+high)/2;
+		if(value2interpolation>=this->rows[mid*this->row_size]){
+			low=mid;
+		}
+		else{
+			high=mid;
+		}
+	}
+	return low;
+}
+//Search the interpolation interval downwards from the given node
+int Hyd_Fused_Tables::search_downwards(const double value2interpolation, const int start_node){
+	//the value is in (value(low), value(high)] during the search
+	int high=start_node;
+	int step=1;
+	int low=high-step;
+	while(low>0 && value2interpolation<=this->rows[low*this->row_size]){
+		high=low;
+		step=step*2;
+		low=high-step;
+	}
+	if(low<0){
+		low=0;
+	}
+	while(high-low>1){
+		int mid=(low+high)/2;
+		if(value2interpolation>this->rows[mid*this->row_size]){
+			low=mid;
+		}
+		else{
+			high=mid;
+		}
+	}
+	return low;
+}
+//Set the error(s)
+Error Hyd_Fused_Tables::set_error(const int err_type){
+		string place="Hyd_Fused_Tables::";
+		string help;
+		string reason;
+		int type=0;
+		bool fatal=false;
+		stringstream info;
+		Error msg;
+
+	switch (err_type){
+		case 0://bad alloc
+			place.append("allocate_table(void)");
+			reason="Can not allocate the memory";
+			help="Check the memory";
+			type=10;
+			break;
+		case 1://the number of values in the tables are not the same
+			place.append("fuse_tables(const int number_tables, Hyd_Tables **tables)");
+			reason="The number of values in the tables to fuse are not the same";
+			help="Check the tables";
+			type=13;
+			break;
+		default:
+			place.append("set_error(const int err_type)");
+			reason ="Unknown flag!";
+			help="Check the flags";
+			type=6;
+	}
+	msg.set_msg(place, reason, help, type, fatal);
+	msg.make_second_info(info.str());
+	return msg;
+}
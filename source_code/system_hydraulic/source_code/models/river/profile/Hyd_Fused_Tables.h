@@ -0,0 +1,98 @@
+#pragma once
+/**\class Hyd_Fused_Tables
+	\author Daniel Bachmann et al.
+	\author produced by the Institute of Hydraulic Engineering (IWW), RWTH Aachen University
+	\version 0.0.1
+	\date 2009
+*/
+#ifndef HYD_FUSED_TABLES_H
+#define HYD_FUSED_TABLES_H
+
+//system_hyd classes
+#include "Hyd_Tables.h"
+
+///Enumerator for the status of a lookup in the fused tables \ingroup hyd
+enum _hyd_table_lookup_status{
+	///The values are interpolated or extrapolated
+	TABLE_LOOKUP_OK,
+	///The value to interpolate is smaller than the minimum value of the table; the profile gets dry
+	TABLE_LOOKUP_BELOW_MIN,
+	///The value to interpolate is not valid (e.g. not a number)
+	TABLE_LOOKUP_INVALID
+};
+
+///Class for the fused river profile tables with one row per node of the independent value \ingroup hyd
+/**
+The dependent values of several Hyd_Tables with the same independent values (e.g. waterlevel, width and
+the conveyances dependent from the area) are stored together in one contiguous row per node. One search
+for the interpolation interval gives all dependent values at once. The slopes of the intervals and the
+extrapolation coefficients are calculated once, when the tables are fused.
+The rows and the extrapolation coefficients are stored in one block of shared table values;
+a cloned table shares them with the original table.
+
+\see Hyd_Tables, Hyd_River_Profile_Type_Standard
+*/
+class Hyd_Fused_Tables
+{
+public:
+	///Default constructor
+	Hyd_Fused_Tables(void);
+	///Default destructor
+	~Hyd_Fused_Tables(void);
+
+	//methods
+	///Set the table name => the table type
+	void set_table_type(const string type_name);
+
+	///Fuse the given tables; the independent values of the first table are taken for all tables
+	void fuse_tables(const int number_tables, Hyd_Tables **tables);
+	///Get the number of dependent values (columns) per row
+	int get_number_columns(void);
+
+	///Get the interpolated values of all columns for the given value; the status of the lookup is returned
+	_hyd_table_lookup_status get_interpolated_values(const double value2interpolation, double *values);
+	///Get the gradients of all columns to the independent value for the given value; the status of the lookup is returned
+	_hyd_table_lookup_status get_interpolated_gradients(const double value2interpolation, double *gradients);
+
+	///Clone the fused tables; the values are shared with the given table
+	void clone_tables(Hyd_Fused_Tables *table);
+
+private:
+	//members
+
+	///Shared values of the table: the rows followed by the extrapolation coefficients
+	_hyd_shared_table_values *shared_values;
+	///Rows of the table: independent value, dependent values and slopes to the next row (it is connected to shared_values)
+	double *rows;
+	///Extrapolation coefficients (gradient and intercept) per column (it is connected to shared_values)
+	double *extrapolation;
+	///Number of rows stored in the table
+	int number_rows;
+	///Number of dependent values per row
+	int number_columns;
+	///Number of values per row
+	int row_size;
+	///Indentifier for the old interpolation interval a interpolation request to this table before
+	int old_node;
+	///Name of the table
+	string table_type_name;
+
+	//method
+	///Allocate the rows and the extrapolation coefficients
+	void allocate_table(void);
+	///Delete the rows and the extrapolation coefficients
+	void delete_table(void);
+	///Calculate the slopes and the extrapolation coefficients
+	void calculate_coefficients(void);
+
+	///Search the interpolation interval for a value inside the table (minimum value < value <= maximum value)
+	int search_interval(const double value2interpolation);
+	///Search the interpolation interval upwards from the old interpolation interval
+	int search_upwards(const double value2interpolation);
+	///Search the interpolation interval downwards from the given node
+	int search_downwards(const double value2interpolation, const int start_node);
+
+	///Set the error(s)
+	Error set_error(const int err_type);
+};
+#endif
@@ -227,9 +227,7 @@ void Hyd_River_Profile_Connection_Inflow::calculate_hydrological_balance(const d
 		this->q_value_max.maximum=this->q_inflow;
 		this->q_value_max.time_point=time_point;
 	}
-	this->typ_of_profile->calculate_maximum_values(time_point);
-	this->typ_of_profile->set_old_time_point(time_point);
-
+	//the maximum values of the profile type are calculated in the standard connection type
 	Hyd_River_Profile_Connection_Standard::calculate_hydrological_balance(time_point);
 	
 	this->inflow_volume=this->inflow_volume+this->q_inflow*this->delta_time;
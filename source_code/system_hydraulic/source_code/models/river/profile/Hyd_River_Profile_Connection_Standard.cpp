@@ -26,6 +26,7 @@ Hyd_River_Profile_Connection_Standard::Hyd_River_Profile_Connection_Standard(voi
 	this->q_river=0.0;
 	this->q_lateral=0.0;
 	this->q_point=0.0;
+	this->q_boundary_coupling=0.0;
 
 	this->ds_dt_coup_old=0.0;
 	this->ds_dt_coup=0.0;
@@ -688,6 +689,7 @@ void Hyd_River_Profile_Connection_Standard::reset_coupling_discharge(void){
 	//this->q_river=0.0;
 	this->q_lateral=0.0;
 	this->q_point=0.0;
+	this->q_boundary_coupling=0.0;
 	this->q_zero_outflow_error=0.0;
 }
 //Make the syncronistation of the profiles to a given time point
@@ -733,6 +735,12 @@ void Hyd_River_Profile_Connection_Standard::calculate_hydrological_balance(const
 	this->typ_of_profile->set_old_time_point(time_point);
 
 	_Hyd_River_Profile::calculate_hydrological_balance(time_point);
+	//no boundary discharges: the volumes are not changed
+	if(this->q_lateral==0.0 && this->q_point==0.0){
+		//calculate the water volume
+		this->calculate_watervolume_element();
+		return;
+	}
 	//lateral boundary
 	if(this->q_lateral<0.0){
 		//outflow
@@ -762,6 +770,13 @@ void Hyd_River_Profile_Connection_Standard::calculate_hydrological_balance(const
 	//calculate the water volume
 	this->calculate_watervolume_element();
 }
+//Sum up the boundary and coupling discharges of the syncronisation step; use it before the solver is run
+void Hyd_River_Profile_Connection_Standard::sum_boundary_coupling_discharge(void){
+	//same order of the summation as in get_total_boundary_coupling_discharge(const double time_point, const double q_river_in_out)
+	this->q_boundary_coupling=this->q_lateral+this->q_point+this->q_1d_coupling+
+		this->q_dikebreak_coupling_left+this->q_dikebreak_coupling_right+
+		this->q_left_bank+this->q_right_bank+this->q_structure_coupling;
+}
 //Get the total boundary and coupling discharge to this profile
 double Hyd_River_Profile_Connection_Standard::get_total_boundary_coupling_discharge(const double time_point, const double q_river_in_out){
 	double q_buff=0.0;
@@ -778,9 +793,8 @@ double Hyd_River_Profile_Connection_Standard::get_total_boundary_coupling_discha
 //	}
 
 	if(this->typ_of_profile->get_outflow_reduction_flag()==false){
-		q_buff=this->q_lateral+this->q_point+this->q_1d_coupling+
-			this->q_dikebreak_coupling_left+this->q_dikebreak_coupling_right+
-			this->q_left_bank+this->q_right_bank+this->q_structure_coupling+q_river_in_out;
+		//the boundary and coupling discharges are summed up before the solver step
+		q_buff=this->q_boundary_coupling+q_river_in_out;
 	}
 	else{
 		if(this->q_lateral>=0.0){
@@ -955,6 +969,7 @@ void Hyd_River_Profile_Connection_Standard::reset_hydrobalance_maxvalues(void){
 	this->q_river=0.0;
 	this->q_lateral=0.0;
 	this->q_point=0.0;
+	this->q_boundary_coupling=0.0;
 
 	this->ds_dt_coup_old=0.0;
 	this->ds_dt_coup=0.0;
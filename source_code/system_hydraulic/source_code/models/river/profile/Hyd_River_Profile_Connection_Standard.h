@@ -92,6 +92,8 @@ public:
 	///Calculate the values for a hydrological balance of the corresponding river segment (upstream) for each syncronisation step
 	virtual void calculate_hydrological_balance(const double time_point);
 
+	///Sum up the boundary and coupling discharges of the syncronisation step; use it before the solver is run
+	void sum_boundary_coupling_discharge(void);
 	///Get the total boundary and coupling discharge to this profile
 	double get_total_boundary_coupling_discharge(const double time_point, const double q_river_in_out);
 
@@ -157,6 +159,8 @@ protected:
 	double q_lateral;
 	///Actual point discharge for the corresponding upstream river segment [m/s]
 	double q_point;
+	///Sum of the boundary and coupling discharges of the syncronisation step [m/s]; they are constant during the solver step
+	double q_boundary_coupling;
 
 	///Variation of the waterlevel over time for boundary and coupling
 	double ds_dt_coup;
@@ -11,6 +11,7 @@ Hyd_River_Profile_Type_Standard::Hyd_River_Profile_Type_Standard(void){
 	this->h_table.set_table_type(hyd_label::Waterlevel_table);
 	this->width_table.set_table_type(hyd_label::Width_table);
 	this->area_table.set_table_type(hyd_label::Area_table);
+	this->profile_table.set_table_type(hyd_label::Profile_table);
 	
 
 	this->no_mid_points=0;
@@ -30,6 +31,7 @@ Hyd_River_Profile_Type_Standard::Hyd_River_Profile_Type_Standard(void){
 	this->c_right_value=0.0;
 	this->c_mid_value=0.0;
 	this->c_left_value=0.0;
+	this->starting_value=0.0;
 
 	this->left_bank_flag=false;
 	this->right_bank_flag=false;
@@ -37,7 +39,7 @@ Hyd_River_Profile_Type_Standard::Hyd_River_Profile_Type_Standard(void){
 	this->material_type=_hyd_mat_coefficient_types::manning_coefficient;
 
 	//count the memory
-	Sys_Memory_Count::self()->add_mem(sizeof(Hyd_River_Profile_Type_Standard)-sizeof(Hyd_Tables)*5, _sys_system_modules::HYD_SYS);
+	Sys_Memory_Count::self()->add_mem(sizeof(Hyd_River_Profile_Type_Standard)-sizeof(Hyd_Tables)*5-sizeof(Hyd_Fused_Tables), _sys_system_modules::HYD_SYS);
 
 
 }
@@ -48,7 +50,7 @@ Hyd_River_Profile_Type_Standard::~Hyd_River_Profile_Type_Standard(void){
 	this->delete_area_segments();
 
 	//count the memory
-	Sys_Memory_Count::self()->minus_mem(sizeof(Hyd_River_Profile_Type_Standard)-sizeof(Hyd_Tables)*5, _sys_system_modules::HYD_SYS);
+	Sys_Memory_Count::self()->minus_mem(sizeof(Hyd_River_Profile_Type_Standard)-sizeof(Hyd_Tables)*5-sizeof(Hyd_Fused_Tables), _sys_system_modules::HYD_SYS);
 
 }
 //_________________________
@@ -91,8 +93,16 @@ void Hyd_River_Profile_Type_Standard::calc_alloc_tables(const double delta_x, Hy
 	//generate the river segments for calculation of tables
 	try{
 		this->generate_area_segments(material_table);
-		this->calculate_table_values(delta_x);
+		//the tables of a profile with the same geometry and material values are loaded; otherwise they are calculated and persisted
+		string table_key=this->generate_table_key(delta_x);
+		if(this->load_tables_from_file(table_key)==false){
+			this->calculate_table_values(delta_x);
+			this->save_tables2file(table_key);
+		}
+		//the waterlevels are generated with a uniform step: direct search of the interpolation interval for the area
+		this->area_table.set_uniform_independent_values(this->global_z_min, delta_x);
 		//this->output_tables();
+		this->fuse_profile_tables();
 	}
 	catch(Error msg){
 		throw msg;
@@ -129,6 +139,56 @@ double Hyd_River_Profile_Type_Standard::get_c_mid_channel(void){
 double Hyd_River_Profile_Type_Standard::get_c_value(void){
 	return this->c_mid_value+this->c_left_value+this->c_right_value;
 }
+//Get the gradient of the total convenyance factor to the area at the actual area from the fused profile table
+double Hyd_River_Profile_Type_Standard::get_c_value_gradient(void){
+	double gradients[5];
+	if(this->profile_table.get_interpolated_gradients(this->area2calc, gradients)!=_hyd_table_lookup_status::TABLE_LOOKUP_OK){
+		return 0.0;
+	}
+	return gradients[2]+gradients[3]+gradients[4];
+}
+//Calculate the derivatives of the normal flow discharge through this profile to the areas of the upstream profile and of this profile
+void Hyd_River_Profile_Type_Standard::calculate_discharge_derivatives(Hyd_River_Profile_Type_Standard *upstream_type, const double distance_upstream, const bool normal_flow_waterlevel, double *dq_da_upstream, double *dq_da_this){
+	*dq_da_upstream=0.0;
+	*dq_da_this=0.0;
+
+	//gradient function and its derivative to the waterlevel difference (see calculate_gradient)
+	const double delta_s=upstream_type->get_actual_global_waterlevel()-this->s_value;
+	const double sqrt_dist=pow(distance_upstream,0.5);
+	double grad=0.0;
+	double grad_derivative=0.0;
+	if(abs(delta_s)<=0.000246925){
+		if(abs(delta_s)>constant::flow_epsilon/1000.0){
+			grad=0.02304416717797*atan(3287.68191373281*delta_s)/sqrt_dist;
+		}
+		grad_derivative=0.02304416717797*3287.68191373281/(1.0+pow(3287.68191373281*delta_s,2.0))/sqrt_dist;
+	}
+	else{
+		grad=delta_s/(sqrt_dist*pow(abs(delta_s),0.5));
+		grad_derivative=0.5/(sqrt_dist*pow(abs(delta_s),0.5));
+	}
+
+	const double c_mid=0.5*(upstream_type->get_c_value()+this->get_c_value());
+	const double width_up=upstream_type->get_width();
+
+	//the waterlevel of this profile follows the upstream waterlevel (normal flow); the gradient is constant
+	if(normal_flow_waterlevel==true){
+		*dq_da_upstream=0.5*upstream_type->get_c_value_gradient()*grad;
+		if(width_up>constant::flow_epsilon){
+			*dq_da_upstream=*dq_da_upstream+0.5*this->get_c_value_gradient()*this->width/width_up*grad;
+		}
+		return;
+	}
+
+	*dq_da_upstream=0.5*upstream_type->get_c_value_gradient()*grad;
+	if(width_up>constant::flow_epsilon){
+		*dq_da_upstream=*dq_da_upstream+c_mid*grad_derivative/width_up;
+	}
+	*dq_da_this=0.5*this->get_c_value_gradient()*grad;
+	if(this->width>constant::flow_epsilon){
+		*dq_da_this=*dq_da_this-c_mid*grad_derivative/this->width;
+	}
+}
 //output the area segments
 void Hyd_River_Profile_Type_Standard::output_area_segments(void){
 	ostringstream cout;
@@ -178,31 +238,60 @@ void Hyd_River_Profile_Type_Standard::output_area_segments(void){
 }
 //Set the actuel flow specific values with a given area from tables
 void Hyd_River_Profile_Type_Standard::set_actuel_profilevalues_by_table(const double area){
-	this->zero_outflow_reduction_flag=false;
-	try{
-		this->solved_area=area;
-		if(this->solved_area<0.00){
-			this->area2calc=0.000;
+	_hyd_table_lookup_status status=this->set_profilevalues_by_fused_table(area);
+	if(status!=_hyd_table_lookup_status::TABLE_LOOKUP_OK){
+		Error msg=this->set_error(6);
+		ostringstream info;
+		info << "Tabletype : " << hyd_label::Profile_table << endl;
+		info << "Value to interpolate " << this->area2calc << endl;
+		if(status==_hyd_table_lookup_status::TABLE_LOOKUP_BELOW_MIN){
+			info << "Value to interpolate is smaller than the minimum value; Profile gets dry" << endl;
 		}
 		else{
-			this->area2calc=this->solved_area;
+			info << "The value to interpolate is a unknown type" << endl;
 		}
-
-		this->set_actual_waterlevel_by_table(this->area2calc);
-
-		//this->check_unphysical_waterlevels();
-		//check for outflow reduction
-		if(this->h_value<=constant::dry_hyd_epsilon){
-			this->zero_outflow_reduction_flag=true;
-		}
-
-		this->set_actual_conveyance_by_table(this->area2calc);
-		
-	}
-	catch(Error msg){
+		msg.make_second_info(info.str());
 		throw msg;
 	}
 }
+//Set the actuel flow specific values with a given area from the fused profile table without throwing an error; the status of the lookup is returned
+_hyd_table_lookup_status Hyd_River_Profile_Type_Standard::set_profilevalues_by_fused_table(const double area){
+	this->zero_outflow_reduction_flag=false;
+	this->solved_area=area;
+	if(this->solved_area<0.00){
+		this->area2calc=0.000;
+	}
+	else{
+		this->area2calc=this->solved_area;
+	}
+
+	//one lookup for the waterlevel, the width and the convenyances
+	double values[5];
+	_hyd_table_lookup_status status=this->profile_table.get_interpolated_values(this->area2calc, values);
+	if(status!=_hyd_table_lookup_status::TABLE_LOOKUP_OK){
+		return status;
+	}
+	this->s_value=values[0];
+	this->h_value=this->s_value-this->global_z_min;
+	this->width=values[1];
+	if(this->h_value <= constant::flow_epsilon){
+		this->h_value=0.0;
+		this->s_value=this->global_z_min;
+		this->area2calc=0.0;
+		//the convenyances are taken for the dry profile
+		this->profile_table.get_interpolated_values(this->area2calc, values);
+	}
+	this->c_left_value=values[2];
+	this->c_mid_value=values[3];
+	this->c_right_value=values[4];
+
+	//this->check_unphysical_waterlevels();
+	//check for outflow reduction
+	if(this->h_value<=constant::dry_hyd_epsilon){
+		this->zero_outflow_reduction_flag=true;
+	}
+	return status;
+}
 //Get the waterlevel by a given area from table 
 double Hyd_River_Profile_Type_Standard::get_waterlevel_from_table(const double area){
 	double buffer=0.0;
@@ -343,16 +432,7 @@ double Hyd_River_Profile_Type_Standard::calculate_actual_discharge(_Hyd_River_Pr
 }
 //Get a starting value in cause of: a hole before, this profile is dry, the waterlevel before is greater than this global z_min value
 double Hyd_River_Profile_Type_Standard::get_starting_value(void){
-	double start_value=0.0;
-	try{
-		start_value=this->area_table.get_interpolated_values(this->global_z_min+constant::dry_hyd_epsilon*2.0);
-		start_value=this->c_mid_table.get_interpolated_values(start_value);
-	}
-	catch(Error msg){
-		throw msg;
-	}
-
-	return start_value;
+	return this->starting_value;
 }
 //Clone profile type
 void Hyd_River_Profile_Type_Standard::clone_profile_type(_Hyd_River_Profile_Type *prof_type){
@@ -390,11 +470,31 @@ void Hyd_River_Profile_Type_Standard::clone_profile_type(_Hyd_River_Profile_Type
 	this->c_mid_table.set_independent_values(&this->area_table);
 	this->c_left_table.set_independent_values(&this->area_table);
 	this->c_right_table.set_independent_values(&this->area_table);
+	this->profile_table.clone_tables(&buffer->profile_table);
+	this->starting_value=buffer->starting_value;
 
 
 }
 //________________
 //protected
+//Fuse the tables of the waterlevel, the width and the convenyances to the profile table
+void Hyd_River_Profile_Type_Standard::fuse_profile_tables(void){
+	Hyd_Tables *tables[5];
+	tables[0]=&this->h_table;
+	tables[1]=&this->width_table;
+	tables[2]=&this->c_left_table;
+	tables[3]=&this->c_mid_table;
+	tables[4]=&this->c_right_table;
+	try{
+		this->profile_table.fuse_tables(5, tables);
+		//the starting value just depends on the tables
+		this->starting_value=this->area_table.get_interpolated_values(this->global_z_min+constant::dry_hyd_epsilon*2.0);
+		this->starting_value=this->c_mid_table.get_interpolated_values(this->starting_value);
+	}
+	catch(Error msg){
+		throw msg;
+	}
+}
 //Set actual conveyance with a given area
 void Hyd_River_Profile_Type_Standard::set_actual_conveyance_by_table(const double area){
 	try{
@@ -688,7 +788,7 @@ void Hyd_River_Profile_Type_Standard::set_points2areasegments(Hyd_Param_Material
 	}
 }
 //generate intersected profile with the waterlevel
-void Hyd_River_Profile_Type_Standard::generate_intersected_area_segments(const int no_real_segments, Hyd_Profile_Segment *real_segments, int *no_intersect_segments, Hyd_Profile_Segment *(*intersect_segments)){
+void Hyd_River_Profile_Type_Standard::generate_intersected_area_segments(const int no_real_segments, Hyd_Profile_Segment *real_segments, int *no_intersect_segments, Hyd_Profile_Segment *(*intersect_segments), int *max_intersect_segments, _geo_interception_point *interceptions){
 	//create an interception point
 	_geo_interception_point my_interception;
 	my_interception.interception_point.set_point_name(label::interception_point);
@@ -698,17 +798,14 @@ void Hyd_River_Profile_Type_Standard::generate_intersected_area_segments(const i
 	bool wet_flag=false;
 	bool new_interception=false;
 
-	//reset the values
+	//reset the values; the allocated intersected segments are reused
 	*no_intersect_segments=0;
-	if(*intersect_segments!= NULL){
-		delete [](*intersect_segments);
-		*intersect_segments=NULL;
-	}
 
 	//count the necessary segments
 	for(int i=0;i < no_real_segments;i++){
-		//make the interception with the waterlevel
+		//make the interception with the waterlevel; it is stored for the segment setting
 		real_segments[i].calc_interception(this->waterlevel_line, &my_interception);
+		interceptions[i]=my_interception;
 
 		//check if there is no interception
 		if(my_interception.interception_flag==false && my_interception.indefinite_flag==false){
@@ -833,12 +930,21 @@ void Hyd_River_Profile_Type_Standard::generate_intersected_area_segments(const i
 		*no_intersect_segments=0;
 		return;
 	}
-	try{
-		*intersect_segments=new Hyd_Profile_Segment[*no_intersect_segments];
-	}
-	catch(bad_alloc &){
-		Error msg=this->set_error(5);
-		throw msg;
+	//allocate the intersected segments just, if the number of segments is greater than the allocated ones
+	if(*no_intersect_segments>*max_intersect_segments){
+		if(*intersect_segments!= NULL){
+			delete [](*intersect_segments);
+			*intersect_segments=NULL;
+		}
+		*max_intersect_segments=0;
+		try{
+			*intersect_segments=new Hyd_Profile_Segment[*no_intersect_segments];
+		}
+		catch(bad_alloc &){
+			Error msg=this->set_error(5);
+			throw msg;
+		}
+		*max_intersect_segments=*no_intersect_segments;
 	}
 
 	//start segment setting
@@ -853,8 +959,8 @@ void Hyd_River_Profile_Type_Standard::generate_intersected_area_segments(const i
 	wet_flag=false;
 
 	for(int i=0;i < no_real_segments;i++){
-		//make the interception with the waterlevel
-		real_segments[i].calc_interception(this->waterlevel_line, &my_interception);
+		//take the interception with the waterlevel of the segment counting
+		my_interception=interceptions[i];
 
 		//check if there is no interception
 		if(my_interception.interception_flag==false && my_interception.indefinite_flag==false){
@@ -1056,9 +1162,22 @@ void Hyd_River_Profile_Type_Standard::calculate_table_values(const double delta_
 		throw msg;
 	}
 
-	//intersected segments
+	//intersected segments; they are allocated once and reused for each waterlevel
 	int no_intersected_segments=0;
+	int max_intersected_segments=0;
 	Hyd_Profile_Segment *intersected_segments=NULL;
+	//interceptions of the segments with the waterlevel
+	_geo_interception_point *interceptions=NULL;
+	int max_real_segments=max(this->no_left_bank_segments, max(this->no_mid_segments, this->no_right_bank_segments));
+	try{
+		interceptions=new _geo_interception_point[max_real_segments];
+	}
+	catch(bad_alloc &){
+		delete this->waterlevel_line;
+		this->waterlevel_line=NULL;
+		Error msg=this->set_error(5);
+		throw msg;
+	}
 	double area_left=0.0;
 	double area_mid=0.0;
 	double area_right=0.0;
@@ -1078,7 +1197,7 @@ void Hyd_River_Profile_Type_Standard::calculate_table_values(const double delta_
 
 		//left bank
 		if(this->left_bank_profile[0]!=this->left_bank_profile[1]){
-			this->generate_intersected_area_segments(this->no_left_bank_segments, this->left_bank_profile, &no_intersected_segments, &intersected_segments);
+			this->generate_intersected_area_segments(this->no_left_bank_segments, this->left_bank_profile, &no_intersected_segments, &intersected_segments, &max_intersected_segments, interceptions);
 		}
 		else{
 			no_intersected_segments=0;
@@ -1092,7 +1211,7 @@ void Hyd_River_Profile_Type_Standard::calculate_table_values(const double delta_
 
 		//main channel
 		if(this->mid_profile[0]!=this->mid_profile[1]){
-			this->generate_intersected_area_segments(this->no_mid_segments, this->mid_profile, &no_intersected_segments, &intersected_segments);
+			this->generate_intersected_area_segments(this->no_mid_segments, this->mid_profile, &no_intersected_segments, &intersected_segments, &max_intersected_segments, interceptions);
 		}
 		else{
 			no_intersected_segments=0;
@@ -1112,7 +1231,7 @@ void Hyd_River_Profile_Type_Standard::calculate_table_values(const double delta_
 
 		//right bank
 		if(this->right_bank_profile[0]!=this->right_bank_profile[1]){
-			this->generate_intersected_area_segments(this->no_right_bank_segments, this->right_bank_profile, &no_intersected_segments, &intersected_segments);
+			this->generate_intersected_area_segments(this->no_right_bank_segments, this->right_bank_profile, &no_intersected_segments, &intersected_segments, &max_intersected_segments, interceptions);
 		}
 		else{
 			no_intersected_segments=0;
@@ -1149,7 +1268,7 @@ void Hyd_River_Profile_Type_Standard::calculate_table_values(const double delta_
 	
 	//left bank
 	if(this->left_bank_profile[0]!=this->left_bank_profile[1]){
-		this->generate_intersected_area_segments(this->no_left_bank_segments, this->left_bank_profile, &no_intersected_segments, &intersected_segments);
+		this->generate_intersected_area_segments(this->no_left_bank_segments, this->left_bank_profile, &no_intersected_segments, &intersected_segments, &max_intersected_segments, interceptions);
 	}
 	else{
 		no_intersected_segments=0;
@@ -1162,7 +1281,7 @@ void Hyd_River_Profile_Type_Standard::calculate_table_values(const double delta_
 
 	//main channel
 	if(this->mid_profile[0]!=this->mid_profile[1]){
-		this->generate_intersected_area_segments(this->no_mid_segments, this->mid_profile, &no_intersected_segments, &intersected_segments);
+		this->generate_intersected_area_segments(this->no_mid_segments, this->mid_profile, &no_intersected_segments, &intersected_segments, &max_intersected_segments, interceptions);
 	}
 	else{
 		no_intersected_segments=0;
@@ -1175,7 +1294,7 @@ void Hyd_River_Profile_Type_Standard::calculate_table_values(const double delta_
 
 	//right bank
 	if(this->right_bank_profile[0]!=this->right_bank_profile[1]){
-		this->generate_intersected_area_segments(this->no_right_bank_segments, this->right_bank_profile, &no_intersected_segments, &intersected_segments);
+		this->generate_intersected_area_segments(this->no_right_bank_segments, this->right_bank_profile, &no_intersected_segments, &intersected_segments, &max_intersected_segments, interceptions);
 	}
 	else{
 		no_intersected_segments=0;
@@ -1201,8 +1320,174 @@ void Hyd_River_Profile_Type_Standard::calculate_table_values(const double delta_
 		delete []intersected_segments;
 		intersected_segments=NULL;	
 	}
+	if(interceptions!=NULL){
+		delete []interceptions;
+		interceptions=NULL;
+	}
 
 }
+//Generate the key of the profile tables from the area segments (geometry and material values) and the table discretisation
+string Hyd_River_Profile_Type_Standard::generate_table_key(const double delta_x){
+	//FNV-1a offset basis
+	unsigned long long int key=14695981039346656037ULL;
+	//version of the table calculation
+	this->add_value2table_key(&key, (double)Hyd_River_Profile_Type_Standard::table_file_version);
+	this->add_value2table_key(&key, delta_x);
+	this->add_value2table_key(&key, (double)this->number_table_points);
+	this->add_value2table_key(&key, this->global_z_min);
+	this->add_value2table_key(&key, this->increment_max_height);
+
+	Hyd_Profile_Segment *areas[3]={this->left_bank_profile, this->mid_profile, this->right_bank_profile};
+	int no_segments[3]={this->no_left_bank_segments, this->no_mid_segments, this->no_right_bank_segments};
+	for(int j=0; j<3; j++){
+		this->add_value2table_key(&key, (double)no_segments[j]);
+		for(int i=0; i<no_segments[j]; i++){
+			this->add_value2table_key(&key, areas[j][i].point1.get_xcoordinate());
+			this->add_value2table_key(&key, areas[j][i].point1.get_ycoordinate());
+			this->add_value2table_key(&key, areas[j][i].point2.get_xcoordinate());
+			this->add_value2table_key(&key, areas[j][i].point2.get_ycoordinate());
+			this->add_value2table_key(&key, areas[j][i].get_mat_value());
+			this->add_value2table_key(&key, areas[j][i].get_lu());
+		}
+	}
+
+	ostringstream buffer;
+	buffer << hex << setfill('0') << setw(16) << key;
+	return buffer.str();
+}
+//Add a value to the key of the profile tables (FNV-1a hash)
+void Hyd_River_Profile_Type_Standard::add_value2table_key(unsigned long long int *key, const double value){
+	const unsigned char *bytes=(const unsigned char *)&value;
+	for(int i=0; i<(int)sizeof(double); i++){
+		*key=*key^bytes[i];
+		*key=*key*1099511628211ULL;
+	}
+}
+//Get the folder of the persisted profile tables; it is not set, if no project is opened
+string Hyd_River_Profile_Type_Standard::get_table_folder(void){
+	//without a project the main path is the working directory: the tables are not persisted
+	if(Sys_Project::get_project_name()==label::not_set){
+		return label::not_set;
+	}
+	ostringstream buffer;
+	buffer << Sys_Project::get_main_path() << sys_label::folder_outputfile << "/";
+	buffer << functions::convert_system_module2txt(_sys_system_modules::HYD_SYS) << sys_label::folder_profile_tables << "/";
+	return buffer.str();
+}
+//Load the values of the profile tables from the persisted table file with the given key; false is returned, if no valid table file is found; an invalid file is removed
+bool Hyd_River_Profile_Type_Standard::load_tables_from_file(const string key){
+	string folder=this->get_table_folder();
+	if(folder==label::not_set){
+		return false;
+	}
+	string file_name=folder+key+".tab";
+	ifstream table_file(file_name.c_str(), ios_base::in | ios_base::binary);
+	if(table_file.is_open()==false){
+		return false;
+	}
+	//check the header: version, number of table points and the key
+	int header[2]={0,0};
+	char file_key[16];
+	table_file.read((char *)header, sizeof(header));
+	table_file.read(file_key, sizeof(file_key));
+	bool valid=(table_file.good()==true && header[0]==Hyd_River_Profile_Type_Standard::table_file_version && header[1]==this->number_table_points && key.compare(0, string::npos, file_key, sizeof(file_key))==0);
+
+	double *values=NULL;
+	if(valid==true){
+		try{
+			values=new double[6*this->number_table_points];
+		}
+		catch(bad_alloc &){
+			return false;
+		}
+		//check the values with the checksum at the end of the file
+		unsigned long long int checksum=0;
+		unsigned long long int file_checksum=0;
+		table_file.read((char *)values, sizeof(double)*6*this->number_table_points);
+		table_file.read((char *)&file_checksum, sizeof(file_checksum));
+		if(table_file.good()==true){
+			checksum=this->calculate_table_checksum(values, 6*this->number_table_points);
+		}
+		valid=(table_file.good()==true && checksum==file_checksum);
+	}
+	if(valid==false){
+		if(values!=NULL){
+			delete []values;
+		}
+		//the file is outdated or damaged: it is removed and the tables are calculated again
+		table_file.close();
+		QFile::remove(file_name.c_str());
+		return false;
+	}
+
+	Hyd_Tables *tables[6]={&this->h_table, &this->area_table, &this->width_table, &this->c_left_table, &this->c_mid_table, &this->c_right_table};
+	for(int j=0; j<6; j++){
+		for(int i=0; i<this->number_table_points; i++){
+			tables[j]->set_values(i, values[j*this->number_table_points+i]);
+		}
+	}
+	delete []values;
+	return true;
+}
+//Save the values of the profile tables to a table file with the given key; if the saving fails the tables are just not persisted
+void Hyd_River_Profile_Type_Standard::save_tables2file(const string key){
+	QDir my_dir;
+	string folder=this->get_table_folder();
+	if(folder==label::not_set){
+		return;
+	}
+	if(my_dir.exists(folder.c_str())==false && my_dir.mkpath(folder.c_str())==false){
+		return;
+	}
+	double *values=NULL;
+	try{
+		values=new double[6*this->number_table_points];
+	}
+	catch(bad_alloc &){
+		return;
+	}
+	Hyd_Tables *tables[6]={&this->h_table, &this->area_table, &this->width_table, &this->c_left_table, &this->c_mid_table, &this->c_right_table};
+	for(int j=0; j<6; j++){
+		for(int i=0; i<this->number_table_points; i++){
+			values[j*this->number_table_points+i]=tables[j]->get_values(i).dependingvalue;
+		}
+	}
+	unsigned long long int checksum=this->calculate_table_checksum(values, 6*this->number_table_points);
+
+	//write to an unique temporary file first; profiles with the same key may be saved at the same time
+	ostringstream temp_name;
+	temp_name << folder << key << "_" << (unsigned long long int)this << ".tmp";
+	ofstream table_file(temp_name.str().c_str(), ios_base::out | ios_base::binary | ios_base::trunc);
+	if(table_file.is_open()==false){
+		delete []values;
+		return;
+	}
+	//header: version, number of table points and the key; values; checksum of the values
+	int header[2]={Hyd_River_Profile_Type_Standard::table_file_version, this->number_table_points};
+	table_file.write((const char *)header, sizeof(header));
+	table_file.write(key.c_str(), 16);
+	table_file.write((const char *)values, sizeof(double)*6*this->number_table_points);
+	table_file.write((const char *)&checksum, sizeof(checksum));
+	delete []values;
+	bool ok_flag=table_file.good();
+	table_file.close();
+
+	string file_name=folder+key+".tab";
+	//an existing file with the same key is replaced
+	QFile::remove(file_name.c_str());
+	if(ok_flag==false || QFile::rename(temp_name.str().c_str(), file_name.c_str())==false){
+		QFile::remove(temp_name.str().c_str());
+	}
+}
+//Calculate the checksum of the values of the persisted profile tables (FNV-1a hash)
+unsigned long long int Hyd_River_Profile_Type_Standard::calculate_table_checksum(const double *values, const int number){
+	//FNV-1a offset basis
+	unsigned long long int checksum=14695981039346656037ULL;
+	for(int i=0; i<number; i++){
+		this->add_value2table_key(&checksum, values[i]);
+	}
+	return checksum;
+}
 //calculate the area with the generated Hyd_Profile_Segment
 double Hyd_River_Profile_Type_Standard::calculate_area2table(const int no_intersect_segments, Hyd_Profile_Segment *intersect_segments){
 	double area=0.0;
@@ -1298,6 +1583,12 @@ Error Hyd_River_Profile_Type_Standard::set_error(const int err_type){
 			help="Check the memory";
 			type=10;
 			break;
+		case 6://the profile table can not be interpolated
+			place.append("set_actuel_profilevalues_by_table(const double area)");
+			reason="Can not interpolate the profile table";
+			help="Check the tables of the river system";
+			type=13;
+			break;
 		default:
 			place.append("set_error(const int err_type)");
 			reason ="Unknown flag!";
@@ -11,6 +11,7 @@
 
 //system_hyd classes
 #include "_Hyd_River_Profile_Type.h"
+#include "Hyd_Fused_Tables.h"
 
 //forward declaration
 class _Hyd_River_Profile;
@@ -29,12 +30,16 @@ public:
 	virtual ~Hyd_River_Profile_Type_Standard(void);
 
 	//members
+	///Version of the calculation and of the file layout of the persisted profile tables; it is increased, if the table calculation changes
+	static const int table_file_version=2;
 	///Table in which the convenyance for left bank is stored dependent from the area
 	Hyd_Tables c_left_table;
 	///Table in which the convenyance for mid channel is stored dependent from the area
 	Hyd_Tables c_mid_table;
 	///Table in which the convenyance for right bank is stored dependent from the area
 	Hyd_Tables c_right_table;
+	///Fused table of the waterlevel, the width and the convenyances dependent from the area; it is used for the lookup per timestep
+	Hyd_Fused_Tables profile_table;
 
 	//method
 	///Calculate and allocate the tables (Hyd_Tables): area, waterlevel, convenyance for left bank, right bank and mid channel
@@ -51,9 +56,15 @@ public:
 	double get_c_mid_channel(void);
 	///Get the convenyance factor total
 	virtual double get_c_value(void);
+	///Get the gradient of the total convenyance factor to the area at the actual area from the fused profile table
+	double get_c_value_gradient(void);
+	///Calculate the derivatives of the normal flow discharge through this profile to the areas of the upstream profile and of this profile
+	void calculate_discharge_derivatives(Hyd_River_Profile_Type_Standard *upstream_type, const double distance_upstream, const bool normal_flow_waterlevel, double *dq_da_upstream, double *dq_da_this);
 
 	///Set the actuel flow specific values with a given area from tables
 	virtual void set_actuel_profilevalues_by_table(const double area);
+	///Set the actuel flow specific values with a given area from the fused profile table without throwing an error; the status of the lookup is returned
+	_hyd_table_lookup_status set_profilevalues_by_fused_table(const double area);
 	///Get the waterlevel by a given area from table 
 	virtual double get_waterlevel_from_table(const double area);
 
@@ -95,6 +106,8 @@ protected:
 	double c_mid_value;
 	///Actual convenyance value for the left bank
 	double c_left_value;
+	///Starting convenyance value for a dry profile with a hole before (see get_starting_value()); it is calculated once with the tables
+	double starting_value;
 
 
 	///Pointer to a Polyline of Segments for the mid channel
@@ -111,6 +124,9 @@ protected:
 
 	//methods
 		
+	///Fuse the tables of the waterlevel, the width and the convenyances to the profile table
+	void fuse_profile_tables(void);
+
 	///Set the actual conveyance with a given area from tables
 	virtual void set_actual_conveyance_by_table(const double area);
 
@@ -132,11 +148,24 @@ private:
 	///Set the Hyd_Profile_Segment (left, right bank, mid channel) with the given profile points (Hyd_River_Profile_Points)
 	void set_points2areasegments(Hyd_Param_Material *material_table);
 
-	///Generate the relevant Hyd_Profile_Segment by intersecting the profile with the waterlevel
-	void generate_intersected_area_segments(const int no_real_segments, Hyd_Profile_Segment *real_segments, int *no_intersect_segments, Hyd_Profile_Segment *(*intersect_segments));
+	///Generate the relevant Hyd_Profile_Segment by intersecting the profile with the waterlevel; the allocated intersected segments are reused, if they are sufficient
+	void generate_intersected_area_segments(const int no_real_segments, Hyd_Profile_Segment *real_segments, int *no_intersect_segments, Hyd_Profile_Segment *(*intersect_segments), int *max_intersect_segments, _geo_interception_point *interceptions);
 
 	///Calculate the table values (h, a, conveyance) and store them in Hyd_Tables class
 	void calculate_table_values(const double delta_x);
+
+	///Generate the key of the profile tables from the area segments (geometry and material values) and the table discretisation
+	string generate_table_key(const double delta_x);
+	///Add a value to the key of the profile tables (FNV-1a hash)
+	void add_value2table_key(unsigned long long int *key, const double value);
+	///Get the folder of the persisted profile tables; it is not set, if no project is opened
+	string get_table_folder(void);
+	///Load the values of the profile tables from the persisted table file with the given key; false is returned, if no valid table file is found; an invalid file is removed
+	bool load_tables_from_file(const string key);
+	///Save the values of the profile tables to a table file with the given key; if the saving fails the tables are just not persisted
+	void save_tables2file(const string key);
+	///Calculate the checksum of the values of the persisted profile tables (FNV-1a hash)
+	unsigned long long int calculate_table_checksum(const double *values, const int number);
 	///Calculate the area with the generated Hyd_Profile_Segment for the table generation
 	double calculate_area2table(const int no_intersect_segments, Hyd_Profile_Segment *intersect_segments);
 	///Calculate the width with the generated Hyd_Profile_Segment for the table generation
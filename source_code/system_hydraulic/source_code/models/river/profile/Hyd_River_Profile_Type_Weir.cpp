@@ -36,6 +36,8 @@ void Hyd_River_Profile_Type_Weir::calc_alloc_tables(const double delta_x, Hyd_Pa
 		//set the waterlevl as the independent value of the convenyance table (left bank and right bank)
 		this->c_left_table.set_independent_values(&this->h_table);
 		this->c_right_table.set_independent_values(&this->h_table);
+		this->c_left_table.set_uniform_independent_values(this->global_z_min, delta_x);
+		this->c_right_table.set_uniform_independent_values(this->global_z_min, delta_x);
 
 		this->check_weir_segments();
 	}
@@ -47,6 +49,7 @@ void Hyd_River_Profile_Type_Weir::calc_alloc_tables(const double delta_x, Hyd_Pa
 		for (int i=0; i< this->no_mid_segments; i++){
 			this->weir_discharge_table[i].allocate_dependent_values(this->number_table_points);
 			this->weir_discharge_table[i].set_independent_values(&this->h_table);
+			this->weir_discharge_table[i].set_uniform_independent_values(this->global_z_min, delta_x);
 			this->weir_discharge_table[i].set_table_type(hyd_label::Weir_discharge_table);
 		}
 	}
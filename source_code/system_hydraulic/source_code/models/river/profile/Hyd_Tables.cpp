@@ -4,9 +4,13 @@
 //constructor
 Hyd_Tables::Hyd_Tables(void){
 	this->number_values=0;
+	this->shared_values=NULL;
 	this->depending_value=NULL;
 	this->independent_value=NULL;
 	this->old_node=0;
+	this->uniform_start=0.0;
+	this->uniform_step=0.0;
+	this->uniform_number=0;
 	this->table_type_name=label::not_set;
 	//count the memory
 	Sys_Memory_Count::self()->add_mem(sizeof(Hyd_Tables), _sys_system_modules::HYD_SYS);
@@ -29,6 +33,8 @@ void Hyd_Tables::set_table_type(const string type_name){
 void Hyd_Tables::allocate_dependent_values(const int number){
 	this->delete_table();
 	this->number_values=number;
+	this->uniform_step=0.0;
+	this->uniform_number=0;
 	try{
 		this->allocate_table();
 	}
@@ -39,6 +45,7 @@ void Hyd_Tables::allocate_dependent_values(const int number){
 //Set the x-value of table; it must be allocated outside this class with number_values
 void Hyd_Tables::set_independent_values(double *independent_value){
 	this->independent_value=independent_value;
+	this->count_uniform_values();
 }
 //Set the x-value of table; it is the depending value of an other table
 void Hyd_Tables::set_independent_values( Hyd_Tables *independent_table){
@@ -48,6 +55,13 @@ void Hyd_Tables::set_independent_values( Hyd_Tables *independent_table){
 		Error msg=this->set_error(4);
 		throw msg;
 	}
+	this->count_uniform_values();
+}
+//Set the uniform grid (x-value = start + i*step) of the x-values for a direct search of the interpolation interval
+void Hyd_Tables::set_uniform_independent_values(const double start, const double step){
+	this->uniform_start=start;
+	this->uniform_step=step;
+	this->count_uniform_values();
 }
 //Get the number of values stroed in the table
 int Hyd_Tables::get_number_values(void){
@@ -55,6 +69,9 @@ int Hyd_Tables::get_number_values(void){
 }
 //Set the y-value of the table
 void Hyd_Tables::set_values(const int counter, const double dependingvalue){
+	if(this->shared_values->references.loadAcquire()>1){
+		this->detach_table();
+	}
 	this->depending_value[counter]=dependingvalue;
 }
 //Get the table values for a given index
@@ -86,6 +103,10 @@ double Hyd_Tables::get_interpolated_values(const double value2interpolation){
 	if(value2interpolation>this->independent_value[this->number_values-1]){
 		return this->extrapolate_value(value2interpolation);
 	}
+	//value to interpolate is inside the uniform grid
+	if(this->uniform_number>1 && value2interpolation>this->independent_value[0] && value2interpolation<this->independent_value[this->uniform_number-1]){
+		return this->interpolateuniform_value(value2interpolation);
+	}
 	//value to interploated is greater than the old value
 	if(value2interpolation>=this->independent_value[this->old_node]){
 		return this->interpolateupwards_value(value2interpolation);
@@ -124,11 +145,56 @@ void Hyd_Tables::clone_tables(Hyd_Tables *table){
 	this->delete_table();
 	this->number_values=table->number_values;
 	this->table_type_name=table->table_type_name;
-	this->allocate_table();
-	for(int i=0; i<this->number_values; i++){
-		this->depending_value[i]=table->depending_value[i];;
+	this->uniform_start=table->uniform_start;
+	this->uniform_step=table->uniform_step;
+	this->uniform_number=table->uniform_number;
+	//the values are not copied, but shared
+	this->shared_values=Hyd_Tables::reference_shared_values(table->shared_values);
+	if(this->shared_values!=NULL){
+		this->depending_value=this->shared_values->values;
+	}
+}
+//Allocate shared table values with the given number of values (static)
+_hyd_shared_table_values *Hyd_Tables::allocate_shared_values(const int number){
+	/**
+	A bad_alloc is thrown to the calling table, which sets the error.
+	*/
+	_hyd_shared_table_values *shared=new _hyd_shared_table_values;
+	try{
+		shared->values=new double[number];
+	}
+	catch(bad_alloc &t){
+		delete shared;
+		throw t;
+	}
+	shared->number=number;
+	shared->references.storeRelease(1);
+	//init the values
+	for(int i=0; i<number; i++){
+		shared->values[i]=0.0;
+	}
+	//count the memory
+	Sys_Memory_Count::self()->add_mem(sizeof(double)*number, _sys_system_modules::HYD_SYS);
+	return shared;
+}
+//Get a further reference to shared table values (static)
+_hyd_shared_table_values *Hyd_Tables::reference_shared_values(_hyd_shared_table_values *shared){
+	if(shared!=NULL){
+		shared->references.ref();
+	}
+	return shared;
+}
+//Release a reference to shared table values; they are deleted with the last reference (static)
+void Hyd_Tables::release_shared_values(_hyd_shared_table_values *shared){
+	if(shared==NULL){
+		return;
+	}
+	if(shared->references.deref()==false){
+		delete []shared->values;
+		//count the memory
+		Sys_Memory_Count::self()->minus_mem(sizeof(double)*shared->number, _sys_system_modules::HYD_SYS);
+		delete shared;
 	}
-
 }
 //_________________
 //private
@@ -136,31 +202,37 @@ void Hyd_Tables::clone_tables(Hyd_Tables *table){
 void Hyd_Tables::allocate_table(void){
 
 	try{
-		this->depending_value=new double[this->number_values];
-		//count the memory
-		Sys_Memory_Count::self()->add_mem(sizeof(double)*this->number_values, _sys_system_modules::HYD_SYS);
+		this->shared_values=Hyd_Tables::allocate_shared_values(this->number_values);
+		this->depending_value=this->shared_values->values;
 	}
 	catch(bad_alloc&){
 		Error msg=this->set_error(0);
 		throw msg;
 	}
 
-	
-	//init the table
-	for(int i=0; i< this->number_values; i++){
-		this->depending_value[i]=0.0;
-	}
-
 }
 //Delete the table values 
 void Hyd_Tables::delete_table(void){
-	if(this->depending_value!=NULL){
-		delete [] this->depending_value;
-		this->depending_value=NULL;
-		//count the memory
-		Sys_Memory_Count::self()->minus_mem(sizeof(double)*this->number_values, _sys_system_modules::HYD_SYS);
-
+	Hyd_Tables::release_shared_values(this->shared_values);
+	this->shared_values=NULL;
+	this->depending_value=NULL;
+}
+//Copy the table values, if they are shared with other tables
+void Hyd_Tables::detach_table(void){
+	_hyd_shared_table_values *buffer=this->shared_values;
+	try{
+		this->shared_values=Hyd_Tables::allocate_shared_values(this->number_values);
+	}
+	catch(bad_alloc&){
+		this->shared_values=buffer;
+		Error msg=this->set_error(0);
+		throw msg;
+	}
+	for(int i=0; i<this->number_values; i++){
+		this->shared_values->values[i]=buffer->values[i];
 	}
+	this->depending_value=this->shared_values->values;
+	Hyd_Tables::release_shared_values(buffer);
 }
 //Extrapolate the given value, if it is outside the table values
 double Hyd_Tables::extrapolate_value(const double value2interpolation){
@@ -265,6 +337,46 @@ double Hyd_Tables::interpolatedownwards_value(const double value2interpolation){
 	return interpolated_result;
 
 }
+//Interpolate the given value inside the uniform grid of the x-values; the interpolation interval is calculated directly
+double Hyd_Tables::interpolateuniform_value(const double value2interpolation){
+	/**
+	The value is inside the uniform grid (minimum value < value < x-value(uniform_number-1)). The interval
+	is calculated by the grid; it is corrected for rounding, that the value is in [x-value(node), x-value(node+1)).
+	The interpolation is the same as in interpolateupwards_value().
+	*/
+	double interpolated_result=0.0;
+	int nodes=(int)((value2interpolation-this->uniform_start)/this->uniform_step);
+	if(nodes<0){
+		nodes=0;
+	}
+	else if(nodes>this->uniform_number-2){
+		nodes=this->uniform_number-2;
+	}
+	while(nodes>0 && value2interpolation<this->independent_value[nodes]){
+		nodes=nodes-1;
+	}
+	while(value2interpolation>=this->independent_value[nodes+1]){
+		nodes=nodes+1;
+	}
+	//now interpolation
+	//linear interploation scheme
+	interpolated_result=this->depending_value[nodes]+ (this->depending_value[nodes+1]-this->depending_value[nodes])
+				/ (this->independent_value[nodes+1] -this->independent_value[nodes])*(value2interpolation-this->independent_value[nodes]);
+	//set the old node
+	this->old_node=nodes;
+
+	return interpolated_result;
+}
+//Count the number of x-values, which are exactly on the uniform grid
+void Hyd_Tables::count_uniform_values(void){
+	this->uniform_number=0;
+	if(this->uniform_step<=0.0 || this->independent_value==NULL){
+		return;
+	}
+	while(this->uniform_number<this->number_values && this->independent_value[this->uniform_number]==(double)this->uniform_number*this->uniform_step+this->uniform_start){
+		this->uniform_number++;
+	}
+}
 //Set the error(s)
 Error Hyd_Tables::set_error(const int err_type){
 		string place="Hyd_Tables::";
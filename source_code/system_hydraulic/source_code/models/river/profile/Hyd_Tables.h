@@ -8,6 +8,9 @@
 #ifndef HYD_TABLES_H
 #define HYD_TABLES_H
 
+//qt libs
+#include <QAtomicInt>
+
 //system_sys_ classes
 #include "_Sys_Common_System.h"
 
@@ -19,12 +22,25 @@ struct _hyd_table_values{
 	double dependingvalue;
 };
 
+///Data structure for the read-only values of a table, which are shared between a table and its clones \ingroup hyd
+struct _hyd_shared_table_values{
+	///Values of the table
+	double *values;
+	///Number of values
+	int number;
+	///Number of tables, which are using the values
+	QAtomicInt references;
+};
+
 ///Class for the river profile tables \ingroup hyd
 /**
 In this profile tables the information of a river profile are calculated before the 
 numerical calculation to avoid time costly geometrical calculation during the 
 numerical simulation. Via interpolation the result is approximated during the
 numerical simualtion.
+The values are not changed after the table generation. A cloned table (e.g. in the
+cloned hydraulic systems of a multiple calculation) shares the values with the
+original table; they are deleted with the last table using them.
 
 \see _Hyd_River_Profile_Type
 */
@@ -46,10 +62,12 @@ public:
 	void set_independent_values(double *independent_value);
 	///Set the x-value of table; it is the depending value of an other table
 	void set_independent_values(Hyd_Tables *independent_table);
+	///Set the uniform grid (x-value = start + i*step) of the x-values for a direct search of the interpolation interval
+	void set_uniform_independent_values(const double start, const double step);
 
 	///Get the number of values stored in the table
 	int get_number_values(void);
-	///Set the y-value of the table
+	///Set the y-value of the table; values shared with other tables are copied before
 	void set_values(const int counter, const double dependingvalue);
 	///Get the table values for a given index
 	_hyd_table_values get_values(const int counter);
@@ -59,15 +77,24 @@ public:
 	///Output the table and their values to display/console
 	void output_table(ostringstream *cout);
 
-	///Clone table
+	///Clone table; the values are shared with the given table
 	void clone_tables(Hyd_Tables *table);
 
+	///Allocate shared table values with the given number of values (static)
+	static _hyd_shared_table_values *allocate_shared_values(const int number);
+	///Get a further reference to shared table values (static)
+	static _hyd_shared_table_values *reference_shared_values(_hyd_shared_table_values *shared);
+	///Release a reference to shared table values; they are deleted with the last reference (static)
+	static void release_shared_values(_hyd_shared_table_values *shared);
+
 
 
 private:
 	//members
 
-	///y-value of the table, e.g. waterlevel
+	///Shared y-values of the table
+	_hyd_shared_table_values *shared_values;
+	///y-value of the table, e.g. waterlevel (it is connected to shared_values)
 	double *depending_value; 
 	///x-value of table, e.g. area
 	double *independent_value;
@@ -75,6 +102,12 @@ private:
 	int number_values;
 	///Indentifier for the old interpolation interval a interpolation request to this table before
 	int old_node;
+	///Start value of the uniform grid of the x-values
+	double uniform_start;
+	///Step of the uniform grid of the x-values; it is 0.0, if no uniform grid is set
+	double uniform_step;
+	///Number of x-values from the start of the table, which are exactly on the uniform grid
+	int uniform_number;
 	///Name of the table
 	string table_type_name;
 
@@ -84,6 +117,8 @@ private:
 	void allocate_table(void);
 	///Delete the table values 
 	void delete_table(void);
+	///Copy the table values, if they are shared with other tables
+	void detach_table(void);
 
 	///Extrapolate the given value, if it is outside the table values
 	double extrapolate_value(const double value2interpolation);
@@ -91,6 +126,10 @@ private:
 	double interpolateupwards_value(const double value2interpolation);
 	///Interpolate the given value downwards from the old interpolation interval
 	double interpolatedownwards_value(const double value2interpolation);
+	///Interpolate the given value inside the uniform grid of the x-values; the interpolation interval is calculated directly
+	double interpolateuniform_value(const double value2interpolation);
+	///Count the number of x-values, which are exactly on the uniform grid
+	void count_uniform_values(void);
 
 
 	///Set the error(s)
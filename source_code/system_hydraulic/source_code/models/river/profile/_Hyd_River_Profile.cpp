@@ -2893,7 +2893,6 @@ void _Hyd_River_Profile::copy_instat_results(QSqlDatabase *ptr_database, const _
 	}
 
 	int glob_id = 0;
-	glob_id = _Hyd_River_Profile::erg_instat_table->maximum_int_of_column(_Hyd_River_Profile::erg_instat_table->get_column_name(label::glob_id), ptr_database) + 1;
 
 	QSqlQueryModel model;
 	ostringstream test_filter;
@@ -2923,6 +2922,7 @@ void _Hyd_River_Profile::copy_instat_results(QSqlDatabase *ptr_database, const _
 	ostringstream cout;
 	cout << "Copy " << model.rowCount() << " instationary results of the river profile(s) to the new measure state..." << endl;
 	Sys_Common_Output::output_hyd->output_txt(&cout);
+	glob_id = _Hyd_River_Profile::erg_instat_table->reserve_int_of_column(_Hyd_River_Profile::erg_instat_table->get_column_name(label::glob_id), ptr_database, model.rowCount());
 	for (int i = 0; i < model.rowCount(); i++) {
 		if (i % 1000 == 0 && i > 0) {
 			cout << "Copy profile's results " << i << " to " << i + 1000 << "..." << endl;
@@ -3019,10 +3019,12 @@ void _Hyd_River_Profile::copy_boundary_condition(QSqlDatabase *ptr_database, con
 
 }
 //Initialize the profile
-void _Hyd_River_Profile::init_profile(Hyd_Param_Material *material_table, const _hyd_profile_calc_setting user_setting){
-	ostringstream cout;
-	cout <<"Generate tables of profile " << this->profile_number << " ... "<< endl;
-	Sys_Common_Output::output_hyd->output_txt(&cout, true);
+void _Hyd_River_Profile::init_profile(Hyd_Param_Material *material_table, const _hyd_profile_calc_setting user_setting, const bool with_output, vector<Warning> *warnings){
+	if(with_output==true){
+		ostringstream cout;
+		cout <<"Generate tables of profile " << this->profile_number << " ... "<< endl;
+		Sys_Common_Output::output_hyd->output_txt(&cout, true);
+	}
 	this->typ_of_profile->set_user_flags(user_setting);
 
 	try{
@@ -3030,7 +3032,13 @@ void _Hyd_River_Profile::init_profile(Hyd_Param_Material *material_table, const
 		if(this->delta_x_table<=0.0){
 			Warning msg=this->set_warning(0);
 			this->delta_x_table=0.2;
-			msg.output_msg(2);
+			//in a parallel initialisation the warning is output later by the caller
+			if(warnings!=NULL){
+				warnings->push_back(msg);
+			}
+			else{
+				msg.output_msg(2);
+			}
 		}
 
 		this->typ_of_profile->calc_alloc_tables(this->delta_x_table, material_table);
@@ -3262,6 +3270,10 @@ double _Hyd_River_Profile::get_height_right_bank_abs(void){
 double _Hyd_River_Profile::get_actual_global_waterlevel(void){
 	return this->typ_of_profile->get_actual_global_waterlevel();
 }
+//Get the maximum discharge through the profile and the time point of the maximum
+_hyd_max_values _Hyd_River_Profile::get_max_q(void){
+	return this->q_value_max;
+}
 //Get the watervolume of the init-conditions in the river segment up of the profiles
 double _Hyd_River_Profile::get_watervolume_init(void){
 	return this->watervolume_init;
@@ -3275,6 +3287,11 @@ double _Hyd_River_Profile::get_watervolume_element(void){
 void _Hyd_River_Profile::calculate_hydrological_balance(const double time_point){
 	this->delta_time=time_point-this->old_time_point;
 	this->old_time_point=time_point;
+	//no coupling discharges: the volumes are not changed
+	if(this->q_left_bank==0.0 && this->q_right_bank==0.0 && this->q_1d_coupling==0.0 && this->q_structure_coupling==0.0 &&
+		this->q_dikebreak_coupling_left==0.0 && this->q_dikebreak_coupling_right==0.0){
+		return;
+	}
 	//coupling left bank
 	if(this->q_left_bank<0.0){
 		//outflow
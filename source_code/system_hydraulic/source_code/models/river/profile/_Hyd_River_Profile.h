@@ -251,8 +251,8 @@ public:
 	///Copy the boundary condition from the source global profile id to the target
 	static void copy_boundary_condition(QSqlDatabase *ptr_database, const _sys_system_id base, const int src, const int targ);
 
-	///Initialize the profile like calculation of the tables of the values h, a, c etc.
-	void init_profile(Hyd_Param_Material *material_table, const _hyd_profile_calc_setting user_setting);
+	///Initialize the profile like calculation of the tables of the values h, a, c etc.; the warnings are collected in the given list instead of being output, if it is set
+	void init_profile(Hyd_Param_Material *material_table, const _hyd_profile_calc_setting user_setting, const bool with_output=true, vector<Warning> *warnings=NULL);
 
 	///Set the initial condition to the profiles
 	virtual void set_init_condition(void);
@@ -319,6 +319,8 @@ public:
 
 	///Get the actual global waterlevel (s_value)
 	double get_actual_global_waterlevel(void);
+	///Get the maximum discharge through the profile and the time point of the maximum
+	_hyd_max_values get_max_q(void);
 
 	///Get the actual discharge through this profile
 	virtual double get_actual_river_discharge(void)=0;
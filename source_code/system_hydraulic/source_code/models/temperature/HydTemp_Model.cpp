@@ -1380,7 +1380,8 @@ void HydTemp_Model::output_result2database_2d(QSqlDatabase *ptr_database, const
 	catch (Error msg) {
 		throw msg;
 	}
-	int glob_id = HydTemp_Profile::erg_instat_table->maximum_int_of_column(HydTemp_Profile::erg_instat_table->get_column_name(label::glob_id), ptr_database) + 1;
+	//reserve the global identifiers for the profiles
+	int glob_id = HydTemp_Profile::erg_instat_table->reserve_int_of_column(HydTemp_Profile::erg_instat_table->get_column_name(label::glob_id), ptr_database, this->Param_Temp.Param_RV->get_number_profiles() - 1);
 
 	//polygon string
 	string poly_buffer;
@@ -1793,6 +1794,12 @@ void HydTemp_Model::make_syncronisation(const double time_point){
 		}
 		
 	}
+	//the heat flows of the profiles are independent from each other
+	const int number_profiles=this->Param_Temp.Param_RV->get_number_profiles();
+	#pragma omp parallel for schedule(static) if(number_profiles>=constant::min_profiles_parallel_heat_flows)
+	for(int i=0; i< number_profiles; i++){
+		this->profiles[i].calculate_heat_flows(&this->Param_Temp);
+	}
 
 }
 //Calculate the balance and the maximum values of the model
@@ -56,6 +56,7 @@ HydTemp_Profile::HydTemp_Profile(void){
 	this->phi_solar = 0.0;
 	this->phi_total = 0.0;
 	this->delta_temp_flow = 0.0;
+	this->es_air = 0.0;
 
 	this->distance2up = 0.0;
 
@@ -2535,7 +2536,6 @@ void HydTemp_Profile::copy_instat_results(QSqlDatabase *ptr_database, const _sys
 	}
 
 	int glob_id = 0;
-	glob_id = HydTemp_Profile::erg_instat_table->maximum_int_of_column(HydTemp_Profile::erg_instat_table->get_column_name(label::glob_id), ptr_database) + 1;
 
 	QSqlQueryModel model;
 	ostringstream test_filter;
@@ -2565,6 +2565,7 @@ void HydTemp_Profile::copy_instat_results(QSqlDatabase *ptr_database, const _sys
 	ostringstream cout;
 	cout << "Copy " << model.rowCount() << " instationary results of the temperature profile(s) to the new measure state..." << endl;
 	Sys_Common_Output::output_hyd->output_txt(&cout);
+	glob_id = HydTemp_Profile::erg_instat_table->reserve_int_of_column(HydTemp_Profile::erg_instat_table->get_column_name(label::glob_id), ptr_database, model.rowCount());
 	for (int i = 0; i < model.rowCount(); i++) {
 		if (i % 1000 == 0 && i > 0) {
 			cout << "Copy profile's results " << i << " to " << i + 1000 << "..." << endl;
@@ -2872,33 +2873,43 @@ void HydTemp_Profile::make_syncronisation(const int index,  const double time_po
 		this->discharge_current = this->bound_discharge.calculate_actuel_boundary_value(time_point);
 		this->waterdepth_current = this->bound_water_depth.calculate_actuel_boundary_value(time_point);
 		this->flow_velocity_current = this->bound_velocity.calculate_actuel_boundary_value(time_point);
+	}
 
 
+}
+//Calculate the heat flows and the resulting temperature difference with the syncronised boundary values; it just depends on the values of this profile
+void HydTemp_Profile::calculate_heat_flows(HydTemp_Param *params) {
+	/**
+	The boundary values are set before in make_syncronisation(). The boundary curves can be shared by the
+	profiles, therefore they are evaluated there sequentially; this calculation can be done in parallel for all profiles.
+	*/
+	if (this->water_bound_temp.applied_flag == true || this->inlet_temp.applied_flag == true) {
+		return;
+	}
+	//it is required for the evaporation and the long wave radiation
+	this->es_air = 0.61275*exp(((17.27*(this->air_temp.current_value - constant::kelvin_const)) / (237.3 + (this->air_temp.current_value - constant::kelvin_const))));
 
-		this->calc_phi_bed(params);
-		//Calculate heat flow evaporation
-		this->calc_phi_eva(params);
-		//Calculate heat flow conductivity
-		this->calc_phi_c(params);
-
-		//Calculate heat flow longwave radiation
-		this->calc_phi_lw(params);
-		//Calculate heat flow solar radiation
-		this->calc_phi_solar(params);
+	this->calc_phi_bed(params);
+	//Calculate heat flow evaporation
+	this->calc_phi_eva(params);
+	//Calculate heat flow conductivity
+	this->calc_phi_c(params);
 
-		this->phi_total = this->phi_bed + this->phi_c + this->phi_eva + this->phi_lw + this->phi_solar;
+	//Calculate heat flow longwave radiation
+	this->calc_phi_lw(params);
+	//Calculate heat flow solar radiation
+	this->calc_phi_solar(params);
 
+	this->phi_total = this->phi_bed + this->phi_c + this->phi_eva + this->phi_lw + this->phi_solar;
 
-		//Set a limit
-		double water_buff = this->waterdepth_current;
-		if (this->waterdepth_current < 0.10) {
-			water_buff = 0.10;
-		}
 
-		this->delta_temp_flow = this->phi_total / (constant::dens_water*constant::c_water*water_buff);
+	//Set a limit
+	double water_buff = this->waterdepth_current;
+	if (this->waterdepth_current < 0.10) {
+		water_buff = 0.10;
 	}
 
-
+	this->delta_temp_flow = this->phi_total / (constant::dens_water*constant::c_water*water_buff);
 }
 //Calculate the values for a temperature balance of the corresponding river segment (upstream) for each syncronisation step
 void HydTemp_Profile::calculate_temp_balance(const double time_point) {
@@ -3711,7 +3722,7 @@ void HydTemp_Profile::calc_phi_eva(HydTemp_Param *params) {
 	double ra = 0.0;
 
 	//es= 6.1275*exp(((17.27*(this->air_temp.current_value- constant::kelvin_const)) / (237.3 + (this->air_temp.current_value - constant::kelvin_const))));
-	es = 0.61275*exp(((17.27*(this->air_temp.current_value - constant::kelvin_const)) / (237.3 + (this->air_temp.current_value - constant::kelvin_const))));
+	es = this->es_air;
 	ea = es * this->humid.current_value;
 	Le = 1000 * (2501.4 + (this->temp_current - constant::kelvin_const));
 	s = 4100 * es / pow((237 + (this->air_temp.current_value - constant::kelvin_const)), 2);
@@ -3725,7 +3736,7 @@ void HydTemp_Profile::calc_phi_eva(HydTemp_Param *params) {
 void HydTemp_Profile::calc_phi_lw(HydTemp_Param *params) {
 	double es = 0.0;
 	double ea = 0.0;
-	es = 0.61275*exp((17.27*(this->air_temp.current_value - constant::kelvin_const)) / (237.3 + (this->air_temp.current_value - constant::kelvin_const)));
+	es = this->es_air;
 	ea = es * this->humid.current_value;
 	double phi_alw = 0.0;
 	double phi_lclw = 0.0;
@@ -236,6 +236,8 @@ public:
 
 	///Make the syncronistation of the elements to a given time point
 	void make_syncronisation(const int index, const double time_point, HydTemp_Param *params, HydTemp_Profile *upstream, HydTemp_Profile *downstream, Hyd_River_Profile_Connection_Standard *rv_profile);
+	///Calculate the heat flows and the resulting temperature difference with the syncronised boundary values; it just depends on the values of this profile
+	void calculate_heat_flows(HydTemp_Param *params);
 
 	///Calculate the values for a temperature balance of the corresponding river segment (upstream) for each syncronisation step
 	void calculate_temp_balance(const double time_point);
@@ -380,6 +382,8 @@ private:
 
 	///Delta tmperature by heat flow
 	double delta_temp_flow;
+	///Saturation vapour pressure by the air temperature; it is calculated once per syncronisation for the heat flows
+	double es_air;
 
 
 	
@@ -160,6 +160,14 @@ bool CModel::ValidateAndPrepareModel(void)
 	return true;
 }
 
+//Reset the time and the scheme to restart the prepared model; the domain data are written to the device with the next ValidateAndPrepareModel()
+void CModel::resetModel(void)
+{
+	this->domain->getScheme()->resetSimulation();
+	this->dCurrentTime = 0.0;
+	this->dTargetTime = 0.0;
+}
+
 //Sets the total length of a simulation
 void	CModel::setSimulationLength(double dLength)
 {
@@ -54,6 +54,7 @@ class CModel
 		unsigned int			getSelectedDevice();							// Get the device to execute on
 
 		bool					ValidateAndPrepareModel(void);					// Execute the model
+		void					resetModel(void);								// Reset the time to restart the prepared model
 		void					runModelUI( CBenchmark::sPerformanceMetrics * );// Update progress data etc.
 
 		void					logDetails();									// Spit some info out to the log
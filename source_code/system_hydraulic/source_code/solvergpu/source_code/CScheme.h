@@ -75,6 +75,7 @@ class CScheme
 		virtual void						readDomainAll() = 0;													// Read back all domain data
 		virtual void						importBoundaries() = 0;													// Read back synchronization zone data
 		virtual void						prepareSimulation() = 0;												// Set everything up to start running for this domain
+		virtual void						resetSimulation() = 0;													// Reset the time and counters to restart the prepared simulation
 		virtual void						readKeyStatistics() = 0;												// Fetch the key statistics back to the right places in memory
 		virtual void						runSimulation( double ) = 0;											// Run this simulation until the specified time
 		virtual void						cleanupSimulation() = 0;												// Dispose of transient data and clean-up this domain
@@ -876,6 +876,63 @@ void	CSchemeGodunov::prepareSimulation()
 	bThreadTerminated = false;
 }
 
+//Reset the time and counters to restart the simulation; the compiled program, the kernels and the device buffers are kept
+void	CSchemeGodunov::resetSimulation()
+{
+	// Stop the worker thread of the previous run
+	bool bWorkerActive = this->bThreadRunning;
+	this->bRunning = false;
+	this->bThreadRunning = false;
+	while (bWorkerActive && !this->bThreadTerminated && !this->bSimulationSlow && !this->bSolverThreadStopped) {
+		std::this_thread::yield();
+	}
+	this->pDomain->getDevice()->blockUntilFinished();
+
+	// Run-time tracking values
+	this->ulCurrentCellsCalculated = 0;
+	this->uiIterationsSinceTargetChanged = 0;
+	this->uiIterationsTotal = 0;
+	this->uiSuccessfulIterationsTotal = 0;
+	this->uiSkippedIterationsTotal = 0;
+	this->uiBatchSuccessful = 0;
+	this->uiBatchSkipped = 0;
+	this->dBatchTimesteps = 0.0;
+	this->dAvgTimestep = 0.0;
+	this->dCurrentTimestep = this->dTimestep;
+	this->dCurrentTimestepMovAvg = 0.0;
+	this->dCurrentTime = 0.0;
+	this->dTargetTime = 0.0;
+	this->bUpdateTargetTime = false;
+	this->bSimulationSlow = false;
+	this->bSolverThreadStopped = false;
+
+	// Time and timestep are written to the device with the next prepareSimulation()
+	if (cModel->getFloatPrecision() == model::floatPrecision::kSingle)
+	{
+		*(this->oclBufferTime->getHostBlock<float*>()) = static_cast<cl_float>(this->dCurrentTime);
+		*(this->oclBufferTimestep->getHostBlock<float*>()) = static_cast<cl_float>(this->dCurrentTimestep);
+		*(this->oclBufferTimestepMovAvg->getHostBlock<float*>()) = 0.0f;
+		*(this->oclBufferTimeHydrological->getHostBlock<float*>()) = 0.0f;
+		*(this->oclBufferTimeTarget->getHostBlock<float*>()) = 0.0f;
+		*(this->oclBufferBatchTimesteps->getHostBlock<float*>()) = 0.0f;
+	}
+	else {
+		*(this->oclBufferTime->getHostBlock<double*>()) = this->dCurrentTime;
+		*(this->oclBufferTimestep->getHostBlock<double*>()) = this->dCurrentTimestep;
+		*(this->oclBufferTimestepMovAvg->getHostBlock<double*>()) = 0.0;
+		*(this->oclBufferTimeHydrological->getHostBlock<double*>()) = 0.0;
+		*(this->oclBufferTimeTarget->getHostBlock<double*>()) = 0.0;
+		*(this->oclBufferBatchTimesteps->getHostBlock<double*>()) = 0.0;
+	}
+	*(this->oclBufferBatchSuccessful->getHostBlock<cl_uint*>()) = 0;
+	*(this->oclBufferBatchSkipped->getHostBlock<cl_uint*>()) = 0;
+	oclBufferTimeTarget->queueWriteAll();
+	oclBufferBatchTimesteps->queueWriteAll();
+	oclBufferBatchSuccessful->queueWriteAll();
+	oclBufferBatchSkipped->queueWriteAll();
+	this->pDomain->getDevice()->blockUntilFinished();
+}
+
 //Runs the actual simulation until completion or error
 void	CSchemeGodunov::runSimulation(double dTargetTime_input)
 {
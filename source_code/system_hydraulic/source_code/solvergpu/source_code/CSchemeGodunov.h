@@ -65,6 +65,7 @@ public:
 		virtual void		importBoundaries();										// Read boundary array from CPU RAM to GPU RAM
 		void				prepareSetup(CModel*, model::SchemeSettings);			// Set everything up to start running for this domain
 		virtual void		prepareSimulation();									// Set everything up to start running for this domain
+		virtual void		resetSimulation();										// Reset the time and counters to restart the prepared simulation
 		virtual void		readKeyStatistics();									// Fetch the key details back to the right places in memory
 		virtual void		runSimulation( double );								// Run this simulation until the specified time
 		virtual void		cleanupSimulation();									// Dispose of transient data and clean-up this domain
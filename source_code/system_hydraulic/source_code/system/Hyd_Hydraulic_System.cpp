@@ -13,6 +13,7 @@ Hyd_Hydraulic_System::Hyd_Hydraulic_System(void){
 	this->my_fpmodels=NULL;
 	this->my_comodel=NULL;
 	this->my_temp_model = NULL;
+	this->river_schedule=NULL;
 	this->output_time=0.0;
 	this->internal_time=0.0;
 	this->next_internal_time=0.0;
@@ -37,6 +38,7 @@ Hyd_Hydraulic_System::Hyd_Hydraulic_System(void){
 
 	this->break_sz="CA";
 	this->database_is_set=false;
+	this->number_output_buffers=Hyd_Output_Writer::default_number_buffers;
 	this->preproc_success_flag=false;
 
 	this->file_output_folder=label::not_set;
@@ -45,6 +47,8 @@ Hyd_Hydraulic_System::Hyd_Hydraulic_System(void){
 //	omp_set_dynamic(3);
 
 	this->output_is_running=false;
+	this->output_mutex=NULL;
+	this->output_finished=NULL;
 	this->output_is_allowed=false;
 	this->output_is_required=false;
 	this->temp_calc = false;
@@ -87,6 +91,7 @@ Hyd_Hydraulic_System::~Hyd_Hydraulic_System(void){
 		delete[]this->my_temp_model;
 		this->my_temp_model = NULL;
 	}
+	this->delete_river_schedule();
 
 	//count the memory
 	Sys_Memory_Count::self()->minus_mem(sizeof(Hyd_Hydraulic_System)-sizeof(Hyd_Param_Global)-sizeof(Hyd_Param_Material)-sizeof(Hyd_Coupling_Management), _sys_system_modules::HYD_SYS);
@@ -649,6 +654,7 @@ void Hyd_Hydraulic_System::create_hyd_database_tables(void){
 		//floodplain
 		Hyd_Element_Floodplain::create_erg_table(&this->database);
 		Hyd_Element_Floodplain::create_erg_instat_table(&this->database);
+		Hyd_Element_Floodplain::create_erg_instat_view(&this->database);
 		//river
 		_Hyd_River_Profile::create_erg_table(&this->database);
 		_Hyd_River_Profile::create_erg_instat_table(&this->database);
@@ -1239,6 +1245,7 @@ void Hyd_Hydraulic_System::clone_system(Hyd_Hydraulic_System *system){
 		prefix << "COUP> ";
 		Sys_Common_Output::output_hyd->set_userprefix(&prefix);
 		this->coupling_managment.clone_couplings(&system->coupling_managment, this);
+		this->set_river_schedule();
 		Sys_Common_Output::output_hyd->rewind_userprefix();
 
 		//obs points
@@ -1615,6 +1622,7 @@ void Hyd_Hydraulic_System::make_calculation(void){
 
 	try{
 		this->coupling_managment.init_output_files();
+		this->start_output_writer();
 		//loop over the output timesteps
 		for(int i=0; i < this->global_parameters.GlobTNof; i++){
 			//make the internal loop over the internal timesteps
@@ -1624,8 +1632,12 @@ void Hyd_Hydraulic_System::make_calculation(void){
 			this->output_time=this->output_time+this->global_parameters.GlobTStep;
 			this->timestep_counter++;
 		}
+		//wait for the output of the last snapshots
+		this->output_writer.finish_writer();
+		this->output_writer.close_writer();
 	}
 	catch(Error msg){
+		this->output_writer.close_writer();
 		this->set_final_warning_number();
 		throw msg;
 	}
@@ -1812,7 +1824,14 @@ void Hyd_Hydraulic_System::output_final_model_statistics(const bool all_output){
 						this->my_rvmodels[j].output_result_max2paraview2d();
 					}
 				}
-				if (this->global_parameters.get_output_flags().tecplot_1d_required == false && this->global_parameters.get_output_flags().paraview_1d_required == false) {
+				if (this->global_parameters.get_output_flags().binary_1d_required == true) {
+					cout << "for binary 1d..." << endl;
+					Sys_Common_Output::output_hyd->output_txt(&cout);
+					for (int j = 0; j < this->global_parameters.GlobNofRV; j++) {
+						this->my_rvmodels[j].output_result_max2binary();
+					}
+				}
+				if (this->global_parameters.get_output_flags().tecplot_1d_required == false && this->global_parameters.get_output_flags().paraview_1d_required == false && this->global_parameters.get_output_flags().binary_1d_required == false) {
 					cout << "No output required..." << endl;
 					Sys_Common_Output::output_hyd->output_txt(&cout);
 				}
@@ -1861,7 +1880,14 @@ void Hyd_Hydraulic_System::output_final_model_statistics(const bool all_output){
 						this->my_fpmodels[j].output_result_max2paraview();
 					}
 				}
-				if (this->global_parameters.get_output_flags().tecplot_2d_required == false && this->global_parameters.get_output_flags().paraview_2d_required == false) {
+				if (this->global_parameters.get_output_flags().binary_2d_required == true) {
+					cout << "for binary 2d..." << endl;
+					Sys_Common_Output::output_hyd->output_txt(&cout);
+					for (int j = 0; j < this->global_parameters.GlobNofFP; j++) {
+						this->my_fpmodels[j].close_binary_output();
+					}
+				}
+				if (this->global_parameters.get_output_flags().tecplot_2d_required == false && this->global_parameters.get_output_flags().paraview_2d_required == false && this->global_parameters.get_output_flags().binary_2d_required == false) {
 					cout << "No output required..." << endl;
 					Sys_Common_Output::output_hyd->output_txt(&cout);
 				}
@@ -2215,6 +2241,13 @@ void Hyd_Hydraulic_System::set_ptr2database(QSqlDatabase database, const int thr
 	}
 	this->thread_number=thread_number;
 }
+//Set the number of snapshot buffers for the output of the instationary floodplain results to database in an own thread; 0 means output directly by the calculation thread
+void Hyd_Hydraulic_System::set_number_output_buffers(const int number){
+	this->number_output_buffers=number;
+	if(this->number_output_buffers<0){
+		this->number_output_buffers=0;
+	}
+}
 //Total reset of the hydraulic system
 void Hyd_Hydraulic_System::total_reset(void){
 	ostringstream cout;
@@ -2232,6 +2265,7 @@ void Hyd_Hydraulic_System::total_reset(void){
 		delete this->my_comodel;
 		this->my_comodel=NULL;
 	}
+	this->delete_river_schedule();
 	this->output_time=0.0;
 	this->internal_time=0.0;
 	this->next_internal_time=0.0;
@@ -2328,6 +2362,9 @@ void Hyd_Hydraulic_System::set_folder_name(const string sc_name, const bool crea
 			if (this->global_parameters.get_output_flags().paraview_1d_required == true || this->global_parameters.get_output_flags().paraview_2d_required == true) {
 				my_dir.mkdir(hyd_label::paraview.c_str());
 			}
+			if (this->global_parameters.get_output_flags().binary_1d_required == true || this->global_parameters.get_output_flags().binary_2d_required == true) {
+				my_dir.mkdir(hyd_label::binary.c_str());
+			}
 
 
 
@@ -2383,6 +2420,9 @@ void Hyd_Hydraulic_System::set_folder_name_file(void) {
 		if (this->global_parameters.get_output_flags().paraview_1d_required == true || this->global_parameters.get_output_flags().paraview_2d_required == true) {
 			my_dir.mkdir(hyd_label::paraview.c_str());
 		}
+		if (this->global_parameters.get_output_flags().binary_1d_required == true || this->global_parameters.get_output_flags().binary_2d_required == true) {
+			my_dir.mkdir(hyd_label::binary.c_str());
+		}
 		this->file_output_folder = buffer.str();
 
 		//set if they are already allocated to the models
@@ -2498,6 +2538,11 @@ void Hyd_Hydraulic_System::set_output_is_allowed(void){
 		this->output_is_allowed=false;
 	}
 }
+//Set the mutex, which guards the output flags, and the wait condition, which is woken, if an output is finished (multiple hydraulic systems)
+void Hyd_Hydraulic_System::set_output_synchronisation(QMutex *mutex, QWaitCondition *finished){
+	this->output_mutex=mutex;
+	this->output_finished=finished;
+}
 //Input just the river models per database (used in the Alt_System)
 void Hyd_Hydraulic_System::input_just_river_models(QSqlDatabase *ptr_database, const bool with_output){
 	this->global_parameters.globals_per_database(ptr_database, with_output);
@@ -2582,6 +2627,18 @@ void Hyd_Hydraulic_System::set_temp_calc_apply(const bool flag) {
 }
 //______________
 //private
+//Set the flag, if the output to display is running; if the output is finished, the waiting coordinator is woken
+void Hyd_Hydraulic_System::set_output_is_running(const bool flag){
+	if(this->output_mutex==NULL){
+		this->output_is_running=flag;
+		return;
+	}
+	QMutexLocker locker(this->output_mutex);
+	this->output_is_running=flag;
+	if(flag==false && this->output_finished!=NULL){
+		this->output_finished->wakeAll();
+	}
+}
 //Output final statistic of the system
 void Hyd_Hydraulic_System::output_final_system_statistics(void){
 	//set prefix for output
@@ -2695,6 +2752,10 @@ void Hyd_Hydraulic_System::transfer_floodplainmodel_data2database(QSqlDatabase *
 		Sys_Common_Output::output_hyd->output_txt(&cout);
 	}
 
+	if(this->global_parameters.GlobNofFP<=0){
+		return;
+	}
+
 	try{
 		//transfer the data of Hyd_Model_River
 		for (int j =0; j < this->global_parameters.GlobNofFP; j++){
@@ -2706,6 +2767,21 @@ void Hyd_Hydraulic_System::transfer_floodplainmodel_data2database(QSqlDatabase *
 	catch(Error msg){
 		throw msg;
 	}
+
+	//the spatial index of the element polygons is created once after the loading, if it does not exist yet (just PostgreSQL)
+	if(Data_Base::get_driver_type()==_sys_driver_type::POSTGRESQL){
+		cout<<"Create the spatial index of the floodplain elements..." <<endl;
+		Sys_Common_Output::output_hyd->output_txt(&cout);
+		string error_text;
+		if(Hyd_Element_Floodplain::elem_table->create_spatial_index2column(ptr_database, Hyd_Element_Floodplain::elem_table->get_column_name(hyd_label::elemdata_polygon), &error_text)==false){
+			Warning msg=this->set_warning(3);
+			ostringstream info;
+			info << "Table Name                : " << Hyd_Element_Floodplain::elem_table->get_table_name() << endl;
+			info << "Table error info          : " << error_text << endl;
+			msg.make_second_info(info.str());
+			msg.output_msg(2);
+		}
+	}
 }
 //Read in the floodplain models of the system from a database
 void Hyd_Hydraulic_System::input_floodplains_models(const QSqlTableModel *query_result, QSqlDatabase *ptr_database, const bool just_elems){
@@ -3263,6 +3339,7 @@ void Hyd_Hydraulic_System::init_automatic_coupling(void){
 	Sys_Common_Output::output_hyd->set_userprefix(prefix.str());
 	try{
 		this->coupling_managment.init_couplings();
+		this->set_river_schedule();
 	}
 	catch(Error msg){
 		throw msg;
@@ -3436,7 +3513,7 @@ void Hyd_Hydraulic_System::make_calculation_internal(void){
 	this->coupling_managment.output_coupling_calculation_steps2file(this->internal_time);
 	Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
 
-	this->output_is_running=false;
+	this->set_output_is_running(false);
 	this->output_is_allowed=false;
 	this->output_is_required=true;
 	emit output_required(this->thread_number);
@@ -3452,7 +3529,7 @@ void Hyd_Hydraulic_System::make_calculation_internal(void){
 	}
 	Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
 	this->output_is_required=false;
-	this->output_is_running=false;
+	this->set_output_is_running(false);
 	this->output_is_allowed=false;
 
 	//reset internal timestep counter
@@ -3531,7 +3608,7 @@ void Hyd_Hydraulic_System::make_temp_calculation_internal(void) {
 
 	Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
 
-	this->output_is_running = false;
+	this->set_output_is_running(false);
 	this->output_is_allowed = false;
 	this->output_is_required = true;
 	emit output_required(this->thread_number);
@@ -3546,7 +3623,7 @@ void Hyd_Hydraulic_System::make_temp_calculation_internal(void) {
 	}
 	Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
 	this->output_is_required = false;
-	this->output_is_running = false;
+	this->set_output_is_running(false);
 	this->output_is_allowed = false;
 
 	//reset internal timestep counter
@@ -3626,18 +3703,116 @@ void Hyd_Hydraulic_System::reset_solver_rv_models(void){
 }
 //make the calculation of the river models
 void Hyd_Hydraulic_System::make_calculation_rivermodel(void){
-	//solve it
-	for(int i=0; i< this->global_parameters.GlobNofRV;i++){
-		Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
-		this->my_rvmodels[i].solve_model(this->next_internal_time-this->global_parameters.get_startime(), this->get_identifier_prefix(false));
+	Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
+	if(this->river_schedule==NULL){
+		this->set_river_schedule();
+	}
+	const int number_rv=this->global_parameters.GlobNofRV;
+	const double time_point=this->next_internal_time-this->global_parameters.get_startime();
+	const string system_id=this->get_identifier_prefix(false);
+	//solve it; the river models are independent within an internal step, because the RV2RV-couplings exchange
+	//their discharges just in the syncronisation; the error of the first failed river in the schedule is thrown after the loop
+	int failed_position=number_rv;
+	Error failed_msg;
+	#pragma omp parallel for schedule(dynamic) if(number_rv>1)
+	for(int i=0; i< number_rv; i++){
+		try{
+			Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
+			this->my_rvmodels[this->river_schedule[i]].solve_model(time_point, system_id);
+		}
+		catch(Error msg){
+			#pragma omp critical
+			{
+				if(i<failed_position){
+					failed_position=i;
+					failed_msg=msg;
+				}
+			}
+		}
+		//no other exception may leave the parallel region
+		catch(bad_alloc &t){
+			#pragma omp critical
+			{
+				if(i<failed_position){
+					failed_position=i;
+					failed_msg=this->set_error(4);
+					ostringstream info;
+					info << "Info bad alloc: " << t.what() << endl;
+					info << "River model   : " << this->river_schedule[i] << endl;
+					failed_msg.make_second_info(info.str());
+				}
+			}
+		}
+		catch(...){
+			#pragma omp critical
+			{
+				if(i<failed_position){
+					failed_position=i;
+					failed_msg=this->set_error(5);
+					ostringstream info;
+					info << "River model   : " << this->river_schedule[i] << endl;
+					failed_msg.make_second_info(info.str());
+				}
+			}
+		}
+	}
+	if(failed_position<number_rv){
+		throw failed_msg;
 	}
 }
 //Make the calculation of the temperature models for each internal step
 void Hyd_Hydraulic_System::make_calculation_tempmodel(void) {
-	//solve it
-	for (int i = 0; i < this->global_parameters.GlobNofRV; i++) {
-		Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
-		this->my_temp_model[i].solve_model(this->next_internal_time - this->global_parameters.get_startime(), this->get_identifier_prefix(false));
+	Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
+	const int number_rv=this->global_parameters.GlobNofRV;
+	const double time_point=this->next_internal_time-this->global_parameters.get_startime();
+	const string system_id=this->get_identifier_prefix(false);
+	//solve it; the temperature models are independent from each other; the error of the first failed model is thrown after the loop
+	int failed_position=number_rv;
+	Error failed_msg;
+	#pragma omp parallel for schedule(dynamic) if(number_rv>1)
+	for (int i = 0; i < number_rv; i++) {
+		try{
+			Hyd_Multiple_Hydraulic_Systems::check_stop_thread_flag();
+			this->my_temp_model[i].solve_model(time_point, system_id);
+		}
+		catch(Error msg){
+			#pragma omp critical
+			{
+				if(i<failed_position){
+					failed_position=i;
+					failed_msg=msg;
+				}
+			}
+		}
+		//no other exception may leave the parallel region
+		catch(bad_alloc &t){
+			#pragma omp critical
+			{
+				if(i<failed_position){
+					failed_position=i;
+					failed_msg=this->set_error(6);
+					ostringstream info;
+					info << "Info bad alloc: " << t.what() << endl;
+					info << "Temperature model : " << i << endl;
+					failed_msg.make_second_info(info.str());
+				}
+			}
+		}
+		catch(...){
+			#pragma omp critical
+			{
+				if(i<failed_position){
+					failed_position=i;
+					failed_msg=this->set_error(7);
+					ostringstream info;
+					info << "Temperature model : " << i << endl;
+					failed_msg.make_second_info(info.str());
+				}
+			}
+		}
+	}
+	if(failed_position<number_rv){
+		throw failed_msg;
 	}
 }
 //Make the syncronisation of the floodplain models for each internal step
@@ -3787,6 +3962,12 @@ void Hyd_Hydraulic_System::output_calculation_steps_rivermodel2file(const double
 			}
 
 		}
+		if (this->global_parameters.get_output_flags().binary_1d_required == true) {
+			for (int i = 0; i < this->global_parameters.GlobNofRV; i++) {
+				//append to the binary result time series
+				this->my_rvmodels[i].output_result2binary_1d(timestep);
+			}
+		}
 	}
 }
 //Output the calculation steps (time, solversteps etc) of the river models to display/console
@@ -3907,6 +4088,12 @@ void Hyd_Hydraulic_System::output_calculation_steps_floodplainmodel2file(const d
 				this->my_fpmodels[i].output_result2paraview(timestep, this->timestep_counter);
 			}
 		}
+		if (this->global_parameters.get_output_flags().binary_2d_required == true) {
+			for (int i = 0; i < this->global_parameters.GlobNofFP; i++) {
+				//append to the binary result store
+				this->my_fpmodels[i].output_result2binary(timestep);
+			}
+		}
 	}
 }
 //Output the results of the calculation steps of the floodplain models to display/console
@@ -3938,6 +4125,11 @@ void Hyd_Hydraulic_System::output_calculation_steps_floodplainmodel2database(con
 	}
 
 	
+	//the results are copied and written by the output writer
+	if (this->output_writer.get_writer_active() == true) {
+		this->output_writer.take_snapshot(this->break_sz, time);
+		return;
+	}
 	//loop over the floodplain models
 	for (int i = 0; i < this->global_parameters.GlobNofFP; i++) {
 		//to database 
@@ -3948,6 +4140,22 @@ void Hyd_Hydraulic_System::output_calculation_steps_floodplainmodel2database(con
 		
 	}
 }
+//Initialize and start the output writer for the instationary floodplain results, if it is required
+void Hyd_Hydraulic_System::start_output_writer(void) {
+	if (this->database_is_set == false || this->number_output_buffers <= 0 || this->global_parameters.GlobNofFP <= 0) {
+		return;
+	}
+	if (this->global_parameters.get_output_flags().database_instat_required == false) {
+		return;
+	}
+	try {
+		this->output_writer.init_writer(&this->database, this->thread_number, this->my_fpmodels, this->global_parameters.GlobNofFP, this->number_output_buffers);
+	}
+	catch (Error msg) {
+		throw msg;
+	}
+	this->output_writer.start_writer();
+}
 //Clear all not needed data of the models before the solver is initialized
 void Hyd_Hydraulic_System::clear_models(void){
 	ostringstream cout;
@@ -4011,7 +4219,7 @@ void Hyd_Hydraulic_System::waitloop_output_calculation2display(void){
 		this->msleep(3+this->thread_number*2);
 		emit output_required(this->thread_number);
 	}
-	this->output_is_running=true;
+	this->set_output_is_running(true);
 }
 //Check if OpenCl is available on the system
 void Hyd_Hydraulic_System::check_opencl_available() {
@@ -4115,6 +4323,131 @@ double Hyd_Hydraulic_System::check_internal_timestep(void){
 
 	return new_timestep;
 }
+//Set the calculation order of the river models after their RV2RV-couplings (topological order)
+void Hyd_Hydraulic_System::set_river_schedule(void){
+/**A river, which discharges into another river (tributary) or into a diversion channel, is placed before the
+receiving river. Rivers without a dependency are ordered by their index; rivers in a cyclic coupling are taken
+by their index, too. The order is just the order of dispatching the river models in make_calculation_rivermodel(void);
+the results do not depend on it.
+*/
+	this->delete_river_schedule();
+	const int number_rv=this->global_parameters.GlobNofRV;
+	if(number_rv<=0 || this->my_rvmodels==NULL){
+		return;
+	}
+	const int number_rv2rv=this->coupling_managment.get_rv2rv();
+	const int number_diversion=this->coupling_managment.get_rv2rv_diversion();
+	const int max_edges=number_rv2rv+2*number_diversion;
+
+	int *in_degree=NULL;
+	bool *scheduled=NULL;
+	int *edges=NULL;
+	try{
+		this->river_schedule=new int[number_rv];
+		in_degree=new int[number_rv];
+		scheduled=new bool[number_rv];
+		edges=new int[2*max_edges+1];
+	}
+	catch(bad_alloc &t){
+		if(in_degree!=NULL){
+			delete []in_degree;
+		}
+		if(scheduled!=NULL){
+			delete []scheduled;
+		}
+		Error msg=this->set_error(3);
+		ostringstream info;
+		info<< "Info bad alloc: " << t.what() << endl;
+		msg.make_second_info(info.str());
+		throw msg;
+	}
+	for(int i=0; i<number_rv; i++){
+		in_degree[i]=0;
+		scheduled[i]=false;
+	}
+
+	//collect the edges (upstream river => downstream river) of the couplings
+	int number_edges=0;
+	Hyd_Model_River *upstream=NULL;
+	Hyd_Model_River *downstream=NULL;
+	for(int i=0; i<max_edges; i++){
+		upstream=NULL;
+		downstream=NULL;
+		if(i<number_rv2rv){
+			if(this->coupling_managment.coupling_rv2rv[i].get_coupling_flag_inflow()==true){
+				upstream=this->coupling_managment.coupling_rv2rv[i].get_outflow_rv_model();
+				downstream=this->coupling_managment.coupling_rv2rv[i].get_inflow_rv_model();
+			}
+		}
+		else{
+			Hyd_Coupling_RV2RV_Diversion *diversion=&this->coupling_managment.coupling_1d_diversion[(i-number_rv2rv)/2];
+			if((i-number_rv2rv)%2==0){
+				//river => diversion channel
+				if(diversion->get_coupling_flag_inflow()==true){
+					upstream=diversion->get_inflow_rv_model();
+					downstream=diversion->get_diversion_rv_model();
+				}
+			}
+			else{
+				//diversion channel => river
+				if(diversion->get_outflow_river_flag()==true && diversion->get_coupling_flag_outflow()==true){
+					upstream=diversion->get_diversion_rv_model();
+					downstream=diversion->get_outflow_rv_model();
+				}
+			}
+		}
+		if(upstream==NULL || downstream==NULL || upstream==downstream){
+			continue;
+		}
+		const int index_up=(int)(upstream-this->my_rvmodels);
+		const int index_down=(int)(downstream-this->my_rvmodels);
+		if(index_up<0 || index_up>=number_rv || index_down<0 || index_down>=number_rv){
+			continue;
+		}
+		edges[2*number_edges]=index_up;
+		edges[2*number_edges+1]=index_down;
+		in_degree[index_down]++;
+		number_edges++;
+	}
+
+	//order the rivers (Kahn); ties are broken by the river index
+	for(int pos=0; pos<number_rv; pos++){
+		int next=-1;
+		for(int i=0; i<number_rv; i++){
+			if(scheduled[i]==false && in_degree[i]==0){
+				next=i;
+				break;
+			}
+		}
+		//cyclic coupling: take the first river left
+		if(next<0){
+			for(int i=0; i<number_rv; i++){
+				if(scheduled[i]==false){
+					next=i;
+					break;
+				}
+			}
+		}
+		scheduled[next]=true;
+		this->river_schedule[pos]=next;
+		for(int j=0; j<number_edges; j++){
+			if(edges[2*j]==next && scheduled[edges[2*j+1]]==false){
+				in_degree[edges[2*j+1]]--;
+			}
+		}
+	}
+
+	delete []in_degree;
+	delete []scheduled;
+	delete []edges;
+}
+//Delete the calculation order of the river models
+void Hyd_Hydraulic_System::delete_river_schedule(void){
+	if(this->river_schedule!=NULL){
+		delete []this->river_schedule;
+		this->river_schedule=NULL;
+	}
+}
 //set the error
 Error Hyd_Hydraulic_System::set_error(const int err_type){
 	string place="Hyd_Hydraulic_System::";
@@ -4143,6 +4476,36 @@ Error Hyd_Hydraulic_System::set_error(const int err_type){
 			help="Check the coastline polysegment; change the point order";
 			type=11;
 			break;
+		case 3://bad alloc
+			place.append("set_river_schedule(void)");
+			reason="Can not allocate the memory";
+			help="Check the memory";
+			type=10;
+			break;
+		case 4://bad alloc
+			place.append("make_calculation_rivermodel(void)");
+			reason="Can not allocate the memory in the calculation of a river model";
+			help="Check the memory";
+			type=10;
+			break;
+		case 5://unknown exception
+			place.append("make_calculation_rivermodel(void)");
+			reason="An unknown exception occurred in the calculation of a river model";
+			help="Check the river model";
+			type=6;
+			break;
+		case 6://bad alloc
+			place.append("make_calculation_tempmodel(void)");
+			reason="Can not allocate the memory in the calculation of a temperature model";
+			help="Check the memory";
+			type=10;
+			break;
+		case 7://unknown exception
+			place.append("make_calculation_tempmodel(void)");
+			reason="An unknown exception occurred in the calculation of a temperature model";
+			help="Check the temperature model";
+			type=6;
+			break;
 		default:
 			place.append("set_error(const int err_type)");
 			reason ="Unknown flag!";
@@ -4185,6 +4548,13 @@ Warning Hyd_Hydraulic_System::set_warning(const int warn_type){
 			help = "Install an OpenCL runtime based on your GPU Vendor.";
 			type = 11;
 			break;
+		case 3://spatial index can not be created
+			place.append("transfer_floodplainmodel_data2database(QSqlDatabase *ptr_database)");
+			reason="Can not create the spatial index of the floodplain element polygons";
+			reaction="The elements are transferred without a spatial index";
+			help="Check the database";
+			type=2;
+			break;
 		default:
 			place.append("set_warning(const int warn_type)");
 			reason ="Unknown flag!";
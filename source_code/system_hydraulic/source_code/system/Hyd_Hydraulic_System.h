@@ -33,6 +33,8 @@
 
 //Observation points in the models
 #include "Hyd_Observation_Point_Manager.h"
+//Output of the instationary results in an own thread
+#include "Hyd_Output_Writer.h"
 
 //system_sys_ classes
 #include "_Sys_Common_System.h"
@@ -231,6 +233,8 @@ public:
 	void set_ptr2database(QSqlDatabase *ptr_database, const int thread_number);
 	///Set a the database without making a copy of the database connection
 	void set_ptr2database(QSqlDatabase database, const int thread_number);
+	///Set the number of snapshot buffers for the output of the instationary floodplain results to database in an own thread; 0 means output directly by the calculation thread
+	void set_number_output_buffers(const int number);
 
 	///Total reset of the hydraulic system
 	void total_reset(void);
@@ -270,6 +274,8 @@ public:
 	bool get_output_is_required(void);
 	///Set that an output is allowed
 	void set_output_is_allowed(void);
+	///Set the mutex, which guards the output flags, and the wait condition, which is woken, if an output is finished (multiple hydraulic systems)
+	void set_output_synchronisation(QMutex *mutex, QWaitCondition *finished);
 
 	///Input just the river models per database (used in the Alt_System)
 	void input_just_river_models(QSqlDatabase *ptr_database, const bool with_output=true);
@@ -345,11 +351,18 @@ private:
 	///Identifer string 
 	string identifier_str;
 
+	///Calculation order of the river models per internal step; a river discharging via a RV2RV-coupling is placed before the receiving river
+	int *river_schedule;
+
 	//Future holder for multithreading
 	std::vector<std::future<void>> m_futures;
 
 	///Output to display is on the way
 	bool output_is_running;
+	///Mutex of the coordinating multiple hydraulic systems, which guards the output flags; it is not set for a single system
+	QMutex *output_mutex;
+	///Wait condition of the coordinating multiple hydraulic systems, which is woken, if the output is finished
+	QWaitCondition *output_finished;
 	///Output to display is allowed
 	bool output_is_allowed;
 	///Output to display is required
@@ -366,6 +379,11 @@ private:
 	///Flag if the database is set, the calculation is done via database
 	bool database_is_set;
 
+	///Writer for the output of the instationary floodplain results to database in an own thread
+	Hyd_Output_Writer output_writer;
+	///Number of snapshot buffers of the output writer; 0 means output directly by the calculation thread
+	int number_output_buffers;
+
 	///Flag if the preprocessing was succesful
 	bool preproc_success_flag;
 
@@ -379,6 +397,8 @@ private:
 	Profiler profiler;
 
 	//methods 
+	///Set the flag, if the output to display is running; if the output is finished, the waiting coordinator is woken
+	void set_output_is_running(const bool flag);
 
 	///Output final statistics of the system
 	void output_final_system_statistics(void);
@@ -501,6 +521,8 @@ private:
 	void output_calculation_steps_floodplainmodel2display(const double timestep);
 	///Output the results of the calculation steps of the floodplain models to database
 	void output_calculation_steps_floodplainmodel2database(const double timestep, const string time);
+	///Initialize and start the output writer for the instationary floodplain results, if it is required
+	void start_output_writer(void);
 
 	///Clear all not needed data of the models before the solver is initialized
 	void clear_models(void);
@@ -525,6 +547,11 @@ private:
 	///Check the internal time steps
 	double check_internal_timestep(void);
 
+	///Set the calculation order of the river models after their RV2RV-couplings (topological order)
+	void set_river_schedule(void);
+	///Delete the calculation order of the river models
+	void delete_river_schedule(void);
+
 	///Set error(s)
 	Error set_error(const int err_type);
 	///Set warning(s)
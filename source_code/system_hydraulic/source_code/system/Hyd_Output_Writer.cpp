@@ -0,0 +1,330 @@
+#include "Hyd_Headers_Precompiled.h"
+//#include "Hyd_Output_Writer.h"
+
+//Default constructor
+Hyd_Output_Writer::Hyd_Output_Writer(void){
+	this->connection_name=label::not_set;
+	this->connection_state=0;
+	this->init_flag=false;
+	this->fp_models=NULL;
+	this->number_fp=0;
+	this->snapshots=NULL;
+	this->number_buffers=0;
+	this->first_full=0;
+	this->number_full=0;
+	this->stop_flag=false;
+	this->abort_flag=false;
+	this->error_flag=false;
+
+	//count the memory
+	Sys_Memory_Count::self()->add_mem(sizeof(Hyd_Output_Writer), _sys_system_modules::HYD_SYS);
+}
+//Default destructor
+Hyd_Output_Writer::~Hyd_Output_Writer(void){
+	this->close_writer();
+	//count the memory
+	Sys_Memory_Count::self()->minus_mem(sizeof(Hyd_Output_Writer), _sys_system_modules::HYD_SYS);
+}
+//____________
+//public
+//Initialize the writer: the snapshot buffers are allocated and the connection of the database is set for the writer thread
+void Hyd_Output_Writer::init_writer(QSqlDatabase *ptr_database, const int thread_number, Hyd_Model_Floodplain *fp_models, const int number_fp, const int number_buffers){
+	/**The writer thread clones its own connection from the given one by the connection name. If the connection
+	can not be opened, the writer thread is not running and the results are output directly by the calculation thread.
+	*/
+	this->close_writer();
+	this->fp_models=fp_models;
+	this->number_fp=number_fp;
+	this->number_buffers=number_buffers;
+
+	try{
+		this->allocate_snapshots();
+	}
+	catch(Error msg){
+		throw msg;
+	}
+
+	//the writer thread needs an own connection
+	ostringstream buff;
+	buff<<sys_label::str_hyd<<"_"<<thread_number<<"_output";
+	this->connection_name=buff.str();
+	this->source_connection=ptr_database->connectionName();
+	this->init_flag=true;
+}
+//Stop the writer thread without writing the remaining snapshots, delete the snapshot buffers and close the database connection
+void Hyd_Output_Writer::close_writer(void){
+	this->abort_writer();
+	this->delete_snapshots();
+	this->connection_name=label::not_set;
+	this->source_connection.clear();
+	this->init_flag=false;
+}
+//Get if the writer is initialized
+bool Hyd_Output_Writer::get_writer_initialized(void){
+	return this->init_flag;
+}
+//Get if the snapshots are handed to the writer: the writer thread is running or it is ended by an error, which is not yet thrown
+bool Hyd_Output_Writer::get_writer_active(void){
+	QMutexLocker locker(&this->mutex);
+	return (this->isRunning()==true || this->error_flag==true);
+}
+//Start the writer thread
+void Hyd_Output_Writer::start_writer(void){
+	if(this->init_flag==false || this->isRunning()==true){
+		return;
+	}
+	this->first_full=0;
+	this->number_full=0;
+	this->stop_flag=false;
+	this->abort_flag=false;
+	this->error_flag=false;
+	this->connection_state=0;
+	this->start();
+
+	//wait for the database connection of the writer thread
+	this->mutex.lock();
+	while(this->connection_state==0){
+		this->condition_free.wait(&this->mutex);
+	}
+	this->mutex.unlock();
+	if(this->connection_state<0){
+		//the results are output directly by the calculation thread
+		this->wait();
+	}
+}
+//Copy the instationary results of the floodplain models to a free snapshot buffer and hand it to the writer thread; if all buffers are in use, it waits until the oldest snapshot is written
+void Hyd_Output_Writer::take_snapshot(const string break_sz, const string time){
+	QMutexLocker locker(&this->mutex);
+	while(this->number_full==this->number_buffers && this->error_flag==false){
+		this->condition_free.wait(&this->mutex);
+	}
+	if(this->error_flag==true){
+		throw this->writer_error;
+	}
+	int index=(this->first_full+this->number_full)%this->number_buffers;
+	//the free buffer is not used by the writer thread
+	locker.unlock();
+
+	this->snapshots[index].break_sz=break_sz;
+	this->snapshots[index].time=time;
+	for(int i=0; i<this->number_fp; i++){
+		this->snapshots[index].number_elems[i]=this->fp_models[i].copy_instat_results2snapshot(this->snapshots[index].index_elems[i], this->snapshots[index].values_elems[i]);
+	}
+
+	locker.relock();
+	this->number_full++;
+	this->condition_full.wakeOne();
+}
+//Wait until all snapshots are written and stop the writer thread; an error of the writer thread is thrown
+void Hyd_Output_Writer::finish_writer(void){
+	//the writer thread may be already ended by an error
+	if(this->isRunning()==true){
+		this->mutex.lock();
+		this->stop_flag=true;
+		this->condition_full.wakeOne();
+		this->mutex.unlock();
+		this->wait();
+	}
+
+	if(this->error_flag==true){
+		this->error_flag=false;
+		throw this->writer_error;
+	}
+}
+//Stop the writer thread without writing the remaining snapshots
+void Hyd_Output_Writer::abort_writer(void){
+	if(this->isRunning()==false){
+		return;
+	}
+	this->mutex.lock();
+	this->abort_flag=true;
+	this->condition_full.wakeOne();
+	this->mutex.unlock();
+	this->wait();
+	this->error_flag=false;
+}
+//____________
+//protected
+//Write the snapshots to the database in the order of their taking (thread function)
+void Hyd_Output_Writer::run(void){
+	//the connection is created, used and removed in this thread
+	{
+		QSqlDatabase database=QSqlDatabase::cloneDatabase(this->source_connection, this->connection_name.c_str());
+		database.open();
+
+		this->mutex.lock();
+		if(database.isOpen()==true){
+			this->connection_state=1;
+		}
+		else{
+			this->connection_state=-1;
+		}
+		this->condition_free.wakeAll();
+		this->mutex.unlock();
+
+		if(database.isOpen()==true){
+			this->write_snapshots(&database);
+			database.close();
+		}
+	}
+	QSqlDatabase::removeDatabase(this->connection_name.c_str());
+}
+//____________
+//private
+//Allocate the snapshot buffers
+void Hyd_Output_Writer::allocate_snapshots(void){
+	this->delete_snapshots();
+	try{
+		this->snapshots=new _hyd_output_snapshot[this->number_buffers];
+		for(int i=0; i<this->number_buffers; i++){
+			this->snapshots[i].number_elems=NULL;
+			this->snapshots[i].index_elems=NULL;
+			this->snapshots[i].values_elems=NULL;
+		}
+		for(int i=0; i<this->number_buffers; i++){
+			this->snapshots[i].number_elems=new int[this->number_fp];
+			this->snapshots[i].index_elems=new int*[this->number_fp];
+			for(int j=0; j<this->number_fp; j++){
+				this->snapshots[i].number_elems[j]=0;
+				this->snapshots[i].index_elems[j]=NULL;
+			}
+			this->snapshots[i].values_elems=new double*[this->number_fp];
+			for(int j=0; j<this->number_fp; j++){
+				this->snapshots[i].values_elems[j]=NULL;
+			}
+			for(int j=0; j<this->number_fp; j++){
+				this->snapshots[i].index_elems[j]=new int[this->fp_models[j].get_number_elements()];
+				this->snapshots[i].values_elems[j]=new double[this->fp_models[j].get_number_elements()*_Hyd_Element_Floodplain_Type::number_instat_values];
+				Sys_Memory_Count::self()->add_mem((sizeof(int)+sizeof(double)*_Hyd_Element_Floodplain_Type::number_instat_values)*this->fp_models[j].get_number_elements(), _sys_system_modules::HYD_SYS);
+			}
+		}
+	}
+	catch(bad_alloc &t){
+		Error msg=this->set_error(0);
+		ostringstream info;
+		info<< "Info bad alloc: " << t.what() << endl;
+		msg.make_second_info(info.str());
+		throw msg;
+	}
+}
+//Write the snapshots via the database connection of the writer thread
+void Hyd_Output_Writer::write_snapshots(QSqlDatabase *ptr_database){
+	int index=0;
+	while(true){
+		this->mutex.lock();
+		while(this->number_full==0 && this->stop_flag==false && this->abort_flag==false){
+			this->condition_full.wait(&this->mutex);
+		}
+		if(this->abort_flag==true || (this->number_full==0 && this->stop_flag==true)){
+			this->mutex.unlock();
+			break;
+		}
+		index=this->first_full;
+		this->mutex.unlock();
+
+		//the calculation thread gets an error with the next snapshot or at the end
+		try{
+			for(int i=0; i<this->number_fp; i++){
+				this->fp_models[i].output_snapshot2database(ptr_database, this->snapshots[index].break_sz, this->snapshots[index].time, this->snapshots[index].number_elems[i], this->snapshots[index].index_elems[i], this->snapshots[index].values_elems[i]);
+			}
+		}
+		catch(Error msg){
+			this->store_writer_error(msg);
+			break;
+		}
+		catch(bad_alloc &t){
+			Error msg=this->set_error(1);
+			ostringstream info;
+			info<< "Info bad alloc: " << t.what() << endl;
+			msg.make_second_info(info.str());
+			this->store_writer_error(msg);
+			break;
+		}
+		catch(...){
+			Error msg=this->set_error(2);
+			this->store_writer_error(msg);
+			break;
+		}
+
+		this->mutex.lock();
+		this->first_full=(this->first_full+1)%this->number_buffers;
+		this->number_full--;
+		this->condition_free.wakeAll();
+		this->mutex.unlock();
+	}
+}
+//Store an error of the writer thread for the calculation thread
+void Hyd_Output_Writer::store_writer_error(Error msg){
+	this->mutex.lock();
+	this->writer_error=msg;
+	this->error_flag=true;
+	this->condition_free.wakeAll();
+	this->mutex.unlock();
+}
+//Delete the snapshot buffers
+void Hyd_Output_Writer::delete_snapshots(void){
+	if(this->snapshots==NULL){
+		return;
+	}
+	for(int i=0; i<this->number_buffers; i++){
+		for(int j=0; j<this->number_fp; j++){
+			if(this->snapshots[i].values_elems!=NULL && this->snapshots[i].values_elems[j]!=NULL){
+				delete []this->snapshots[i].index_elems[j];
+				delete []this->snapshots[i].values_elems[j];
+				Sys_Memory_Count::self()->minus_mem((sizeof(int)+sizeof(double)*_Hyd_Element_Floodplain_Type::number_instat_values)*this->fp_models[j].get_number_elements(), _sys_system_modules::HYD_SYS);
+			}
+			else if(this->snapshots[i].index_elems!=NULL && this->snapshots[i].index_elems[j]!=NULL){
+				delete []this->snapshots[i].index_elems[j];
+			}
+		}
+		if(this->snapshots[i].number_elems!=NULL){
+			delete []this->snapshots[i].number_elems;
+		}
+		if(this->snapshots[i].index_elems!=NULL){
+			delete []this->snapshots[i].index_elems;
+		}
+		if(this->snapshots[i].values_elems!=NULL){
+			delete []this->snapshots[i].values_elems;
+		}
+	}
+	delete []this->snapshots;
+	this->snapshots=NULL;
+}
+//Set error(s)
+Error Hyd_Output_Writer::set_error(const int err_type){
+	string place="Hyd_Output_Writer::";
+	string help;
+	string reason;
+	int type=0;
+	bool fatal=false;
+	stringstream info;
+	Error msg;
+	switch (err_type){
+		case 0://bad alloc
+			place.append("allocate_snapshots(void)");
+			reason="Can not allocate the memory";
+			help="Check the memory";
+			type=10;
+			break;
+		case 1://bad alloc
+			place.append("write_snapshots(QSqlDatabase *ptr_database)");
+			reason="Can not allocate the memory for the output of a snapshot";
+			help="Check the memory";
+			type=10;
+			break;
+		case 2://unknown exception
+			place.append("write_snapshots(QSqlDatabase *ptr_database)");
+			reason="Unknown exception during the output of a snapshot";
+			help="Check the output of the instationary floodplain results";
+			type=6;
+			break;
+		default:
+			place.append("set_error(const int err_type)");
+			reason ="Unknown flag!";
+			help="Check the flags";
+			type=6;
+	}
+	msg.set_msg(place, reason, help, type, fatal);
+	msg.make_second_info(info.str());
+	return msg;
+}
@@ -0,0 +1,136 @@
+#pragma once
+/**\class Hyd_Output_Writer
+	\author Daniel Bachmann et al.
+	\author produced by the Institute of Hydraulic Engineering (IWW), RWTH Aachen University
+	\version 0.0.1
+	\date 2009
+*/
+#ifndef HYD_OUTPUT_WRITER_H
+#define HYD_OUTPUT_WRITER_H
+
+//qt libs
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+
+//system hyd libs
+//Class of a floodplain model
+#include "Hyd_Model_Floodplain.h"
+
+///Data structure of one snapshot of the instationary results, which are output by the output writer \ingroup hyd
+struct _hyd_output_snapshot{
+	///Time string of the output time
+	string time;
+	///String of the break scenario
+	string break_sz;
+	///Number of the stored elements per floodplain model
+	int *number_elems;
+	///Indices of the stored elements per floodplain model
+	int **index_elems;
+	///Instationary result values of the stored elements per floodplain model (_Hyd_Element_Floodplain_Type::number_instat_values per element)
+	double **values_elems;
+};
+
+///Class for the output of the instationary results of the floodplain models to the database in an own thread \ingroup hyd
+/**
+At each output time the calculation thread copies the instationary result values of the floodplain elements into a
+free snapshot buffer (take_snapshot()) and continues the calculation. The writer thread formats the snapshots and
+sends them to the database via an own database connection; the snapshots are written in the order of their taking.
+The connection of the writer thread is cloned, opened, closed and removed inside the writer thread, because a Qt
+database connection can just be used by the thread, which has created it.
+The snapshot buffers are allocated once. If all buffers are in use, the calculation thread waits until the oldest
+snapshot is written (backpressure); the number of buffers is set by the hydraulic system.
+
+\see Hyd_Hydraulic_System, Hyd_Model_Floodplain
+*/
+class Hyd_Output_Writer : public QThread
+{
+
+public:
+	///Default constructor
+	Hyd_Output_Writer(void);
+	///Default destructor
+	~Hyd_Output_Writer(void);
+
+	//members
+	///Default number of the snapshot buffers (double buffering)
+	static const int default_number_buffers=2;
+
+	//methods
+	///Initialize the writer: the snapshot buffers are allocated and the connection of the database is set for the writer thread
+	void init_writer(QSqlDatabase *ptr_database, const int thread_number, Hyd_Model_Floodplain *fp_models, const int number_fp, const int number_buffers);
+	///Stop the writer thread without writing the remaining snapshots, delete the snapshot buffers and close the database connection
+	void close_writer(void);
+	///Get if the writer is initialized
+	bool get_writer_initialized(void);
+	///Get if the snapshots are handed to the writer: the writer thread is running or it is ended by an error, which is not yet thrown
+	bool get_writer_active(void);
+
+	///Start the writer thread; if the writer thread can not open its database connection, the writer thread is not running
+	void start_writer(void);
+	///Copy the instationary results of the floodplain models to a free snapshot buffer and hand it to the writer thread; if all buffers are in use, it waits until the oldest snapshot is written
+	void take_snapshot(const string break_sz, const string time);
+	///Wait until all snapshots are written and stop the writer thread; an error of the writer thread is thrown
+	void finish_writer(void);
+	///Stop the writer thread without writing the remaining snapshots
+	void abort_writer(void);
+
+protected:
+	///Write the snapshots to the database in the order of their taking (thread function)
+	void run(void);
+
+private:
+	//members
+	///Name of the database connection, which is cloned by the writer thread
+	QString source_connection;
+	///Name of the own database connection of the writer thread
+	string connection_name;
+	///State of the database connection of the writer thread (0: not yet opened; 1: opened; -1: failed)
+	int connection_state;
+	///Flag if the writer is initialized
+	bool init_flag;
+
+	///Pointer to the floodplain models
+	Hyd_Model_Floodplain *fp_models;
+	///Number of floodplain models
+	int number_fp;
+
+	///Snapshot buffers
+	_hyd_output_snapshot *snapshots;
+	///Number of snapshot buffers
+	int number_buffers;
+	///Index of the oldest snapshot, which is not yet written
+	int first_full;
+	///Number of snapshots, which are not yet written
+	int number_full;
+
+	///Flag if the writer thread should stop after the remaining snapshots are written
+	bool stop_flag;
+	///Flag if the writer thread should stop without writing the remaining snapshots
+	bool abort_flag;
+	///Flag if an error occurred in the writer thread
+	bool error_flag;
+	///Error, which occurred in the writer thread
+	Error writer_error;
+
+	///Mutex for the snapshot queue
+	QMutex mutex;
+	///Wait condition of the writer thread for a new snapshot
+	QWaitCondition condition_full;
+	///Wait condition of the calculation thread for a free snapshot buffer
+	QWaitCondition condition_free;
+
+	//methods
+	///Allocate the snapshot buffers
+	void allocate_snapshots(void);
+	///Delete the snapshot buffers
+	void delete_snapshots(void);
+	///Write the snapshots via the database connection of the writer thread
+	void write_snapshots(QSqlDatabase *ptr_database);
+	///Store an error of the writer thread for the calculation thread
+	void store_writer_error(Error msg);
+
+	///Set error(s)
+	Error set_error(const int err_type);
+};
+#endif
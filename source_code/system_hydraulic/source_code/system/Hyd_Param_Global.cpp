@@ -51,6 +51,8 @@ Hyd_Param_Global::Hyd_Param_Global(void):default_max_steps(40000), default_init_
 	this->output_flags.bluekenue_2d_required = false;
 	this->output_flags.paraview_1d_required = true;
 	this->output_flags.paraview_2d_required = true;
+	this->output_flags.binary_1d_required = false;
+	this->output_flags.binary_2d_required = false;
 	this->output_flags.database_instat_required = true;
 	this->output_flags.output_folder = label::not_set;
 
@@ -564,6 +566,8 @@ void Hyd_Param_Global::output_members(void){
 	cout << " BlueKenue 2d output required                  : " << W(7) << P(6) << functions::convert_boolean2string(this->output_flags.bluekenue_2d_required) << endl;
 	cout << " ParaView / csv 1d output required             : " << W(7) << P(6) << functions::convert_boolean2string(this->output_flags.paraview_1d_required) << endl;
 	cout << " ParaView 2d output required                   : " << W(7) << P(6) << functions::convert_boolean2string(this->output_flags.paraview_2d_required) << endl;
+	cout << " Binary 1d output required                     : " << W(7) << P(6) << functions::convert_boolean2string(this->output_flags.binary_1d_required) << endl;
+	cout << " Binary 2d output required                     : " << W(7) << P(6) << functions::convert_boolean2string(this->output_flags.binary_2d_required) << endl;
 	cout << " Instationary database output required         : " << W(7) << P(6) << functions::convert_boolean2string(this->output_flags.database_instat_required) << endl;
 	cout << " Path to outputfolder                          : " << W(7) << P(6) << this->output_flags.output_folder << endl;
 
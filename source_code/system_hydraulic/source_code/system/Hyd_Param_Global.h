@@ -48,6 +48,11 @@ struct _hyd_output_flags {
 	///Output flag if a paraview / csv 2d output is required
 	bool paraview_2d_required;
 
+	///Output flag if a binary 1d output (result time series per river model) is required
+	bool binary_1d_required;
+	///Output flag if a binary 2d output (chunked result store per floodplain model) is required
+	bool binary_2d_required;
+
 	///Output flag if database instationary output is required
 	bool database_instat_required;
 
@@ -620,6 +620,12 @@ void Hyd_Parse_Glob::parse_output_setting(_hyd_keyword_file Key, word Command) {
 			else if (Key == ePARAVIEW2D) {
 				this->Globals.output_flags.paraview_2d_required= _Hyd_Parse_IO::transform_string2boolean(str_buff);
 			}
+			else if (Key == eBINARY1D) {
+				this->Globals.output_flags.binary_1d_required= _Hyd_Parse_IO::transform_string2boolean(str_buff);
+			}
+			else if (Key == eBINARY2D) {
+				this->Globals.output_flags.binary_2d_required= _Hyd_Parse_IO::transform_string2boolean(str_buff);
+			}
 			else if (Key == eDATABASE_INSTAT) {
 				this->Globals.output_flags.database_instat_required = _Hyd_Parse_IO::transform_string2boolean(str_buff);
 			}
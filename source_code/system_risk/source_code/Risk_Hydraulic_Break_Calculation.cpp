@@ -595,6 +595,7 @@ void Risk_Hydraulic_Break_Calculation::allocate_hyd_threads(void){
 			this->threads[i].set_ptr2database(this->ptr_database,i);
 		}
 		QObject::connect(&this->threads[i], SIGNAL(output_required(int)), this->ptr_risk_thread, SLOT(recieve_output_required(int )));
+		this->thread_waiter.observe_thread(&this->threads[i]);
 
 	}
 }
@@ -646,26 +647,31 @@ void Risk_Hydraulic_Break_Calculation::make_postprocessing_hyd_system(void){
 void Risk_Hydraulic_Break_Calculation::wait_loop(void){
 		bool all_finished=true;
 		int counter=0;
+		int number_finished=0;
 		ostringstream buffer;
-		//waiting loop for this thread
+		//waiting loop for this thread; it wakes up as soon as a thread is finished
 		do{
 			all_finished=true;
 			counter=0;
 			buffer.str("");
-			if(this->ptr_risk_thread!=NULL){
-				this->ptr_risk_thread->set_thread2sleep(2);
-			}
+			number_finished=this->thread_waiter.get_number_finished();
 			for(int i=0; i<this->required_threads; i++){
-				if(this->threads[i].isRunning()==true){
+				if(this->thread_waiter.get_thread_running(&this->threads[i])==true){
 					all_finished=false;
 					counter++;
 				}
 			}
 			buffer << counter;
 			emit emit_number_threads(buffer.str().c_str());
-
+			if(all_finished==false){
+				this->thread_waiter.wait_next_finished(number_finished, 2000);
+			}
 		}
 		while(all_finished==false);
+		//the threads have sent the finished-signal; wait until they are completly closed
+		for(int i=0; i<this->required_threads; i++){
+			this->threads[i].wait();
+		}
 }
 //Initialise the hydraulic threads
 void Risk_Hydraulic_Break_Calculation::init_break_scenario_hyd_threads(int *counter){
@@ -117,6 +117,8 @@ private:
 	_hyd_state_data hydraulic_state;
 	///Required threads
 	int required_threads;
+	///Waiter for the end of the hydraulic threads
+	Sys_Thread_Waiter thread_waiter;
 
 	///Risk type for the calculation; just a scenarios based or a catchment based risk approach is possible here
 	_risk_type risk_type;
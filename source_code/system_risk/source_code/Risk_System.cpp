@@ -5081,6 +5081,8 @@ void Risk_System::reconnect_hyd_threads(void){
 			if(this->hyd_calc->get_ptr_hyd_threads(i)!=NULL){
 				QObject::disconnect(this->hyd_calc->get_ptr_hyd_threads(i), SIGNAL(output_required(int)), this->hyd_calc, SLOT(recieve_output_required(int )));
 				QObject::connect(this->hyd_calc->get_ptr_hyd_threads(i), SIGNAL(output_required(int)), this, SLOT(recieve_output_required(int )));
+				//the waiting loop wakes up with the end of each hydraulic thread
+				this->thread_waiter.observe_thread(this->hyd_calc->get_ptr_hyd_threads(i));
 
 			}
 		}
@@ -6702,6 +6704,7 @@ void Risk_System::allocate_hyd_system(void){
 		QObject::connect(this->hyd_calc, SIGNAL(emit_number_threads(QString )), this, SLOT(sent_number_hyd_thread_break_calc(QString )));
 		QObject::connect(this->hyd_calc, SIGNAL(emit_number_performed_calculation(QString )), this, SLOT(recieve_output_hyd_calc_done(QString )));
 		QObject::connect(this->hyd_calc, SIGNAL(emit_threads_allocated()), this, SLOT(reconnect_hyd_threads()));
+		this->thread_waiter.observe_thread(this->hyd_calc);
 
 		
 		ostringstream prefix;
@@ -6808,6 +6811,7 @@ void Risk_System::allocate_fpl_system(void){
 		this->fpl_calc->set_ptr2database(&this->qsqldatabase);
 		QObject::connect(this->fpl_calc, SIGNAL(finished()), this, SLOT(send_status_fpl_thread()));
 		QObject::connect(this->fpl_calc, SIGNAL(started()), this, SLOT(send_status_fpl_thread()));
+		this->thread_waiter.observe_thread(this->fpl_calc);
 		ostringstream prefix;
 		prefix << "RISK> ";
 		Sys_Common_Output::output_fpl->set_userprefix(&prefix);
@@ -7506,18 +7510,20 @@ void Risk_System::delete_all_relevant_result(void){
 void Risk_System::wait_loop(void){
 
 	int number=0;
+	int number_finished=0;
 	ostringstream buffer;
 
 	emit send_risk_thread_sleeps(true);
 	bool all_finished=true;
-	//waiting loop for this thread
+	//waiting loop for this thread; it wakes up as soon as the fpl- or the hydraulic thread is finished
 	do{
 		all_finished=true;
+		number_finished=this->thread_waiter.get_number_finished();
 		
-		if(this->fpl_calc!=NULL && this->fpl_calc->isRunning()==true){
+		if(this->fpl_calc!=NULL && this->thread_waiter.get_thread_running(this->fpl_calc)==true){
 			all_finished=false;
 		}
-		if(this->hyd_calc!=NULL && (this->hyd_calc->get_hydraulic_thread_running(&number)==true || this->hyd_calc->isRunning()==true )){
+		if(this->hyd_calc!=NULL && (this->hyd_calc->get_hydraulic_thread_running(&number)==true || this->thread_waiter.get_thread_running(this->hyd_calc)==true )){
 			all_finished=false;
 		}
 		if(this->hyd_break_calc!=NULL && this->hyd_break_calc->get_hydraulic_break_thread_running(&number)==true){
@@ -7529,10 +7535,17 @@ void Risk_System::wait_loop(void){
 				buffer << number;
 				emit sent_number_hyd_thread_break_calc(buffer.str().c_str()); 
 			}
-			this->sleep(3);
+			this->thread_waiter.wait_next_finished(number_finished, 3000);
 		}
 	}
 	while(all_finished==false);
+	//the threads have sent the finished-signal; wait until they are completly closed
+	if(this->fpl_calc!=NULL){
+		this->fpl_calc->wait();
+	}
+	if(this->hyd_calc!=NULL){
+		this->hyd_calc->wait();
+	}
 	emit send_risk_thread_sleeps(false);
 }
 //Output the statistics of already generated detailed risk results
@@ -7912,8 +7925,9 @@ void Risk_System::calc_detailed_result_element(void){
 void Risk_System::calc_detailed_result_element_ecn(_risk_risk_results *total){
 	
 
-	string query_header;
-	query_header=this->generate_sql_header_string_elem_ecn();
+	//the rows are sent in packages by the bulk writer
+	Sys_Database_Bulk_Writer writer(&this->qsqldatabase);
+	this->set_bulk_writer_elem_ecn(&writer);
 	int glob_id=Risk_System::table_results_elem_ecn->maximum_int_of_column(Risk_System::table_results_elem_ecn->get_column_name(label::glob_id), &this->qsqldatabase)+1;
 
 	QSqlQueryModel model;
@@ -7929,8 +7943,6 @@ void Risk_System::calc_detailed_result_element_ecn(_risk_risk_results *total){
 
 
 	if(number!=0){
-		//Set the query
-		QSqlQuery query_buff(this->qsqldatabase);
 		int raster=0;
 		int elem=0;
 		double buff_mob=0.0;
@@ -7938,10 +7950,7 @@ void Risk_System::calc_detailed_result_element_ecn(_risk_risk_results *total){
 		double prob_total=total->prob_break_sc*total->prob_hyd_bound_sc*total->reocc_prob_hyd_bound_sc;
 		string buff_str;
 
-		int counter=0;
 
-		ostringstream query_data;
-		ostringstream query_total;
 
 
 		for(int i=0; i< number; i++){
@@ -7957,99 +7966,75 @@ void Risk_System::calc_detailed_result_element_ecn(_risk_risk_results *total){
 			buff_mob=model.record(i).value((Dam_Ecn_Element::elem_erg_table->get_column_name(dam_label::mob_dam)).c_str()).toDouble();
 			buff_str=model.record(i).value("ST_ASTEXT").toString().toStdString();
 
-			query_data << " ( ";
-			query_data << glob_id<<" , ";
-			query_data << raster<<" , ";
-			query_data << elem<<" , ";
-			query_data << this->system_id.area_state<<" , ";
-			query_data << this->system_id.measure_nr<<" , ";
-			query_data << total->dam_results.id_hyd_bound_sc<<" , ";
-			query_data << " '"<< total->dam_results.id_break_sc<<"' , ";
-			query_data << " '"<< Risk_Break_Scenario::convert_risk_type2txt(this->risk_type)<<"' , ";
+			writer.add_int(glob_id);
+			writer.add_int(raster);
+			writer.add_int(elem);
+			writer.add_int(this->system_id.area_state);
+			writer.add_int(this->system_id.measure_nr);
+			writer.add_int(total->dam_results.id_hyd_bound_sc);
+			writer.add_text(total->dam_results.id_break_sc);
+			writer.add_text(Risk_Break_Scenario::convert_risk_type2txt(this->risk_type));
 
 			//data
-			query_data << buff_immob*total->prob_break_sc<<" , ";
+			writer.add_double(buff_immob*total->prob_break_sc);
 			if(this->risk_type!=_risk_type::scenario_risk){
-				query_data << buff_immob*prob_total<<" , ";
+				writer.add_double(buff_immob*prob_total);
 			}
 			else{
-				query_data << 0.0 <<" , ";
+				writer.add_double(0.0);
 			}
-			query_data << buff_mob*total->prob_break_sc<<" , ";
+			writer.add_double(buff_mob*total->prob_break_sc);
 			if(this->risk_type!=_risk_type::scenario_risk){
-				query_data << buff_mob*prob_total<<" , ";
+				writer.add_double(buff_mob*prob_total);
 			}
 			else{
-				query_data << 0.0 <<" , ";
+				writer.add_double(0.0);
 			}
-			query_data << buff_mob*total->prob_break_sc+buff_immob*total->prob_break_sc<<" , ";
+			writer.add_double(buff_mob*total->prob_break_sc+buff_immob*total->prob_break_sc);
 			if(this->risk_type!=_risk_type::scenario_risk){
-				query_data << buff_mob*prob_total+buff_immob*prob_total<<" , ";
+				writer.add_double(buff_mob*prob_total+buff_immob*prob_total);
 
 				if((total->dam_results.ecn_immob_dam+total->dam_results.ecn_mob_dam)>0.0){
-					query_data << (buff_mob*prob_total+buff_immob*prob_total)/(total->dam_results.ecn_immob_dam+total->dam_results.ecn_mob_dam)<<" , ";
+					writer.add_double((buff_mob*prob_total+buff_immob*prob_total)/(total->dam_results.ecn_immob_dam+total->dam_results.ecn_mob_dam));
 				}
 				else{
-					query_data << 0.0 <<" , ";
+					writer.add_double(0.0);
 				}
 			}
 			else{
-					query_data << 0.0 <<" , ";
-					query_data << 0.0 <<" , ";
+					writer.add_double(0.0);
+					writer.add_double(0.0);
 			}
 	
-			query_data << "ST_GeomFromText('"<< buff_str<<"')";
+			writer.add_wkt(buff_str);
 
-			query_data << " ) ,";
 
 			glob_id++;
-			counter++;
-			if(counter==100){
-				query_total<< query_header << query_data.str();
-				//delete last komma
-				string buff=query_total.str();
-				buff.erase(buff.length()-1);
-				Data_Base::database_request(&query_buff, buff, &this->qsqldatabase);
-				//delete them
-				query_total.str("");
-				query_data.str("");
-				counter=0;
-				if(query_buff.lastError().isValid()){
-					Warning msg=this->set_warning(13);
-					ostringstream info;
-					info << "Table Name                : " << Risk_System::table_results_elem_ecn->get_table_name() << endl;
-					info << "Table error info          : " << query_buff.lastError().text().toStdString() << endl;
-					msg.make_second_info(info.str());
-					msg.output_msg(5);	
-				}
-			}
-		}
-		//send the rest
-		if(counter!=0){
-			query_total<< query_header << query_data.str();
-			//delete last komma
-			string buff=query_total.str();
-			buff.erase(buff.length()-1);
-			Data_Base::database_request(&query_buff, buff, &this->qsqldatabase);
-			//delete them
-			query_total.str("");
-			query_data.str("");
-			counter=0;
-			if(query_buff.lastError().isValid()){
+			if(writer.end_row()==false){
 				Warning msg=this->set_warning(13);
 				ostringstream info;
 				info << "Table Name                : " << Risk_System::table_results_elem_ecn->get_table_name() << endl;
-				info << "Table error info          : " << query_buff.lastError().text().toStdString() << endl;
+				info << "Table error info          : " << writer.get_last_error() << endl;
 				msg.make_second_info(info.str());
-				msg.output_msg(5);	
+				msg.output_msg(5);
 			}
 		}
+		//send the rest
+		if(writer.finish()==false){
+			Warning msg=this->set_warning(13);
+			ostringstream info;
+			info << "Table Name                : " << Risk_System::table_results_elem_ecn->get_table_name() << endl;
+			info << "Table error info          : " << writer.get_last_error() << endl;
+			msg.make_second_info(info.str());
+			msg.output_msg(5);
+		}
 	}
 }
 //Calculate, generate and insert to database table the detailed risk result of the ecological biotope-type damage elements
 void Risk_System::calc_detailed_result_element_eco_btype(_risk_risk_results *total){
-	string query_header;
-	query_header=this->generate_sql_header_string_elem_eco_btype();
+	//the rows are sent in packages by the bulk writer
+	Sys_Database_Bulk_Writer writer(&this->qsqldatabase);
+	this->set_bulk_writer_elem_eco_btype(&writer);
 	int glob_id=Risk_System::table_results_elem_eco_btype->maximum_int_of_column(Risk_System::table_results_elem_eco_btype->get_column_name(label::glob_id), &this->qsqldatabase)+1;
 
 	QSqlQueryModel model;
@@ -8065,18 +8050,13 @@ void Risk_System::calc_detailed_result_element_eco_btype(_risk_risk_results *tot
 
 
 	if(number!=0){
-		//Set the query
-		QSqlQuery query_buff(this->qsqldatabase);
 		int raster=0;
 		int elem=0;
 		double buff_cost=0.0;
 		double prob_total=total->prob_break_sc*total->prob_hyd_bound_sc*total->reocc_prob_hyd_bound_sc;
 		string buff_str;
 
-		int counter=0;
 
-		ostringstream query_data;
-		ostringstream query_total;
 
 
 		for(int i=0; i< number; i++){
@@ -8091,89 +8071,65 @@ void Risk_System::calc_detailed_result_element_eco_btype(_risk_risk_results *tot
 			buff_cost=model.record(i).value((Dam_Eco_Btype_Element::elem_erg_table->get_column_name(dam_label::btype_cost)).c_str()).toDouble();
 			buff_str=model.record(i).value("ST_ASTEXT").toString().toStdString();
 
-			query_data << " ( ";
-			query_data << glob_id<<" , ";
-			query_data << raster<<" , ";
-			query_data << elem<<" , ";
-			query_data << this->system_id.area_state<<" , ";
-			query_data << this->system_id.measure_nr<<" , ";
-			query_data << total->dam_results.id_hyd_bound_sc<<" , ";
-			query_data << " '"<< total->dam_results.id_break_sc<<"' , ";
-			query_data << " '"<< Risk_Break_Scenario::convert_risk_type2txt(this->risk_type)<<"' , ";
+			writer.add_int(glob_id);
+			writer.add_int(raster);
+			writer.add_int(elem);
+			writer.add_int(this->system_id.area_state);
+			writer.add_int(this->system_id.measure_nr);
+			writer.add_int(total->dam_results.id_hyd_bound_sc);
+			writer.add_text(total->dam_results.id_break_sc);
+			writer.add_text(Risk_Break_Scenario::convert_risk_type2txt(this->risk_type));
 
 			//data
-			query_data << buff_cost*total->prob_break_sc<<" , ";
+			writer.add_double(buff_cost*total->prob_break_sc);
 			if(this->risk_type!=_risk_type::scenario_risk){
-				query_data << buff_cost*prob_total<<" , ";
+				writer.add_double(buff_cost*prob_total);
 			}
 			else{
-				query_data << 0.0 <<" , ";
+				writer.add_double(0.0);
 			}
 
 			if(this->risk_type!=_risk_type::scenario_risk){
 				if((total->dam_results.eco_biotype)>0.0){
-					query_data << (buff_cost*prob_total)/(total->dam_results.eco_biotype)<<" , ";
+					writer.add_double((buff_cost*prob_total)/(total->dam_results.eco_biotype));
 				}
 				else{
-					query_data << 0.0 <<" , ";
+					writer.add_double(0.0);
 				}
 			}
 			else{
-					query_data << 0.0 <<" , ";
+					writer.add_double(0.0);
 			}
 	
-			query_data << "ST_GeomFromText('"<< buff_str<<"')";
+			writer.add_wkt(buff_str);
 
-			query_data << " ) ,";
 
 			glob_id++;
-			counter++;
-			if(counter==100){
-				query_total<< query_header << query_data.str();
-				//delete last komma
-				string buff=query_total.str();
-				buff.erase(buff.length()-1);
-				Data_Base::database_request(&query_buff, buff, &this->qsqldatabase);
-				//delete them
-				query_total.str("");
-				query_data.str("");
-				counter=0;
-				if(query_buff.lastError().isValid()){
-					Warning msg=this->set_warning(13);
-					ostringstream info;
-					info << "Table Name                : " << Risk_System::table_results_elem_eco_btype->get_table_name() << endl;
-					info << "Table error info          : " << query_buff.lastError().text().toStdString() << endl;
-					msg.make_second_info(info.str());
-					msg.output_msg(5);	
-				}
-			}
-		}
-		//send the rest
-		if(counter!=0){
-			query_total<< query_header << query_data.str();
-			//delete last komma
-			string buff=query_total.str();
-			buff.erase(buff.length()-1);
-			Data_Base::database_request(&query_buff, buff, &this->qsqldatabase);
-			//delete them
-			query_total.str("");
-			query_data.str("");
-			counter=0;
-			if(query_buff.lastError().isValid()){
+			if(writer.end_row()==false){
 				Warning msg=this->set_warning(13);
 				ostringstream info;
 				info << "Table Name                : " << Risk_System::table_results_elem_eco_btype->get_table_name() << endl;
-				info << "Table error info          : " << query_buff.lastError().text().toStdString() << endl;
+				info << "Table error info          : " << writer.get_last_error() << endl;
 				msg.make_second_info(info.str());
-				msg.output_msg(5);	
+				msg.output_msg(5);
 			}
 		}
+		//send the rest
+		if(writer.finish()==false){
+			Warning msg=this->set_warning(13);
+			ostringstream info;
+			info << "Table Name                : " << Risk_System::table_results_elem_eco_btype->get_table_name() << endl;
+			info << "Table error info          : " << writer.get_last_error() << endl;
+			msg.make_second_info(info.str());
+			msg.output_msg(5);
+		}
 	}
 }
 //Calculate, generate and insert to database table the detailed risk result of the ecological soil-erosion damage elements
 void Risk_System::calc_detailed_result_element_eco_soil(_risk_risk_results *total){
-	string query_header;
-	query_header=this->generate_sql_header_string_elem_eco_soil();
+	//the rows are sent in packages by the bulk writer
+	Sys_Database_Bulk_Writer writer(&this->qsqldatabase);
+	this->set_bulk_writer_elem_eco_soil(&writer);
 	int glob_id=Risk_System::table_results_elem_eco_soil->maximum_int_of_column(Risk_System::table_results_elem_eco_soil->get_column_name(label::glob_id), &this->qsqldatabase)+1;
 
 	QSqlQueryModel model;
@@ -8189,18 +8145,13 @@ void Risk_System::calc_detailed_result_element_eco_soil(_risk_risk_results *tota
 
 
 	if(number!=0){
-		//Set the query
-		QSqlQuery query_buff(this->qsqldatabase);
 		int raster=0;
 		int elem=0;
 		double buff_cost=0.0;
 		double prob_total=total->prob_break_sc*total->prob_hyd_bound_sc*total->reocc_prob_hyd_bound_sc;
 		string buff_str;
 
-		int counter=0;
 
-		ostringstream query_data;
-		ostringstream query_total;
 
 
 		for(int i=0; i< number; i++){
@@ -8215,91 +8166,67 @@ void Risk_System::calc_detailed_result_element_eco_soil(_risk_risk_results *tota
 			buff_cost=model.record(i).value((Dam_Eco_Soil_Element::elem_erg_table->get_column_name(dam_label::soil_cost)).c_str()).toDouble();
 			buff_str=model.record(i).value("ST_ASTEXT").toString().toStdString();
 
-			query_data << " ( ";
-			query_data << glob_id<<" , ";
-			query_data << raster<<" , ";
-			query_data << elem<<" , ";
-			query_data << this->system_id.area_state<<" , ";
-			query_data << this->system_id.measure_nr<<" , ";
-			query_data << total->dam_results.id_hyd_bound_sc<<" , ";
-			query_data << " '"<< total->dam_results.id_break_sc<<"' , ";
-			query_data << " '"<< Risk_Break_Scenario::convert_risk_type2txt(this->risk_type)<<"' , ";
+			writer.add_int(glob_id);
+			writer.add_int(raster);
+			writer.add_int(elem);
+			writer.add_int(this->system_id.area_state);
+			writer.add_int(this->system_id.measure_nr);
+			writer.add_int(total->dam_results.id_hyd_bound_sc);
+			writer.add_text(total->dam_results.id_break_sc);
+			writer.add_text(Risk_Break_Scenario::convert_risk_type2txt(this->risk_type));
 
 			//data
-			query_data << buff_cost*total->prob_break_sc<<" , ";
+			writer.add_double(buff_cost*total->prob_break_sc);
 			if(this->risk_type!=_risk_type::scenario_risk){
-				query_data << buff_cost*prob_total<<" , ";
+				writer.add_double(buff_cost*prob_total);
 			}
 			else{
-				query_data << 0.0 <<" , ";
+				writer.add_double(0.0);
 			}
 
 			if(this->risk_type!=_risk_type::scenario_risk){
 				if((total->dam_results.eco_soil_erosion)>0.0){
-					query_data << (buff_cost*prob_total)/(total->dam_results.eco_soil_erosion)<<" , ";
+					writer.add_double((buff_cost*prob_total)/(total->dam_results.eco_soil_erosion));
 				}
 				else{
-					query_data << 0.0 <<" , ";
+					writer.add_double(0.0);
 				}
 			}
 			else{
-					query_data << 0.0 <<" , ";
+					writer.add_double(0.0);
 			}
 	
-			query_data << "ST_GeomFromText('"<< buff_str<<"')";
+			writer.add_wkt(buff_str);
 
-			query_data << " ) ,";
 
 			glob_id++;
-			counter++;
-			if(counter==100){
-				query_total<< query_header << query_data.str();
-				//delete last komma
-				string buff=query_total.str();
-				buff.erase(buff.length()-1);
-				Data_Base::database_request(&query_buff, buff, &this->qsqldatabase);
-				//delete them
-				query_total.str("");
-				query_data.str("");
-				counter=0;
-				if(query_buff.lastError().isValid()){
-					Warning msg=this->set_warning(13);
-					ostringstream info;
-					info << "Table Name                : " << Risk_System::table_results_elem_eco_soil->get_table_name() << endl;
-					info << "Table error info          : " << query_buff.lastError().text().toStdString() << endl;
-					msg.make_second_info(info.str());
-					msg.output_msg(5);	
-				}
-			}
-		}
-		//send the rest
-		if(counter!=0){
-			query_total<< query_header << query_data.str();
-			//delete last komma
-			string buff=query_total.str();
-			buff.erase(buff.length()-1);
-			Data_Base::database_request(&query_buff, buff, &this->qsqldatabase);
-			//delete them
-			query_total.str("");
-			query_data.str("");
-			counter=0;
-			if(query_buff.lastError().isValid()){
+			if(writer.end_row()==false){
 				Warning msg=this->set_warning(13);
 				ostringstream info;
 				info << "Table Name                : " << Risk_System::table_results_elem_eco_soil->get_table_name() << endl;
-				info << "Table error info          : " << query_buff.lastError().text().toStdString() << endl;
+				info << "Table error info          : " << writer.get_last_error() << endl;
 				msg.make_second_info(info.str());
-				msg.output_msg(5);	
+				msg.output_msg(5);
 			}
 		}
+		//send the rest
+		if(writer.finish()==false){
+			Warning msg=this->set_warning(13);
+			ostringstream info;
+			info << "Table Name                : " << Risk_System::table_results_elem_eco_soil->get_table_name() << endl;
+			info << "Table error info          : " << writer.get_last_error() << endl;
+			msg.make_second_info(info.str());
+			msg.output_msg(5);
+		}
 	}
 }
 //Calculate, generate and insert to database table the detailed risk result of the people2risk  damage elements
 void Risk_System::calc_detailed_result_element_pop(_risk_risk_results *total){
 	
 
-	string query_header;
-	query_header=this->generate_sql_header_string_elem_pop();
+	//the rows are sent in packages by the bulk writer
+	Sys_Database_Bulk_Writer writer(&this->qsqldatabase);
+	this->set_bulk_writer_elem_pop(&writer);
 	int glob_id=Risk_System::table_results_elem_pop->maximum_int_of_column(Risk_System::table_results_elem_pop->get_column_name(label::glob_id), &this->qsqldatabase)+1;
 
 	QSqlQueryModel model;
@@ -8315,8 +8242,6 @@ void Risk_System::calc_detailed_result_element_pop(_risk_risk_results *total){
 
 
 	if(number!=0){
-		//Set the query
-		QSqlQuery query_buff(this->qsqldatabase);
 		int raster=0;
 		int elem=0;
 		double buff_affected=0.0;
@@ -8324,10 +8249,7 @@ void Risk_System::calc_detailed_result_element_pop(_risk_risk_results *total){
 		double prob_total=total->prob_break_sc*total->prob_hyd_bound_sc*total->reocc_prob_hyd_bound_sc;
 		string buff_str;
 
-		int counter=0;
 
-		ostringstream query_data;
-		ostringstream query_total;
 
 
 		for(int i=0; i< number; i++){
@@ -8343,109 +8265,85 @@ void Risk_System::calc_detailed_result_element_pop(_risk_risk_results *total){
 			buff_endangered=model.record(i).value((Dam_People_Element::elem_erg_table->get_column_name(dam_label::pop_endangered)).c_str()).toDouble();
 			buff_str=model.record(i).value("ST_ASTEXT").toString().toStdString();
 
-			query_data << " ( ";
-			query_data << glob_id<<" , ";
-			query_data << raster<<" , ";
-			query_data << elem<<" , ";
-			query_data << this->system_id.area_state<<" , ";
-			query_data << this->system_id.measure_nr<<" , ";
-			query_data << total->dam_results.id_hyd_bound_sc<<" , ";
-			query_data << " '"<< total->dam_results.id_break_sc<<"' , ";
-			query_data << " '"<< Risk_Break_Scenario::convert_risk_type2txt(this->risk_type)<<"' , ";
+			writer.add_int(glob_id);
+			writer.add_int(raster);
+			writer.add_int(elem);
+			writer.add_int(this->system_id.area_state);
+			writer.add_int(this->system_id.measure_nr);
+			writer.add_int(total->dam_results.id_hyd_bound_sc);
+			writer.add_text(total->dam_results.id_break_sc);
+			writer.add_text(Risk_Break_Scenario::convert_risk_type2txt(this->risk_type));
 
 			//data
-			query_data << buff_affected*total->prob_break_sc<<" , ";
+			writer.add_double(buff_affected*total->prob_break_sc);
 			if(this->risk_type!=_risk_type::scenario_risk){
-				query_data << buff_affected*prob_total<<" , ";
+				writer.add_double(buff_affected*prob_total);
 			}
 			else{
-				query_data << 0.0 <<" , ";
+				writer.add_double(0.0);
 			}
 			if(this->risk_type!=_risk_type::scenario_risk){
 				if((total->dam_results.pop_affected)>0.0){
-					query_data << (buff_affected*prob_total)/(total->dam_results.pop_affected)<<" , ";
+					writer.add_double((buff_affected*prob_total)/(total->dam_results.pop_affected));
 				}
 				else{
-					query_data << 0.0 <<" , ";
+					writer.add_double(0.0);
 				}
 
 			}
 			else{
-				query_data << 0.0 <<" , ";
+				writer.add_double(0.0);
 			}
 
-			query_data << buff_endangered*total->prob_break_sc<<" , ";
+			writer.add_double(buff_endangered*total->prob_break_sc);
 			if(this->risk_type!=_risk_type::scenario_risk){
-				query_data << buff_endangered*prob_total<<" , ";
+				writer.add_double(buff_endangered*prob_total);
 			}
 			else{
-				query_data << 0.0 <<" , ";
+				writer.add_double(0.0);
 			}
 			if(this->risk_type!=_risk_type::scenario_risk){
 				if((total->dam_results.pop_endangered)>0.0){
-					query_data << (buff_endangered*prob_total)/(total->dam_results.pop_endangered)<<" , ";
+					writer.add_double((buff_endangered*prob_total)/(total->dam_results.pop_endangered));
 				}
 				else{
-					query_data << 0.0 <<" , ";
+					writer.add_double(0.0);
 				}
 
 			}
 			else{
-				query_data << 0.0 <<" , ";
+				writer.add_double(0.0);
 			}
 	
-			query_data << "ST_GeomFromText('"<< buff_str<<"')";
+			writer.add_wkt(buff_str);
 
-			query_data << " ) ,";
 
 			glob_id++;
-			counter++;
-			if(counter==100){
-				query_total<< query_header << query_data.str();
-				//delete last komma
-				string buff=query_total.str();
-				buff.erase(buff.length()-1);
-				Data_Base::database_request(&query_buff, buff, &this->qsqldatabase);
-				//delete them
-				query_total.str("");
-				query_data.str("");
-				counter=0;
-				if(query_buff.lastError().isValid()){
-					Warning msg=this->set_warning(13);
-					ostringstream info;
-					info << "Table Name                : " << Risk_System::table_results_elem_pop->get_table_name() << endl;
-					info << "Table error info          : " << query_buff.lastError().text().toStdString() << endl;
-					msg.make_second_info(info.str());
-					msg.output_msg(5);	
-				}
-			}
-		}
-		//send the rest
-		if(counter!=0){
-			query_total<< query_header << query_data.str();
-			//delete last komma
-			string buff=query_total.str();
-			buff.erase(buff.length()-1);
-			Data_Base::database_request(&query_buff, buff, &this->qsqldatabase);
-			//delete them
-			query_total.str("");
-			query_data.str("");
-			counter=0;
-			if(query_buff.lastError().isValid()){
+			if(writer.end_row()==false){
 				Warning msg=this->set_warning(13);
 				ostringstream info;
 				info << "Table Name                : " << Risk_System::table_results_elem_pop->get_table_name() << endl;
-				info << "Table error info          : " << query_buff.lastError().text().toStdString() << endl;
+				info << "Table error info          : " << writer.get_last_error() << endl;
 				msg.make_second_info(info.str());
-				msg.output_msg(5);	
+				msg.output_msg(5);
 			}
 		}
+		//send the rest
+		if(writer.finish()==false){
+			Warning msg=this->set_warning(13);
+			ostringstream info;
+			info << "Table Name                : " << Risk_System::table_results_elem_pop->get_table_name() << endl;
+			info << "Table error info          : " << writer.get_last_error() << endl;
+			msg.make_second_info(info.str());
+			msg.output_msg(5);
+		}
 	}
 }
 //Calculate, generate and insert to database table the detailed risk result of the psycho-social damage elements
 void Risk_System::calc_detailed_result_element_pys(_risk_risk_results *total){
-	string query_header;
-	query_header=this->generate_sql_header_string_elem_pys();
+	//the rows are sent in packages by the bulk writer
+	Sys_Database_Bulk_Writer writer(&this->qsqldatabase);
+	this->set_bulk_writer_elem_pys(&writer);
 	int glob_id=Risk_System::table_results_elem_pys->maximum_int_of_column(Risk_System::table_results_elem_pys->get_column_name(label::glob_id), &this->qsqldatabase)+1;
 
 	QSqlQueryModel model;
@@ -8461,8 +8359,6 @@ void Risk_System::calc_detailed_result_element_pys(_risk_risk_results *total){
 
 
 	if(number!=0){
-		//Set the query
-		QSqlQuery query_buff(this->qsqldatabase);
 		int raster=0;
 		int elem=0;
 		_dam_damage_results buff;
@@ -8471,10 +8367,7 @@ void Risk_System::calc_detailed_result_element_pys(_risk_risk_results *total){
 		double prob_total=total->prob_break_sc*total->prob_hyd_bound_sc*total->reocc_prob_hyd_bound_sc;
 		string buff_str;
 
-		int counter=0;
 
-		ostringstream query_data;
-		ostringstream query_total;
 
 
 		for(int i=0; i< number; i++){
@@ -8497,176 +8390,152 @@ void Risk_System::calc_detailed_result_element_pys(_risk_risk_results *total){
 
 			buff_str=model.record(i).value("ST_ASTEXT").toString().toStdString();
 
-			query_data << " ( ";
-			query_data << glob_id<<" , ";
-			query_data << raster<<" , ";
-			query_data << elem<<" , ";
-			query_data << this->system_id.area_state<<" , ";
-			query_data << this->system_id.measure_nr<<" , ";
-			query_data << total->dam_results.id_hyd_bound_sc<<" , ";
-			query_data << " '"<< total->dam_results.id_break_sc<<"' , ";
-			query_data << " '"<< Risk_Break_Scenario::convert_risk_type2txt(this->risk_type)<<"' , ";
+			writer.add_int(glob_id);
+			writer.add_int(raster);
+			writer.add_int(elem);
+			writer.add_int(this->system_id.area_state);
+			writer.add_int(this->system_id.measure_nr);
+			writer.add_int(total->dam_results.id_hyd_bound_sc);
+			writer.add_text(total->dam_results.id_break_sc);
+			writer.add_text(Risk_Break_Scenario::convert_risk_type2txt(this->risk_type));
 
 			//data
-			query_data << buff.pys_age_50_59*total->prob_break_sc<<" , ";
+			writer.add_double(buff.pys_age_50_59*total->prob_break_sc);
 			if(this->risk_type!=_risk_type::scenario_risk){
-				query_data << buff.pys_age_50_59*prob_total<<" , ";
+				writer.add_double(buff.pys_age_50_59*prob_total);
 			}
 			else{
-				query_data << 0.0 <<" , ";
+				writer.add_double(0.0);
 			}
-			query_data << buff.pys_age_80*total->prob_break_sc<<" , ";
+			writer.add_double(buff.pys_age_80*total->prob_break_sc);
 			if(this->risk_type!=_risk_type::scenario_risk){
-				query_data << buff.pys_age_80*prob_total<<" , ";
+				writer.add_double(buff.pys_age_80*prob_total);
 			}
 			else{
-				query_data << 0.0 <<" , ";
+				writer.add_double(0.0);
 			}
-			query_data << buff.pys_female*total->prob_break_sc<<" , ";
+			writer.add_double(buff.pys_female*total->prob_break_sc);
 			if(this->risk_type!=_risk_type::scenario_risk){
-				query_data << buff.pys_female*prob_total<<" , ";
+				writer.add_double(buff.pys_female*prob_total);
 			}
 			else{
-				query_data << 0.0 <<" , ";
+				writer.add_double(0.0);
 			}
-			query_data << buff.pys_owner*total->prob_break_sc<<" , ";
+			writer.add_double(buff.pys_owner*total->prob_break_sc);
 			if(this->risk_type!=_risk_type::scenario_risk){
-				query_data << buff.pys_owner*prob_total<<" , ";
+				writer.add_double(buff.pys_owner*prob_total);
 			}
 			else{
-				query_data << 0.0 <<" , ";
+				writer.add_double(0.0);
 			}
 
 			sum=buff.pys_owner+buff.pys_female+buff.pys_age_50_59+buff.pys_age_80;
 			sum_total=total->dam_results.pys_age_50_59+total->dam_results.pys_age_80+
 				total->dam_results.pys_female+total->dam_results.pys_owner;
 
-			query_data << sum*total->prob_break_sc<<" , ";
+			writer.add_double(sum*total->prob_break_sc);
 			if(this->risk_type!=_risk_type::scenario_risk){
-				query_data << sum*prob_total<<" , ";
+				writer.add_double(sum*prob_total);
 			}
 			else{
-				query_data << 0.0 <<" , ";
+				writer.add_double(0.0);
 			}
 			if(this->risk_type!=_risk_type::scenario_risk){
 				if((sum_total)>0.0){
-					query_data << (sum*prob_total)/(sum_total)<<" , ";
+					writer.add_double((sum*prob_total)/(sum_total));
 				}
 				else{
-					query_data << 0.0 <<" , ";
+					writer.add_double(0.0);
 				}
 
 			}
 			else{
-				query_data << 0.0 <<" , ";
+				writer.add_double(0.0);
 			}
 
 			//with density
-			query_data << buff.pys_age_50_59_dens*total->prob_break_sc<<" , ";
+			writer.add_double(buff.pys_age_50_59_dens*total->prob_break_sc);
 			if(this->risk_type!=_risk_type::scenario_risk){
-				query_data << buff.pys_age_50_59_dens*prob_total<<" , ";
+				writer.add_double(buff.pys_age_50_59_dens*prob_total);
 			}
 			else{
-				query_data << 0.0 <<" , ";
+				writer.add_double(0.0);
 			}
-			query_data << buff.pys_age_80_dens*total->prob_break_sc<<" , ";
+			writer.add_double(buff.pys_age_80_dens*total->prob_break_sc);
 			if(this->risk_type!=_risk_type::scenario_risk){
-				query_data << buff.pys_age_80_dens*prob_total<<" , ";
+				writer.add_double(buff.pys_age_80_dens*prob_total);
 			}
 			else{
-				query_data << 0.0 <<" , ";
+				writer.add_double(0.0);
 			}
-			query_data << buff.pys_female_dens*total->prob_break_sc<<" , ";
+			writer.add_double(buff.pys_female_dens*total->prob_break_sc);
 			if(this->risk_type!=_risk_type::scenario_risk){
-				query_data << buff.pys_female_dens*prob_total<<" , ";
+				writer.add_double(buff.pys_female_dens*prob_total);
 			}
 			else{
-				query_data << 0.0 <<" , ";
+				writer.add_double(0.0);
 			}
-			query_data << buff.pys_owner_dens*total->prob_break_sc<<" , ";
+			writer.add_double(buff.pys_owner_dens*total->prob_break_sc);
 			if(this->risk_type!=_risk_type::scenario_risk){
-				query_data << buff.pys_owner_dens*prob_total<<" , ";
+				writer.add_double(buff.pys_owner_dens*prob_total);
 			}
 			else{
-				query_data << 0.0 <<" , ";
+				writer.add_double(0.0);
 			}
 
 			sum=buff.pys_owner_dens+buff.pys_female_dens+buff.pys_age_50_59_dens+buff.pys_age_80_dens;
 			sum_total=total->dam_results.pys_age_50_59_dens+total->dam_results.pys_age_80_dens+
 				total->dam_results.pys_female_dens+total->dam_results.pys_owner_dens;
 
-			query_data << sum*total->prob_break_sc<<" , ";
+			writer.add_double(sum*total->prob_break_sc);
 			if(this->risk_type!=_risk_type::scenario_risk){
-				query_data << sum*prob_total<<" , ";
+				writer.add_double(sum*prob_total);
 			}
 			else{
-				query_data << 0.0 <<" , ";
+				writer.add_double(0.0);
 			}
 			if(this->risk_type!=_risk_type::scenario_risk){
 				if((sum_total)>0.0){
-					query_data << (sum*prob_total)/(sum_total)<<" , ";
+					writer.add_double((sum*prob_total)/(sum_total));
 				}
 				else{
-					query_data << 0.0 <<" , ";
+					writer.add_double(0.0);
 				}
 
 			}
 			else{
-				query_data << 0.0 <<" , ";
+				writer.add_double(0.0);
 			}
 
-			query_data << "ST_GeomFromText('"<< buff_str<<"')";
+			writer.add_wkt(buff_str);
 
-			query_data << " ) ,";
 
 			glob_id++;
-			counter++;
-			if(counter==100){
-				query_total<< query_header << query_data.str();
-				//delete last komma
-				string buff=query_total.str();
-				buff.erase(buff.length()-1);
-				Data_Base::database_request(&query_buff, buff, &this->qsqldatabase);
-				//delete them
-				query_total.str("");
-				query_data.str("");
-				counter=0;
-				if(query_buff.lastError().isValid()){
-					Warning msg=this->set_warning(13);
-					ostringstream info;
-					info << "Table Name                : " << Risk_System::table_results_elem_pys->get_table_name() << endl;
-					info << "Table error info          : " << query_buff.lastError().text().toStdString() << endl;
-					msg.make_second_info(info.str());
-					msg.output_msg(5);	
-				}
-			}
-		}
-		//send the rest
-		if(counter!=0){
-			query_total<< query_header << query_data.str();
-			//delete last komma
-			string buff=query_total.str();
-			buff.erase(buff.length()-1);
-			Data_Base::database_request(&query_buff, buff, &this->qsqldatabase);
-			//delete them
-			query_total.str("");
-			query_data.str("");
-			counter=0;
-			if(query_buff.lastError().isValid()){
+			if(writer.end_row()==false){
 				Warning msg=this->set_warning(13);
 				ostringstream info;
 				info << "Table Name                : " << Risk_System::table_results_elem_pys->get_table_name() << endl;
-				info << "Table error info          : " << query_buff.lastError().text().toStdString() << endl;
+				info << "Table error info          : " << writer.get_last_error() << endl;
 				msg.make_second_info(info.str());
-				msg.output_msg(5);	
+				msg.output_msg(5);
 			}
 		}
+		//send the rest
+		if(writer.finish()==false){
+			Warning msg=this->set_warning(13);
+			ostringstream info;
+			info << "Table Name                : " << Risk_System::table_results_elem_pys->get_table_name() << endl;
+			info << "Table error info          : " << writer.get_last_error() << endl;
+			msg.make_second_info(info.str());
+			msg.output_msg(5);
+		}
 	}
 }
 //Calculate, generate and insert to database table the detailed risk result of the simple counting points
 void Risk_System::calc_detailed_result_point_sc(_risk_risk_results *total){
-	string query_header;
-	query_header=this->generate_sql_header_string_point_sc();
+	//the rows are sent in packages by the bulk writer
+	Sys_Database_Bulk_Writer writer(&this->qsqldatabase);
+	this->set_bulk_writer_point_sc(&writer);
 	int glob_id=Risk_System::table_results_point_sc->maximum_int_of_column(Risk_System::table_results_point_sc->get_column_name(label::glob_id), &this->qsqldatabase)+1;
 
 	QSqlQueryModel model;
@@ -8682,8 +8551,6 @@ void Risk_System::calc_detailed_result_point_sc(_risk_risk_results *total){
 
 
 	if(number!=0){
-		//Set the query
-		QSqlQuery query_buff(this->qsqldatabase);
 		int elem=0;
 		_dam_damage_results buff;
 		double sum=0.0;
@@ -8691,10 +8558,7 @@ void Risk_System::calc_detailed_result_point_sc(_risk_risk_results *total){
 		double prob_total=total->prob_break_sc*total->prob_hyd_bound_sc*total->reocc_prob_hyd_bound_sc;
 		string buff_str;
 
-		int counter=0;
 
-		ostringstream query_data;
-		ostringstream query_total;
 
 		int cat_buff=0;
 		double value_buff=0.0;
@@ -8733,43 +8597,42 @@ void Risk_System::calc_detailed_result_point_sc(_risk_risk_results *total){
 			
 			buff_str=model.record(i).value("ST_ASTEXT").toString().toStdString();
 
-			query_data << " ( ";
-			query_data << glob_id<<" , ";
-			query_data << elem<<" , ";
-			query_data << this->system_id.area_state<<" , ";
-			query_data << this->system_id.measure_nr<<" , ";
-			query_data << total->dam_results.id_hyd_bound_sc<<" , ";
-			query_data << " '"<< total->dam_results.id_break_sc<<"' , ";
-			query_data << " '"<< Risk_Break_Scenario::convert_risk_type2txt(this->risk_type)<<"' , ";
+			writer.add_int(glob_id);
+			writer.add_int(elem);
+			writer.add_int(this->system_id.area_state);
+			writer.add_int(this->system_id.measure_nr);
+			writer.add_int(total->dam_results.id_hyd_bound_sc);
+			writer.add_text(total->dam_results.id_break_sc);
+			writer.add_text(Risk_Break_Scenario::convert_risk_type2txt(this->risk_type));
 
 			//data
-			query_data << buff.sc_pub_build*total->prob_break_sc<<" , ";
+			writer.add_double(buff.sc_pub_build*total->prob_break_sc);
 			if(this->risk_type!=_risk_type::scenario_risk){
-				query_data << buff.sc_pub_build*prob_total<<" , ";
+				writer.add_double(buff.sc_pub_build*prob_total);
 			}
 			else{
-				query_data << 0.0 <<" , ";
+				writer.add_double(0.0);
 			}
-			query_data << buff.sc_eco_build*total->prob_break_sc<<" , ";
+			writer.add_double(buff.sc_eco_build*total->prob_break_sc);
 			if(this->risk_type!=_risk_type::scenario_risk){
-				query_data << buff.sc_eco_build*prob_total<<" , ";
+				writer.add_double(buff.sc_eco_build*prob_total);
 			}
 			else{
-				query_data << 0.0 <<" , ";
+				writer.add_double(0.0);
 			}
-			query_data << buff.sc_cult_build*total->prob_break_sc<<" , ";
+			writer.add_double(buff.sc_cult_build*total->prob_break_sc);
 			if(this->risk_type!=_risk_type::scenario_risk){
-				query_data << buff.sc_cult_build*prob_total<<" , ";
+				writer.add_double(buff.sc_cult_build*prob_total);
 			}
 			else{
-				query_data << 0.0 <<" , ";
+				writer.add_double(0.0);
 			}
-			query_data << buff.sc_person_build*total->prob_break_sc<<" , ";
+			writer.add_double(buff.sc_person_build*total->prob_break_sc);
 			if(this->risk_type!=_risk_type::scenario_risk){
-				query_data << buff.sc_person_build*prob_total<<" , ";
+				writer.add_double(buff.sc_person_build*prob_total);
 			}
 			else{
-				query_data << 0.0 <<" , ";
+				writer.add_double(0.0);
 			}
 
 			sum=buff.sc_cult_build+buff.sc_eco_build+buff.sc_person_build+buff.sc_pub_build;
@@ -8790,63 +8653,39 @@ void Risk_System::calc_detailed_result_point_sc(_risk_risk_results *total){
 				}
 				
 				if((sum_total)>0.0){
-					query_data << (sum*prob_total)/(sum_total)<<" , ";
+					writer.add_double((sum*prob_total)/(sum_total));
 				}
 				else{
-					query_data << 0.0 <<" , ";
+					writer.add_double(0.0);
 				}
 
 			}
 			else{
-				query_data << 0.0 <<" , ";
+				writer.add_double(0.0);
 			}
 
-			query_data << "ST_GeomFromText('"<< buff_str<<"')";
+			writer.add_wkt(buff_str);
 
-			query_data << " ) ,";
 
 			glob_id++;
-			counter++;
-			if(counter==100){
-				query_total<< query_header << query_data.str();
-				//delete last komma
-				string buff=query_total.str();
-				buff.erase(buff.length()-1);
-				Data_Base::database_request(&query_buff, buff, &this->qsqldatabase);
-				//delete them
-				query_total.str("");
-				query_data.str("");
-				counter=0;
-				if(query_buff.lastError().isValid()){
-					Warning msg=this->set_warning(14);
-					ostringstream info;
-					info << "Table Name                : " << Risk_System::table_results_point_sc->get_table_name() << endl;
-					info << "Table error info          : " << query_buff.lastError().text().toStdString() << endl;
-					msg.make_second_info(info.str());
-					msg.output_msg(5);	
-				}
-			}
-		}
-		//send the rest
-		if(counter!=0){
-			query_total<< query_header << query_data.str();
-			//delete last komma
-			string buff=query_total.str();
-			buff.erase(buff.length()-1);
-			Data_Base::database_request(&query_buff, buff, &this->qsqldatabase);
-			//delete them
-			query_total.str("");
-			query_data.str("");
-			counter=0;
-			if(query_buff.lastError().isValid()){
+			if(writer.end_row()==false){
 				Warning msg=this->set_warning(14);
 				ostringstream info;
 				info << "Table Name                : " << Risk_System::table_results_point_sc->get_table_name() << endl;
-				info << "Table error info          : " << query_buff.lastError().text().toStdString() << endl;
+				info << "Table error info          : " << writer.get_last_error() << endl;
 				msg.make_second_info(info.str());
-				msg.output_msg(5);	
+				msg.output_msg(5);
 			}
 		}
+		//send the rest
+		if(writer.finish()==false){
+			Warning msg=this->set_warning(14);
+			ostringstream info;
+			info << "Table Name                : " << Risk_System::table_results_point_sc->get_table_name() << endl;
+			info << "Table error info          : " << writer.get_last_error() << endl;
+			msg.make_second_info(info.str());
+			msg.output_msg(5);
+		}
 	}
 
 }
@@ -8875,9 +8714,8 @@ bool Risk_System::check_detailed_risk_element_results(const string break_id, con
 	return false;
 
 }
-//Generate sql-header string for inserting data to the database table for detailed results per damage raster-element of the economical damage raster 
-string Risk_System::generate_sql_header_string_elem_ecn(void){
-	string buffer;
+//Set the table and the columns of the bulk writer for the database table for detailed results per damage raster-element of the economical damage raster 
+void Risk_System::set_bulk_writer_elem_ecn(Sys_Database_Bulk_Writer *writer){
 	//the table is set (the name and the column names) and allocated
 	try{
 		Risk_System::set_table_result_elem_ecn(&this->qsqldatabase);
@@ -8886,40 +8724,30 @@ string Risk_System::generate_sql_header_string_elem_ecn(void){
 		throw msg;
 	}
 
-	//set the query via a query string
-	ostringstream query_string;
-	query_string << "INSERT INTO  " << Risk_System::table_results_elem_ecn->get_table_name();
-	query_string <<" ( ";
-	query_string << Risk_System::table_results_elem_ecn->get_column_name(dam_label::glob_id) <<" , ";
-	query_string << Risk_System::table_results_elem_ecn->get_column_name(dam_label::elem_id) <<" , ";
-	query_string << Risk_System::table_results_elem_ecn->get_column_name(dam_label::raster_id) <<" , ";
-	query_string << Risk_System::table_results_elem_ecn->get_column_name(label::areastate_id) <<" , ";
-	query_string << Risk_System::table_results_elem_ecn->get_column_name(label::measure_id) <<" , ";
-	query_string << Risk_System::table_results_elem_ecn->get_column_name(hyd_label::sz_bound_id) <<" , ";
-	query_string << Risk_System::table_results_elem_ecn->get_column_name(risk_label::sz_break_id) <<" , ";
-	query_string << Risk_System::table_results_elem_ecn->get_column_name(risk_label::risk_type) <<" , ";
+	//set the table and the columns of the writer
+	writer->set_table(Risk_System::table_results_elem_ecn->get_table_name());
+	writer->add_column(Risk_System::table_results_elem_ecn->get_column_name(dam_label::glob_id));
+	writer->add_column(Risk_System::table_results_elem_ecn->get_column_name(dam_label::elem_id));
+	writer->add_column(Risk_System::table_results_elem_ecn->get_column_name(dam_label::raster_id));
+	writer->add_column(Risk_System::table_results_elem_ecn->get_column_name(label::areastate_id));
+	writer->add_column(Risk_System::table_results_elem_ecn->get_column_name(label::measure_id));
+	writer->add_column(Risk_System::table_results_elem_ecn->get_column_name(hyd_label::sz_bound_id));
+	writer->add_column(Risk_System::table_results_elem_ecn->get_column_name(risk_label::sz_break_id));
+	writer->add_column(Risk_System::table_results_elem_ecn->get_column_name(risk_label::risk_type));
 	
 	//data
-	query_string << Risk_System::table_results_elem_ecn->get_column_name(dam_label::immob_dam) <<" , ";
-	query_string << Risk_System::table_results_elem_ecn->get_column_name(risk_label::risk_immob_with_hyd) <<" , ";
-	query_string << Risk_System::table_results_elem_ecn->get_column_name(dam_label::mob_dam) <<" , ";
-	query_string << Risk_System::table_results_elem_ecn->get_column_name(risk_label::risk_mob_with_hyd) <<" , ";
-	query_string << Risk_System::table_results_elem_ecn->get_column_name(dam_label::total_dam) <<" , ";
-	query_string << Risk_System::table_results_elem_ecn->get_column_name(risk_label::risk_ecn_total_with_hyd) <<" , ";
-	query_string << Risk_System::table_results_elem_ecn->get_column_name(risk_label::risk_ecn_total_fac) <<" , ";
-
-	query_string << Risk_System::table_results_elem_ecn->get_column_name(dam_label::elem_poly) <<" ) ";
-
-	query_string << " VALUES ";
-
-	buffer=query_string.str();
-
-	return buffer;
-
-}
-//Generate sql-header string for inserting data to the database table for detailed results per damage raster-element of the ecological biotope-type damage raster 
-string Risk_System::generate_sql_header_string_elem_eco_btype(void){
-		string buffer;
+	writer->add_column(Risk_System::table_results_elem_ecn->get_column_name(dam_label::immob_dam));
+	writer->add_column(Risk_System::table_results_elem_ecn->get_column_name(risk_label::risk_immob_with_hyd));
+	writer->add_column(Risk_System::table_results_elem_ecn->get_column_name(dam_label::mob_dam));
+	writer->add_column(Risk_System::table_results_elem_ecn->get_column_name(risk_label::risk_mob_with_hyd));
+	writer->add_column(Risk_System::table_results_elem_ecn->get_column_name(dam_label::total_dam));
+	writer->add_column(Risk_System::table_results_elem_ecn->get_column_name(risk_label::risk_ecn_total_with_hyd));
+	writer->add_column(Risk_System::table_results_elem_ecn->get_column_name(risk_label::risk_ecn_total_fac));
+
+	writer->add_column(Risk_System::table_results_elem_ecn->get_column_name(dam_label::elem_poly), _sys_bulk_column_type::bulk_geometry_wkt);
+}
+//Set the table and the columns of the bulk writer for the database table for detailed results per damage raster-element of the ecological biotope-type damage raster 
+void Risk_System::set_bulk_writer_elem_eco_btype(Sys_Database_Bulk_Writer *writer){
 	//the table is set (the name and the column names) and allocated
 	try{
 		Risk_System::set_table_result_elem_eco_btype(&this->qsqldatabase);
@@ -8928,36 +8756,27 @@ string Risk_System::generate_sql_header_string_elem_eco_btype(void){
 		throw msg;
 	}
 
-	//set the query via a query string
-	ostringstream query_string;
-	query_string << "INSERT INTO  " << Risk_System::table_results_elem_eco_btype->get_table_name();
-	query_string <<" ( ";
-	query_string << Risk_System::table_results_elem_eco_btype->get_column_name(dam_label::glob_id) <<" , ";
-	query_string << Risk_System::table_results_elem_eco_btype->get_column_name(dam_label::elem_id) <<" , ";
-	query_string << Risk_System::table_results_elem_eco_btype->get_column_name(dam_label::raster_id) <<" , ";
-	query_string << Risk_System::table_results_elem_eco_btype->get_column_name(label::areastate_id) <<" , ";
-	query_string << Risk_System::table_results_elem_eco_btype->get_column_name(label::measure_id) <<" , ";
-	query_string << Risk_System::table_results_elem_eco_btype->get_column_name(hyd_label::sz_bound_id) <<" , ";
-	query_string << Risk_System::table_results_elem_eco_btype->get_column_name(risk_label::sz_break_id) <<" , ";
-	query_string << Risk_System::table_results_elem_eco_btype->get_column_name(risk_label::risk_type) <<" , ";
+	//set the table and the columns of the writer
+	writer->set_table(Risk_System::table_results_elem_eco_btype->get_table_name());
+	writer->add_column(Risk_System::table_results_elem_eco_btype->get_column_name(dam_label::glob_id));
+	writer->add_column(Risk_System::table_results_elem_eco_btype->get_column_name(dam_label::elem_id));
+	writer->add_column(Risk_System::table_results_elem_eco_btype->get_column_name(dam_label::raster_id));
+	writer->add_column(Risk_System::table_results_elem_eco_btype->get_column_name(label::areastate_id));
+	writer->add_column(Risk_System::table_results_elem_eco_btype->get_column_name(label::measure_id));
+	writer->add_column(Risk_System::table_results_elem_eco_btype->get_column_name(hyd_label::sz_bound_id));
+	writer->add_column(Risk_System::table_results_elem_eco_btype->get_column_name(risk_label::sz_break_id));
+	writer->add_column(Risk_System::table_results_elem_eco_btype->get_column_name(risk_label::risk_type));
 	
 
 	//data
-	query_string << Risk_System::table_results_elem_eco_btype->get_column_name(dam_label::btype_cost) <<" , ";
-	query_string << Risk_System::table_results_elem_eco_btype->get_column_name(risk_label::risk_btype_with_hyd) <<" , ";
-	query_string << Risk_System::table_results_elem_eco_btype->get_column_name(risk_label::risk_btype_fac) <<" , ";
-
-	query_string << Risk_System::table_results_elem_eco_btype->get_column_name(dam_label::elem_poly) <<" ) ";
-
-	query_string << " VALUES ";
-
-	buffer=query_string.str();
+	writer->add_column(Risk_System::table_results_elem_eco_btype->get_column_name(dam_label::btype_cost));
+	writer->add_column(Risk_System::table_results_elem_eco_btype->get_column_name(risk_label::risk_btype_with_hyd));
+	writer->add_column(Risk_System::table_results_elem_eco_btype->get_column_name(risk_label::risk_btype_fac));
 
-	return buffer;
+	writer->add_column(Risk_System::table_results_elem_eco_btype->get_column_name(dam_label::elem_poly), _sys_bulk_column_type::bulk_geometry_wkt);
 }
-//Generate sql-header string for inserting data to the database table for detailed results per damage raster-element of the ecological soil-erosion damage raster 
-string Risk_System::generate_sql_header_string_elem_eco_soil(void){
-	string buffer;
+//Set the table and the columns of the bulk writer for the database table for detailed results per damage raster-element of the ecological soil-erosion damage raster 
+void Risk_System::set_bulk_writer_elem_eco_soil(Sys_Database_Bulk_Writer *writer){
 	//the table is set (the name and the column names) and allocated
 	try{
 		Risk_System::set_table_result_elem_eco_soil(&this->qsqldatabase);
@@ -8966,36 +8785,27 @@ string Risk_System::generate_sql_header_string_elem_eco_soil(void){
 		throw msg;
 	}
 
-	//set the query via a query string
-	ostringstream query_string;
-	query_string << "INSERT INTO  " << Risk_System::table_results_elem_eco_soil->get_table_name();
-	query_string <<" ( ";
-	query_string << Risk_System::table_results_elem_eco_soil->get_column_name(dam_label::glob_id) <<" , ";
-	query_string << Risk_System::table_results_elem_eco_soil->get_column_name(dam_label::elem_id) <<" , ";
-	query_string << Risk_System::table_results_elem_eco_soil->get_column_name(dam_label::raster_id) <<" , ";
-	query_string << Risk_System::table_results_elem_eco_soil->get_column_name(label::areastate_id) <<" , ";
-	query_string << Risk_System::table_results_elem_eco_soil->get_column_name(label::measure_id) <<" , ";
-	query_string << Risk_System::table_results_elem_eco_soil->get_column_name(hyd_label::sz_bound_id) <<" , ";
-	query_string << Risk_System::table_results_elem_eco_soil->get_column_name(risk_label::sz_break_id) <<" , ";
-	query_string << Risk_System::table_results_elem_eco_soil->get_column_name(risk_label::risk_type) <<" , ";
+	//set the table and the columns of the writer
+	writer->set_table(Risk_System::table_results_elem_eco_soil->get_table_name());
+	writer->add_column(Risk_System::table_results_elem_eco_soil->get_column_name(dam_label::glob_id));
+	writer->add_column(Risk_System::table_results_elem_eco_soil->get_column_name(dam_label::elem_id));
+	writer->add_column(Risk_System::table_results_elem_eco_soil->get_column_name(dam_label::raster_id));
+	writer->add_column(Risk_System::table_results_elem_eco_soil->get_column_name(label::areastate_id));
+	writer->add_column(Risk_System::table_results_elem_eco_soil->get_column_name(label::measure_id));
+	writer->add_column(Risk_System::table_results_elem_eco_soil->get_column_name(hyd_label::sz_bound_id));
+	writer->add_column(Risk_System::table_results_elem_eco_soil->get_column_name(risk_label::sz_break_id));
+	writer->add_column(Risk_System::table_results_elem_eco_soil->get_column_name(risk_label::risk_type));
 	
 
 	//data
-	query_string << Risk_System::table_results_elem_eco_soil->get_column_name(dam_label::soil_cost) <<" , ";
-	query_string << Risk_System::table_results_elem_eco_soil->get_column_name(risk_label::risk_soil_with_hyd) <<" , ";
-	query_string << Risk_System::table_results_elem_eco_soil->get_column_name(risk_label::risk_soil_fac) <<" , ";
+	writer->add_column(Risk_System::table_results_elem_eco_soil->get_column_name(dam_label::soil_cost));
+	writer->add_column(Risk_System::table_results_elem_eco_soil->get_column_name(risk_label::risk_soil_with_hyd));
+	writer->add_column(Risk_System::table_results_elem_eco_soil->get_column_name(risk_label::risk_soil_fac));
 
-	query_string << Risk_System::table_results_elem_eco_soil->get_column_name(dam_label::elem_poly) <<" ) ";
-
-	query_string << " VALUES ";
-
-	buffer=query_string.str();
-
-	return buffer;
+	writer->add_column(Risk_System::table_results_elem_eco_soil->get_column_name(dam_label::elem_poly), _sys_bulk_column_type::bulk_geometry_wkt);
 }
-//Generate sql-header string for inserting data to the database table for detailed results per damage raster-element of the people2risk damage raster 
-string Risk_System::generate_sql_header_string_elem_pop(void){
-	string buffer;
+//Set the table and the columns of the bulk writer for the database table for detailed results per damage raster-element of the people2risk damage raster 
+void Risk_System::set_bulk_writer_elem_pop(Sys_Database_Bulk_Writer *writer){
 	//the table is set (the name and the column names) and allocated
 	try{
 		Risk_System::set_table_result_elem_pop(&this->qsqldatabase);
@@ -9004,38 +8814,29 @@ string Risk_System::generate_sql_header_string_elem_pop(void){
 		throw msg;
 	}
 
-	//set the query via a query string
-	ostringstream query_string;
-	query_string << "INSERT INTO  " << Risk_System::table_results_elem_pop->get_table_name();
-	query_string <<" ( ";
-	query_string << Risk_System::table_results_elem_pop->get_column_name(dam_label::glob_id) <<" , ";
-	query_string << Risk_System::table_results_elem_pop->get_column_name(dam_label::elem_id) <<" , ";
-	query_string << Risk_System::table_results_elem_pop->get_column_name(dam_label::raster_id) <<" , ";
-	query_string << Risk_System::table_results_elem_pop->get_column_name(label::areastate_id) <<" , ";
-	query_string << Risk_System::table_results_elem_pop->get_column_name(label::measure_id) <<" , ";
-	query_string << Risk_System::table_results_elem_pop->get_column_name(hyd_label::sz_bound_id) <<" , ";
-	query_string << Risk_System::table_results_elem_pop->get_column_name(risk_label::sz_break_id) <<" , ";
-	query_string << Risk_System::table_results_elem_pop->get_column_name(risk_label::risk_type) <<" , ";
+	//set the table and the columns of the writer
+	writer->set_table(Risk_System::table_results_elem_pop->get_table_name());
+	writer->add_column(Risk_System::table_results_elem_pop->get_column_name(dam_label::glob_id));
+	writer->add_column(Risk_System::table_results_elem_pop->get_column_name(dam_label::elem_id));
+	writer->add_column(Risk_System::table_results_elem_pop->get_column_name(dam_label::raster_id));
+	writer->add_column(Risk_System::table_results_elem_pop->get_column_name(label::areastate_id));
+	writer->add_column(Risk_System::table_results_elem_pop->get_column_name(label::measure_id));
+	writer->add_column(Risk_System::table_results_elem_pop->get_column_name(hyd_label::sz_bound_id));
+	writer->add_column(Risk_System::table_results_elem_pop->get_column_name(risk_label::sz_break_id));
+	writer->add_column(Risk_System::table_results_elem_pop->get_column_name(risk_label::risk_type));
 	
 	//data
-	query_string << Risk_System::table_results_elem_pop->get_column_name(dam_label::pop_affected) <<" , ";
-	query_string << Risk_System::table_results_elem_pop->get_column_name(risk_label::risk_pop_aff_with_hyd) <<" , ";
-	query_string << Risk_System::table_results_elem_pop->get_column_name(risk_label::risk_pop_aff_fac) <<" , ";
-	query_string << Risk_System::table_results_elem_pop->get_column_name(dam_label::pop_endangered) <<" , ";
-	query_string << Risk_System::table_results_elem_pop->get_column_name(risk_label::risk_pop_dan_with_hyd) <<" , ";
-	query_string << Risk_System::table_results_elem_pop->get_column_name(risk_label::risk_pop_dan_fac) <<" , ";
+	writer->add_column(Risk_System::table_results_elem_pop->get_column_name(dam_label::pop_affected));
+	writer->add_column(Risk_System::table_results_elem_pop->get_column_name(risk_label::risk_pop_aff_with_hyd));
+	writer->add_column(Risk_System::table_results_elem_pop->get_column_name(risk_label::risk_pop_aff_fac));
+	writer->add_column(Risk_System::table_results_elem_pop->get_column_name(dam_label::pop_endangered));
+	writer->add_column(Risk_System::table_results_elem_pop->get_column_name(risk_label::risk_pop_dan_with_hyd));
+	writer->add_column(Risk_System::table_results_elem_pop->get_column_name(risk_label::risk_pop_dan_fac));
 
-	query_string << Risk_System::table_results_elem_pop->get_column_name(dam_label::elem_poly) <<" ) ";
-
-	query_string << " VALUES ";
-
-	buffer=query_string.str();
-
-	return buffer;
+	writer->add_column(Risk_System::table_results_elem_pop->get_column_name(dam_label::elem_poly), _sys_bulk_column_type::bulk_geometry_wkt);
 }
-//Generate sql-header string for inserting data to the database table for detailed results per damage raster-element of the psycho-social damage raster
-string Risk_System::generate_sql_header_string_elem_pys(void){
-		string buffer;
+//Set the table and the columns of the bulk writer for the database table for detailed results per damage raster-element of the psycho-social damage raster
+void Risk_System::set_bulk_writer_elem_pys(Sys_Database_Bulk_Writer *writer){
 	//the table is set (the name and the column names) and allocated
 	try{
 		Risk_System::set_table_result_elem_pys(&this->qsqldatabase);
@@ -9044,58 +8845,49 @@ string Risk_System::generate_sql_header_string_elem_pys(void){
 		throw msg;
 	}
 
-	//set the query via a query string
-	ostringstream query_string;
-	query_string << "INSERT INTO  " << Risk_System::table_results_elem_pys->get_table_name();
-	query_string <<" ( ";
-	query_string << Risk_System::table_results_elem_pys->get_column_name(dam_label::glob_id) <<" , ";
-	query_string << Risk_System::table_results_elem_pys->get_column_name(dam_label::elem_id) <<" , ";
-	query_string << Risk_System::table_results_elem_pys->get_column_name(dam_label::raster_id) <<" , ";
-	query_string << Risk_System::table_results_elem_pys->get_column_name(label::areastate_id) <<" , ";
-	query_string << Risk_System::table_results_elem_pys->get_column_name(label::measure_id) <<" , ";
-	query_string << Risk_System::table_results_elem_pys->get_column_name(hyd_label::sz_bound_id) <<" , ";
-	query_string << Risk_System::table_results_elem_pys->get_column_name(risk_label::sz_break_id) <<" , ";
-	query_string << Risk_System::table_results_elem_pys->get_column_name(risk_label::risk_type) <<" , ";
+	//set the table and the columns of the writer
+	writer->set_table(Risk_System::table_results_elem_pys->get_table_name());
+	writer->add_column(Risk_System::table_results_elem_pys->get_column_name(dam_label::glob_id));
+	writer->add_column(Risk_System::table_results_elem_pys->get_column_name(dam_label::elem_id));
+	writer->add_column(Risk_System::table_results_elem_pys->get_column_name(dam_label::raster_id));
+	writer->add_column(Risk_System::table_results_elem_pys->get_column_name(label::areastate_id));
+	writer->add_column(Risk_System::table_results_elem_pys->get_column_name(label::measure_id));
+	writer->add_column(Risk_System::table_results_elem_pys->get_column_name(hyd_label::sz_bound_id));
+	writer->add_column(Risk_System::table_results_elem_pys->get_column_name(risk_label::sz_break_id));
+	writer->add_column(Risk_System::table_results_elem_pys->get_column_name(risk_label::risk_type));
 
 
 	//data
-	query_string << Risk_System::table_results_elem_pys->get_column_name(dam_label::crit_age_50_59) <<" , ";
-	query_string << Risk_System::table_results_elem_pys->get_column_name(risk_label::risk_crit_age_50_59_with_hyd) <<" , ";
-	query_string << Risk_System::table_results_elem_pys->get_column_name(dam_label::crit_age_80) <<" , ";
-	query_string << Risk_System::table_results_elem_pys->get_column_name(risk_label::risk_crit_age_80_with_hyd) <<" , ";
-	query_string << Risk_System::table_results_elem_pys->get_column_name(dam_label::crit_female) <<" , ";
-	query_string << Risk_System::table_results_elem_pys->get_column_name(risk_label::risk_crit_female_with_hyd) <<" , ";
-	query_string << Risk_System::table_results_elem_pys->get_column_name(dam_label::crit_owner) <<" , ";
-	query_string << Risk_System::table_results_elem_pys->get_column_name(risk_label::risk_crit_owner_with_hyd) <<" , ";
-
-	query_string << Risk_System::table_results_elem_pys->get_column_name(dam_label::total_score) <<" , ";
-	query_string << Risk_System::table_results_elem_pys->get_column_name(risk_label::risk_pys_total_score) <<" , ";
-	query_string << Risk_System::table_results_elem_pys->get_column_name(risk_label::risk_pys_total_fac) <<" , ";
-
-	query_string << Risk_System::table_results_elem_pys->get_column_name(dam_label::denscrit_age50_59) <<" , ";
-	query_string << Risk_System::table_results_elem_pys->get_column_name(risk_label::risk_dens_crit_age_50_59_with_hyd) <<" , ";
-	query_string << Risk_System::table_results_elem_pys->get_column_name(dam_label::denscrit_age_80) <<" , ";
-	query_string << Risk_System::table_results_elem_pys->get_column_name(risk_label::risk_dens_crit_age_80_with_hyd) <<" , ";
-	query_string << Risk_System::table_results_elem_pys->get_column_name(dam_label::denscrit_female) <<" , ";
-	query_string << Risk_System::table_results_elem_pys->get_column_name(risk_label::risk_dens_crit_female_with_hyd) <<" , ";
-	query_string << Risk_System::table_results_elem_pys->get_column_name(dam_label::denscrit_owner) <<" , ";
-	query_string << Risk_System::table_results_elem_pys->get_column_name(risk_label::risk_dens_crit_owner_with_hyd) <<" , ";
-
-	query_string << Risk_System::table_results_elem_pys->get_column_name(dam_label::total_dens_score) <<" , ";
-	query_string << Risk_System::table_results_elem_pys->get_column_name(risk_label::risk_pys_total_dens_score) <<" , ";
-	query_string << Risk_System::table_results_elem_pys->get_column_name(risk_label::risk_pys_total_dens_fac) <<" , ";
-
-	query_string << Risk_System::table_results_elem_pys->get_column_name(dam_label::elem_poly) <<" ) ";
-
-	query_string << " VALUES ";
-
-	buffer=query_string.str();
-
-	return buffer;
-}
-//Generate sql-header string for inserting data to the database table for detailed results per damage point of the simple counting damage 
-string Risk_System::generate_sql_header_string_point_sc(void){
-	string buffer;
+	writer->add_column(Risk_System::table_results_elem_pys->get_column_name(dam_label::crit_age_50_59));
+	writer->add_column(Risk_System::table_results_elem_pys->get_column_name(risk_label::risk_crit_age_50_59_with_hyd));
+	writer->add_column(Risk_System::table_results_elem_pys->get_column_name(dam_label::crit_age_80));
+	writer->add_column(Risk_System::table_results_elem_pys->get_column_name(risk_label::risk_crit_age_80_with_hyd));
+	writer->add_column(Risk_System::table_results_elem_pys->get_column_name(dam_label::crit_female));
+	writer->add_column(Risk_System::table_results_elem_pys->get_column_name(risk_label::risk_crit_female_with_hyd));
+	writer->add_column(Risk_System::table_results_elem_pys->get_column_name(dam_label::crit_owner));
+	writer->add_column(Risk_System::table_results_elem_pys->get_column_name(risk_label::risk_crit_owner_with_hyd));
+
+	writer->add_column(Risk_System::table_results_elem_pys->get_column_name(dam_label::total_score));
+	writer->add_column(Risk_System::table_results_elem_pys->get_column_name(risk_label::risk_pys_total_score));
+	writer->add_column(Risk_System::table_results_elem_pys->get_column_name(risk_label::risk_pys_total_fac));
+
+	writer->add_column(Risk_System::table_results_elem_pys->get_column_name(dam_label::denscrit_age50_59));
+	writer->add_column(Risk_System::table_results_elem_pys->get_column_name(risk_label::risk_dens_crit_age_50_59_with_hyd));
+	writer->add_column(Risk_System::table_results_elem_pys->get_column_name(dam_label::denscrit_age_80));
+	writer->add_column(Risk_System::table_results_elem_pys->get_column_name(risk_label::risk_dens_crit_age_80_with_hyd));
+	writer->add_column(Risk_System::table_results_elem_pys->get_column_name(dam_label::denscrit_female));
+	writer->add_column(Risk_System::table_results_elem_pys->get_column_name(risk_label::risk_dens_crit_female_with_hyd));
+	writer->add_column(Risk_System::table_results_elem_pys->get_column_name(dam_label::denscrit_owner));
+	writer->add_column(Risk_System::table_results_elem_pys->get_column_name(risk_label::risk_dens_crit_owner_with_hyd));
+
+	writer->add_column(Risk_System::table_results_elem_pys->get_column_name(dam_label::total_dens_score));
+	writer->add_column(Risk_System::table_results_elem_pys->get_column_name(risk_label::risk_pys_total_dens_score));
+	writer->add_column(Risk_System::table_results_elem_pys->get_column_name(risk_label::risk_pys_total_dens_fac));
+
+	writer->add_column(Risk_System::table_results_elem_pys->get_column_name(dam_label::elem_poly), _sys_bulk_column_type::bulk_geometry_wkt);
+}
+//Set the table and the columns of the bulk writer for the database table for detailed results per damage point of the simple counting damage 
+void Risk_System::set_bulk_writer_point_sc(Sys_Database_Bulk_Writer *writer){
 	//the table is set (the name and the column names) and allocated
 	try{
 		Risk_System::set_table_result_point_sc(&this->qsqldatabase);
@@ -9104,40 +8896,32 @@ string Risk_System::generate_sql_header_string_point_sc(void){
 		throw msg;
 	}
 
-	//set the query via a query string
-	ostringstream query_string;
-	query_string << "INSERT INTO  " << Risk_System::table_results_point_sc->get_table_name();
-	query_string <<" ( ";
-	query_string << Risk_System::table_results_point_sc->get_column_name(dam_label::glob_id) <<" , ";
-	query_string << Risk_System::table_results_point_sc->get_column_name(dam_label::point_id) <<" , ";
-	query_string << Risk_System::table_results_point_sc->get_column_name(label::areastate_id) <<" , ";
-	query_string << Risk_System::table_results_point_sc->get_column_name(label::measure_id) <<" , ";
-	query_string << Risk_System::table_results_point_sc->get_column_name(hyd_label::sz_bound_id) <<" , ";
-	query_string << Risk_System::table_results_point_sc->get_column_name(risk_label::sz_break_id) <<" , ";
-	query_string << Risk_System::table_results_point_sc->get_column_name(risk_label::risk_type) <<" , ";
+	//set the table and the columns of the writer
+	writer->set_table(Risk_System::table_results_point_sc->get_table_name());
+	writer->add_column(Risk_System::table_results_point_sc->get_column_name(dam_label::glob_id));
+	writer->add_column(Risk_System::table_results_point_sc->get_column_name(dam_label::point_id));
+	writer->add_column(Risk_System::table_results_point_sc->get_column_name(label::areastate_id));
+	writer->add_column(Risk_System::table_results_point_sc->get_column_name(label::measure_id));
+	writer->add_column(Risk_System::table_results_point_sc->get_column_name(hyd_label::sz_bound_id));
+	writer->add_column(Risk_System::table_results_point_sc->get_column_name(risk_label::sz_break_id));
+	writer->add_column(Risk_System::table_results_point_sc->get_column_name(risk_label::risk_type));
 
 
 	//data
-	query_string << Risk_System::table_results_point_sc->get_column_name(dam_label::sc_pub_build) <<" , ";
-	query_string << Risk_System::table_results_point_sc->get_column_name(risk_label::risk_sc_pub_build_with_hyd) <<" , ";
-	query_string << Risk_System::table_results_point_sc->get_column_name(dam_label::sc_eco_build) <<" , ";
-	query_string << Risk_System::table_results_point_sc->get_column_name(risk_label::risk_sc_eco_build_with_hyd) <<" , ";
-	query_string << Risk_System::table_results_point_sc->get_column_name(dam_label::sc_cult_build) <<" , ";
-	query_string << Risk_System::table_results_point_sc->get_column_name(risk_label::risk_sc_cult_build_with_hyd) <<" , ";
-	query_string << Risk_System::table_results_point_sc->get_column_name(dam_label::sc_person_build) <<" , ";
-	query_string << Risk_System::table_results_point_sc->get_column_name(risk_label::risk_sc_person_build_with_hyd) <<" , ";
-
-
-	query_string << Risk_System::table_results_point_sc->get_column_name(risk_label::risk_sc_fac) <<" , ";
-
+	writer->add_column(Risk_System::table_results_point_sc->get_column_name(dam_label::sc_pub_build));
+	writer->add_column(Risk_System::table_results_point_sc->get_column_name(risk_label::risk_sc_pub_build_with_hyd));
+	writer->add_column(Risk_System::table_results_point_sc->get_column_name(dam_label::sc_eco_build));
+	writer->add_column(Risk_System::table_results_point_sc->get_column_name(risk_label::risk_sc_eco_build_with_hyd));
+	writer->add_column(Risk_System::table_results_point_sc->get_column_name(dam_label::sc_cult_build));
+	writer->add_column(Risk_System::table_results_point_sc->get_column_name(risk_label::risk_sc_cult_build_with_hyd));
+	writer->add_column(Risk_System::table_results_point_sc->get_column_name(dam_label::sc_person_build));
+	writer->add_column(Risk_System::table_results_point_sc->get_column_name(risk_label::risk_sc_person_build_with_hyd));
 
-	query_string << Risk_System::table_results_point_sc->get_column_name(dam_label::sc_point) <<" ) ";
 
-	query_string << " VALUES ";
+	writer->add_column(Risk_System::table_results_point_sc->get_column_name(risk_label::risk_sc_fac));
 
-	buffer=query_string.str();
 
-	return buffer;
+	writer->add_column(Risk_System::table_results_point_sc->get_column_name(dam_label::sc_point), _sys_bulk_column_type::bulk_geometry_wkt);
 }
 //Set warning(s)
 Warning Risk_System::set_warning(const int warn_type){
@@ -556,6 +556,8 @@ private:
 	Fpl_Calculation *fpl_calc;
 	///Flag if the fpl-system is working
 	bool fpl_system_working;
+	///Waiter for the end of the hydraulic and fpl threads
+	Sys_Thread_Waiter thread_waiter;
 
 	///Type of risk calculation
 	_risk_type risk_type;
@@ -735,18 +737,18 @@ private:
 	///Check if there are data in one of the detailed risk results element table
 	bool check_detailed_risk_element_results(const string break_id, const int hyd_bound_id);
 
-	///Generate sql-header string for inserting data to the database table for detailed results per damage raster-element of the economical damage raster 
-	string generate_sql_header_string_elem_ecn(void);
-	///Generate sql-header string for inserting data to the database table for detailed results per damage raster-element of the ecological biotope-type damage raster 
-	string generate_sql_header_string_elem_eco_btype(void);
-	///Generate sql-header string for inserting data to the database table for detailed results per damage raster-element of the ecological soil-erosion damage raster 
-	string generate_sql_header_string_elem_eco_soil(void);
-	///Generate sql-header string for inserting data to the database table for detailed results per damage raster-element of the people2risk damage raster 
-	string generate_sql_header_string_elem_pop(void);
-	///Generate sql-header string for inserting data to the database table for detailed results per damage raster-element of the psycho-social damage raster
-	string generate_sql_header_string_elem_pys(void);
-	///Generate sql-header string for inserting data to the database table for detailed results per damage point of the simple counting damage 
-	string generate_sql_header_string_point_sc(void);
+	///Set the table and the columns of the bulk writer for the database table for detailed results per damage raster-element of the economical damage raster 
+	void set_bulk_writer_elem_ecn(Sys_Database_Bulk_Writer *writer);
+	///Set the table and the columns of the bulk writer for the database table for detailed results per damage raster-element of the ecological biotope-type damage raster 
+	void set_bulk_writer_elem_eco_btype(Sys_Database_Bulk_Writer *writer);
+	///Set the table and the columns of the bulk writer for the database table for detailed results per damage raster-element of the ecological soil-erosion damage raster 
+	void set_bulk_writer_elem_eco_soil(Sys_Database_Bulk_Writer *writer);
+	///Set the table and the columns of the bulk writer for the database table for detailed results per damage raster-element of the people2risk damage raster 
+	void set_bulk_writer_elem_pop(Sys_Database_Bulk_Writer *writer);
+	///Set the table and the columns of the bulk writer for the database table for detailed results per damage raster-element of the psycho-social damage raster
+	void set_bulk_writer_elem_pys(Sys_Database_Bulk_Writer *writer);
+	///Set the table and the columns of the bulk writer for the database table for detailed results per damage point of the simple counting damage 
+	void set_bulk_writer_point_sc(Sys_Database_Bulk_Writer *writer);
 
 	///Set warning(s)
 	Warning set_warning(const int warn_type);
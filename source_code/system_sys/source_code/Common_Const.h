@@ -226,6 +226,12 @@ namespace constant{
 	const double side_weir_reduction=0.95;
 	///Standard value for the 1d stabilization discharge
 	const double stabilization_q=50.0;
+	///Minimum number of river profiles for a parallel (OpenMP) loop over the profiles in the solver function of a river model
+	const int min_profiles_parallel=256;
+	///Minimum number of river profiles for a parallel (OpenMP) generation of the profile tables of a river model
+	const int min_profiles_parallel_tables=4;
+	///Minimum number of temperature profiles for a parallel (OpenMP) calculation of the heat flows of a temperature model
+	const int min_profiles_parallel_heat_flows=100;
 	///The value for the minimal bridge height; it is 1.0 m
 	const double min_height_bridge=1.0;
 	///The value for the minimal bridge body size; it is 1.0 m
@@ -468,6 +474,8 @@ namespace sys_label{
 	const string folder_outputfile("/output");
 	///Folder name of the data
 	const string folder_datafile("/data");
+	///Folder name of the persisted river profile tables
+	const string folder_profile_tables("/profile_tables");
 
 	///String for the project types: all moduls \see Sys_Project
 	const string proj_typ_all("ALL");
@@ -1744,6 +1752,8 @@ namespace hyd_label{
 	const string Conveyance_table_right("x= area; y=Conveyance of right bank");
 	///String for the river profile table type: Area dependent to waterlevel (Hyd_Tables)
 	const string Area_table("x=waterlevel; y=area");
+	///String for the river profile table type: Waterlevel, width and conveyances dependent to area (Hyd_Fused_Tables)
+	const string Profile_table("x= area; y=Waterlevel, Width, Conveyance of left bank, main channel, right bank");
 	///String for the weir profile table type: Discharge per segment dependent to waterlevel (Hyd_Tables)
 	const string Weir_discharge_table("x=waterlevel; y=discharge per segment");
 	///String for the weir profile table type: Conveyance of the left bank of a weir profile dependent to waterlevel (Hyd_Tables)
@@ -2538,6 +2548,8 @@ namespace hyd_label{
 	const string bluekenue("bluekenue");
 	///Output for ParaView / csv
 	const string paraview("paraview");
+	///Output for the binary result time series
+	const string binary("binary");
 
 	///File type .dat (tecplot)
 	const string dat(".dat");
@@ -2547,6 +2559,8 @@ namespace hyd_label{
 	const string csv(".csv");
 	///File type .vtk (paraview)
 	const string vtk(".vtk");
+	///File type .bin (binary result time series)
+	const string bin(".bin");
 
 }
 ///General text labels specially for the module DAM \ingroup dam
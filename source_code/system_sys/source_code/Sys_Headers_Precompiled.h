@@ -62,6 +62,10 @@
 
 //the database class
 #include "Data_Base.h"
+//class for writing a large number of data rows to the database
+#include "Sys_Database_Bulk_Writer.h"
+//class for reading a large number of data rows from the database
+#include "Sys_Database_Stream_Reader.h"
 //class for the database tables
 #include "Tables.h"
 //class for aes-encoding
@@ -157,6 +161,8 @@
 
 //Thread class for mannaging the clsoing of the different threads
 #include "Sys_Thread_Closing_Manager.h"
+//class for waiting on the end of worker threads
+#include "Sys_Thread_Waiter.h"
 //text searcher for the output displays
 #include "Sys_Text_Searcher_Wid.h"
 //Text browser widget
@@ -0,0 +1,77 @@
+#include "Sys_Headers_Precompiled.h"
+//#include "Sys_Thread_Waiter.h"
+
+//Default constructor
+Sys_Thread_Waiter::Sys_Thread_Waiter(void){
+	this->number_finished=0;
+	//count the memory
+	Sys_Memory_Count::self()->add_mem(sizeof(Sys_Thread_Waiter), _sys_system_modules::SYS_SYS);
+}
+//Default destructor
+Sys_Thread_Waiter::~Sys_Thread_Waiter(void){
+	//count the memory
+	Sys_Memory_Count::self()->minus_mem(sizeof(Sys_Thread_Waiter), _sys_system_modules::SYS_SYS);
+}
+//___________
+//public
+//Observe the given thread; its end wakes up the waiting thread
+void Sys_Thread_Waiter::observe_thread(QThread *thread){
+	if(thread==NULL){
+		return;
+	}
+	//a former thread at the same address is forgotten
+	this->mutex.lock();
+	this->finished_threads.removeAll(thread);
+	this->mutex.unlock();
+	//direct connection: the functions are executed by the observed thread itself
+	QObject::connect(thread, &QThread::started, this, [this, thread](){this->thread_started(thread);}, Qt::DirectConnection);
+	QObject::connect(thread, &QThread::finished, this, [this, thread](){this->thread_finished(thread);}, Qt::DirectConnection);
+}
+//Start the given thread; it is counted as running before its started-signal is recieved
+void Sys_Thread_Waiter::start_thread(QThread *thread){
+	if(thread==NULL){
+		return;
+	}
+	//otherwise the thread stays finished from its last run until the started-signal is delivered
+	this->mutex.lock();
+	this->finished_threads.removeAll(thread);
+	this->mutex.unlock();
+	thread->start();
+}
+//Get the number of finished threads since the construction
+int Sys_Thread_Waiter::get_number_finished(void){
+	QMutexLocker locker(&this->mutex);
+	return this->number_finished;
+}
+//Get if the given thread is running; a thread, which has already sent its finished-signal, is not running anymore
+bool Sys_Thread_Waiter::get_thread_running(QThread *thread){
+	if(thread==NULL || thread->isRunning()==false){
+		return false;
+	}
+	QMutexLocker locker(&this->mutex);
+	return !this->finished_threads.contains(thread);
+}
+//Wait until the number of finished threads differs from the given number or the maximum time [ms] is over; return the number of finished threads
+int Sys_Thread_Waiter::wait_next_finished(const int number_known, const unsigned long max_time){
+	QMutexLocker locker(&this->mutex);
+	if(this->number_finished==number_known){
+		this->condition.wait(&this->mutex, max_time);
+	}
+	return this->number_finished;
+}
+//__________
+//private
+//Recieve that an observed thread has started
+void Sys_Thread_Waiter::thread_started(QThread *thread){
+	QMutexLocker locker(&this->mutex);
+	this->finished_threads.removeAll(thread);
+}
+//Recieve that an observed thread has finished
+void Sys_Thread_Waiter::thread_finished(QThread *thread){
+	QMutexLocker locker(&this->mutex);
+	if(this->finished_threads.contains(thread)==false){
+		this->finished_threads.append(thread);
+	}
+	this->number_finished++;
+	this->condition.wakeAll();
+}
@@ -0,0 +1,67 @@
+#pragma once
+/**\class Sys_Thread_Waiter
+	\author Daniel Bachmann et al.
+	\author produced by the Institute of Hydraulic Engineering (IWW), RWTH Aachen University
+	\version 0.0.1                                                              
+	\date 2009 
+*/
+#ifndef SYS_THREAD_WAITER_H
+#define SYS_THREAD_WAITER_H
+
+//qt libs
+#include <QObject>
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QList>
+
+///Class for waiting on the end of worker threads without polling \ingroup sys
+/**
+The started- and finished-signals of the observed threads are directly connected to this class. A managing thread
+blocks in wait_next_finished() until one of the observed threads has finished, instead of sleeping for a fixed time. 
+The number of finished threads is counted, thus a thread finishing between get_number_finished() and 
+wait_next_finished() does not get lost. 
+*/
+class Sys_Thread_Waiter : public QObject
+{
+
+//Macro for using signals and slots (Qt)in this class
+Q_OBJECT 
+
+public:
+	///Default constructor
+	Sys_Thread_Waiter(void);
+	///Default destructor
+	~Sys_Thread_Waiter(void);
+
+	//methods
+	///Observe the given thread; its end wakes up the waiting thread
+	void observe_thread(QThread *thread);
+	///Start the given thread; it is counted as running before its started-signal is recieved
+	void start_thread(QThread *thread);
+
+	///Get the number of finished threads since the construction
+	int get_number_finished(void);
+	///Get if the given thread is running; a thread, which has already sent its finished-signal, is not running anymore
+	bool get_thread_running(QThread *thread);
+	///Wait until the number of finished threads differs from the given number or the maximum time [ms] is over; return the number of finished threads
+	int wait_next_finished(const int number_known, const unsigned long max_time);
+
+private:
+	//members
+	///Mutex for the members
+	QMutex mutex;
+	///Wait condition for the waiting thread
+	QWaitCondition condition;
+	///Number of finished threads since the construction
+	int number_finished;
+	///Observed threads, which have finished since their last start
+	QList<QThread*> finished_threads;
+
+	//methods
+	///Recieve that an observed thread has started
+	void thread_started(QThread *thread);
+	///Recieve that an observed thread has finished
+	void thread_finished(QThread *thread);
+};
+#endif
@@ -4,6 +4,8 @@
 //init static members
 string Tables::table_file_name=label::not_set;
 string Tables::project_prefix="proj1_";
+QMutex Tables::reserve_locker;
+map<string, _sys_reserved_values> Tables::reserved_values;
 
 //Default constructor
 Tables::Tables(void): table_suffix("_prm"){
@@ -32,6 +34,7 @@ Tables::Tables(const string id_name, const string id_column[], const int column_
 		this->column[i].name=label::not_set;	
 		this->column[i].found_flag=false;
 	}
+	this->set_column_index();
 }
 //Default destructor
 Tables::~Tables(void){
@@ -80,6 +83,7 @@ void Tables::set_id_name_columns(const string id_column[], const int column_numb
 		this->column[i].name=label::not_set;	
 		this->column[i].found_flag=false;
 	}
+	this->set_column_index();
 }
 //Set and combine the used name of the table and the columns with the id-names from the table-file
 void Tables::set_name(QSqlDatabase *ptr_database, _sys_table_type actuel_type){
@@ -392,30 +396,23 @@ string Tables::get_table_name(void){
 }
 //Get the used name of a column with a given id-name; needed for a database query
 string Tables::get_column_name(const string id){
-	this->my_locker.lock();
-	string buffer_name;
-	for(int i=0; i< this->col_num; i++){
-		if(id==this->column[i].id){
-			buffer_name=this->column[i].name;
-			break;
-		}	
+	//the index is not changed after the allocation of the columns; no locking is required
+	unordered_map<string, int>::const_iterator it=this->column_index.find(id);
+	if(it==this->column_index.end()){
+		return string();
 	}
-	this->my_locker.unlock();
-	return buffer_name;
+	return this->column[it->second].name;
 }
 ///Get the used name of a column with a given id-name; needed for a database query; table name is added
 string Tables::get_column_name_table(const string id) {
-	this->my_locker.lock();
-	string buffer_name; 
+	string buffer_name;
+	unordered_map<string, int>::const_iterator it=this->column_index.find(id);
+	buffer_name.reserve(this->table_name.name.length()+1+(it==this->column_index.end() ? 0 : this->column[it->second].name.length()));
 	buffer_name.append(this->table_name.name);
 	buffer_name += ".";
-	for (int i = 0; i < this->col_num; i++) {
-		if (id == this->column[i].id) {
-			buffer_name += this->column[i].name;
-			break;
-		}
+	if(it!=this->column_index.end()){
+		buffer_name += this->column[it->second].name;
 	}
-	this->my_locker.unlock();
 	return buffer_name;
 }
 //Delete the whole data in the database table
@@ -460,6 +457,62 @@ int Tables::maximum_int_of_column(const string column_name, QSqlDatabase *ptr_da
 	}
 	return max;
 }
+//Reserve a number of consecutive integer values of a given column for new data records and return the first one; used instead of maximum_int_of_column()+1 for the global identifiers of frequently written tables (not inside a transaction)
+int Tables::reserve_int_of_column(const string column_name, QSqlDatabase *ptr_database, const int number){
+	/**The values are counted in a counter table of the project (one row per table and column), which is
+	initialized with the maximum of the column. A process reserves blocks of at least reserve_block_size values
+	by one atomic update of the counter and hands them out to all its threads. Thus the table is not scanned and
+	parallel threads and processes get disjunct values. Values of a block, which are not used until the end of
+	the process, stay unused. The update of the counter must not be rolled back, therefore it is not called
+	inside a transaction.
+	*/
+	int required=number;
+	if(required<1){
+		required=1;
+	}
+	ostringstream key;
+	key << ptr_database->hostName().toStdString() << ":" << ptr_database->port() << "/" << ptr_database->databaseName().toStdString();
+	key << "/" << this->get_table_name() << "." << column_name;
+
+	QMutexLocker locker(&Tables::reserve_locker);
+	map<string, _sys_reserved_values>::iterator it=Tables::reserved_values.find(key.str());
+	if(it!=Tables::reserved_values.end()){
+		if(it->second.counter_flag==false){
+			return this->maximum_int_of_column(column_name, ptr_database)+1;
+		}
+		if(it->second.end-it->second.next>=required){
+			int first=it->second.next;
+			it->second.next=it->second.next+required;
+			return first;
+		}
+	}
+
+	_sys_reserved_values values;
+	int block=Tables::reserve_block_size;
+	if(required>block){
+		block=required;
+	}
+	long long int first=this->reserve_int_of_column_database(column_name, ptr_database, block);
+	if(first<0 || first+block>(long long int)numeric_limits<int>::max()){
+		//the maximum of the column is taken for this table and column
+		values.next=0;
+		values.end=0;
+		values.counter_flag=false;
+		Tables::reserved_values[key.str()]=values;
+		Warning msg=this->set_warning(1);
+		ostringstream info;
+		info << "Table name  : " << this->get_table_name() << endl;
+		info << "Column name : " << column_name << endl;
+		msg.make_second_info(info.str());
+		msg.output_msg(0);
+		return this->maximum_int_of_column(column_name, ptr_database)+1;
+	}
+	values.next=(int)first+required;
+	values.end=(int)(first+block);
+	values.counter_flag=true;
+	Tables::reserved_values[key.str()]=values;
+	return (int)first;
+}
 
 //Create an index to a given column in table (return value true)
 void Tables::create_index2column(QSqlDatabase *ptr_database, const string column_name) {
@@ -472,15 +525,22 @@ void Tables::create_index2column(QSqlDatabase *ptr_database, const string column
 	query.first();
 
 }
-///Create a spatial index to a given column in table (return value true)
-void Tables::create_spatial_index2column(QSqlDatabase *ptr_database, const string column_name) {
+///Create a spatial index to a given column in table, if it does not exist; false is returned, if the request failed
+bool Tables::create_spatial_index2column(QSqlDatabase *ptr_database, const string column_name, string *error_text) {
 	ostringstream request;
-	request << "CREATE INDEX " << this->table_name.name << "_" << column_name << "_geom_idx ON ";
+	request << "CREATE INDEX IF NOT EXISTS " << this->table_name.name << "_" << column_name << "_geom_idx ON ";
 	request << this->get_table_name() << " USING GIST (" << column_name << ")";
 
 	QSqlQuery query(*ptr_database);
 	Data_Base::database_request(&query, request.str(), ptr_database);
+	if(query.lastError().isValid()){
+		if(error_text!=NULL){
+			*error_text=query.lastError().text().toStdString();
+		}
+		return false;
+	}
 	query.first();
+	return true;
 }
 //Output the table name and column names: id-names as well as used names
 void Tables::output_tab_col(void){
@@ -685,6 +745,15 @@ void Tables::allocate_columns(void){
 	}
 
 }
+//Set the index of the columns per id-name
+void Tables::set_column_index(void){
+	this->column_index.clear();
+	this->column_index.reserve(this->col_num);
+	for(int i=0; i<this->col_num; i++){
+		//the first column with the id-name is used, like in the former linear search
+		this->column_index.insert(pair<string, int>(this->column[i].id, i));
+	}
+}
 //Return the user specifed name following the keyword (expression), which is found in the table-file after the id-name
 string Tables::found_string(const string expression, const string search_string){
 	string buffer_begin=search_string;
@@ -884,6 +953,62 @@ string Tables::get_total_table_name(void){
 
 	return buff.str();
 }
+//Reserve a number of consecutive integer values of a given column in the counter table of the database; the first value is returned (-1 if the counter table can not be used)
+long long int Tables::reserve_int_of_column_database(const string column_name, QSqlDatabase *ptr_database, const int number){
+	string counter=Tables::get_counter_table_name();
+	ostringstream filter;
+	filter << " WHERE table_name = '" << this->get_table_name() << "' AND column_name = '" << column_name << "'";
+	QSqlQuery query(*ptr_database);
+	ostringstream request;
+
+	for(int attempt=0; attempt<2; attempt++){
+		if(attempt==1){
+			//create the counter initialized with the maximum of the column; a counter of a parallel process is kept
+			request.str("");
+			request << "CREATE TABLE IF NOT EXISTS " << counter << " (table_name VARCHAR(255) NOT NULL, column_name VARCHAR(255) NOT NULL, ";
+			request << "next_value BIGINT NOT NULL, PRIMARY KEY (table_name, column_name))";
+			Data_Base::database_request(&query, request.str(), ptr_database);
+			request.str("");
+			request << "INSERT INTO " << counter << " (table_name, column_name, next_value) SELECT '" << this->get_table_name() << "' , '";
+			request << column_name << "' , COALESCE(MAX(" << column_name << "),0)+1 FROM " << this->get_table_name();
+			Data_Base::database_request(&query, request.str(), ptr_database);
+		}
+		request.str("");
+		if(Data_Base::get_driver_type()==_sys_driver_type::POSTGRESQL){
+			request << "UPDATE " << counter << " SET next_value = next_value + " << number << filter.str() << " RETURNING next_value - " << number;
+			Data_Base::database_request(&query, request.str(), ptr_database);
+			if(query.lastError().isValid()==false && query.first()==true){
+				return query.value(0).toLongLong();
+			}
+		}
+		else{
+			//the updated value is stored per connection
+			request << "UPDATE " << counter << " SET next_value = LAST_INSERT_ID(next_value + " << number << ")" << filter.str();
+			Data_Base::database_request(&query, request.str(), ptr_database);
+			if(query.lastError().isValid()==false && query.numRowsAffected()>0){
+				request.str("");
+				request << "SELECT LAST_INSERT_ID() - " << number;
+				Data_Base::database_request(&query, request.str(), ptr_database);
+				if(query.lastError().isValid()==false && query.first()==true){
+					return query.value(0).toLongLong();
+				}
+			}
+		}
+	}
+	return -1;
+}
+//Get the name of the counter table for the reserved values (static)
+string Tables::get_counter_table_name(void){
+	ostringstream buff;
+	if(Data_Base::get_driver_type()==_sys_driver_type::POSTGRESQL){
+		buff << Sys_Project::get_complete_project_database_schemata_name() << ".";
+	}
+	else{
+		buff << Sys_Project::get_complete_project_database_table_prefix_name();
+	}
+	buff << "sys_reserved_values_prm";
+	return buff.str();
+}
 //Set the prefix for the output
 void Tables::set_output_prefix(void){
 	switch(this->tabletype){
@@ -1065,6 +1190,13 @@ Warning Tables::set_warning(const int warn_type){
 		//	help="Check the database";
 		//	type=2;
 		//	break;
+		case 1://counter table can not be used
+			place.append("reserve_int_of_column(const string column_name, QSqlDatabase *ptr_database, const int number)");
+			reason="The counter table for the reserved values can not be used";
+			reaction="The maximum of the column is taken; parallel writing of data records may lead to equal identifiers";
+			help="Check the database and the rights of the user";
+			type=2;
+			break;
 		default:
 			place.append("set_warning(const int warn_type)");
 			reason ="Unknown flag!";
@@ -9,6 +9,9 @@
 #define TABLES_H
 
 //libs
+#include <map>
+#include <unordered_map>
+#include <limits>
 
 //qtclasses
 #include <QMutex>
@@ -48,6 +51,15 @@ struct _Sys_data_tab_column{
 	///Flag if the column is a unsigned value
 	bool unsigned_flag;
 };
+///Structure for a block of reserved integer values of a table column (see Tables::reserve_int_of_column()) \ingroup sys
+struct _sys_reserved_values{
+	///Next free value of the block
+	int next;
+	///End of the block (not included)
+	int end;
+	///Flag if the counter table of the database is used; otherwise the maximum of the column is taken
+	bool counter_flag;
+};
 //enums
 ///Enumerator for different table type for each module \ingroup sys
 enum _sys_table_type{
@@ -72,6 +84,8 @@ enum _sys_table_type{
 Here the user defined table name/column names are combined with the id-names. These id-names are used in the programm to 
 access the database. The combination of the used names and the id-names are specified in the table-file by the user.
 It will be also checked, if the defined table and their columns exist in the database.
+The id-names of the columns are indexed by a hash map; after set_name() the column names are fixed, thus they are
+resolved without locking in parallel threads.
 */
 class Tables
 {
@@ -122,10 +136,14 @@ public:
 
 	///Get the maximum value as integer of a given column; used for evaluation the global identifier of data records
 	int maximum_int_of_column(const string column_name, QSqlDatabase *ptr_database);
+	///Reserve a number of consecutive integer values of a given column for new data records and return the first one; used instead of maximum_int_of_column()+1 for the global identifiers of frequently written tables (not inside a transaction)
+	int reserve_int_of_column(const string column_name, QSqlDatabase *ptr_database, const int number);
+	///Number of values, which are reserved at once per process by reserve_int_of_column()
+	static const int reserve_block_size=10000;
 	///Create an index to a given column in table (return value true)
 	void create_index2column(QSqlDatabase *ptr_database, const string column_name);
-	///Create a spatial index to a given column in table (return value true)
-	void create_spatial_index2column(QSqlDatabase *ptr_database, const string column_name);
+	///Create a spatial index to a given column in table, if it does not exist; false is returned, if the request failed
+	bool create_spatial_index2column(QSqlDatabase *ptr_database, const string column_name, string *error_text=NULL);
 	
 	///Output the table name and column names: id-names as well as used names
 	void output_tab_col(void);
@@ -166,13 +184,20 @@ private:
 	///Tables suffix for identifiying PromaIdes-tables
 	const string table_suffix;
 
-	///Locker object for a thread safe access to the table
-	QMutex my_locker;
+	///Index of the columns per id-name
+	unordered_map<string, int> column_index;
+
+	///Locker object for the reserved values of all tables
+	static QMutex reserve_locker;
+	///Reserved values per database, table and column of this process
+	static map<string, _sys_reserved_values> reserved_values;
 
 	//methods
 
 	///Allocate the column _sys_id_name structure for the columns of the database table
 	void allocate_columns(void);
+	///Set the index of the columns per id-name
+	void set_column_index(void);
 	///Return the user specifed name following the keyword (expression), which is found in the table-file after the id-name
 	string found_string(const string expression, const string search_string);
 	///Search for a keyword (expression) in the table-file (here the id-names); return true, when the id-name is founded in the table-file
@@ -187,6 +212,11 @@ private:
 	///Get the total table name completly with project-prefix and type-prefix; the name is in the lower case
 	string get_total_table_name(void);
 
+	///Reserve a number of consecutive integer values of a given column in the counter table of the database; the first value is returned (-1 if the counter table can not be used)
+	long long int reserve_int_of_column_database(const string column_name, QSqlDatabase *ptr_database, const int number);
+	///Get the name of the counter table for the reserved values
+	static string get_counter_table_name(void);
+
 	///Set the prefix for the output
 	void set_output_prefix(void);
 	///Table type to system type
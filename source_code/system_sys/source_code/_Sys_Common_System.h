@@ -22,6 +22,8 @@
 #include "Sys_Memory_Count.h"
 #include "Tables.h"
 #include "Data_Base.h"
+#include "Sys_Database_Bulk_Writer.h"
+#include "Sys_Database_Stream_Reader.h"
 #include "Common_Const.h"
 #include "Sys_Database_Browser.h"
 
@@ -1,8 +1,14 @@
 //#include "Data_Base.h"
 #include "Sys_Headers_Precompiled.h"
 
+#ifdef SYS_LIBPQ_COPY
+	//the native connection handle of the QPSQL driver for the COPY
+	#include <libpq-fe.h>
+#endif
+
 //init static members
-QMutex Data_Base::my_locker;
+QMutex Data_Base::pool_locker;
+map<QString, QMutex> Data_Base::connection_lockers;
 _sys_driver_type Data_Base::driver_type=_sys_driver_type::UNKNOWN_DR;
 bool Data_Base::reconnect_flag=true;
 
@@ -448,13 +454,13 @@ void Data_Base::set_input_byfile(const string file_name){
 	}
 
 }
-//Set a query to the database via QSqlTableModel (thread safe, due to lockinq with QMutex) (static)
+//Set a query to the database via QSqlTableModel (thread safe, due to locking of the connection) (static)
 void Data_Base::database_request(QSqlTableModel *table_model){
 
-	my_locker.lock();
-	table_model->select();
     QSqlDatabase ptr_database;
     ptr_database=table_model->database();
+	QMutexLocker locker(Data_Base::get_connection_locker(ptr_database.connectionName()));
+	table_model->select();
     if(table_model->lastError().isValid()==true && ptr_database.isOpen()==false){
         Data_Base::database_check_connection(&ptr_database);
 		//renew the sql-command
@@ -462,12 +468,11 @@ void Data_Base::database_request(QSqlTableModel *table_model){
 			table_model->select();
 		}
 	}
-	my_locker.unlock();
 }
-//Set a query to the database via QSqlTableModel and a qiven query string (thread safe, due to lockinq with QMutex) (static)
+//Set a query to the database via QSqlTableModel and a qiven query string (thread safe, due to locking of the connection) (static)
 void Data_Base::database_request(QSqlQuery *query, string querystring, QSqlDatabase *ptr_database){
 
-	my_locker.lock();
+	QMutexLocker locker(Data_Base::get_connection_locker(ptr_database->connectionName()));
 	query->exec(querystring.c_str());
 	
 	if(query->lastError().isValid()==true && ptr_database->isOpen()==false){
@@ -484,12 +489,11 @@ void Data_Base::database_request(QSqlQuery *query, string querystring, QSqlDatab
 		}
 		
 	}
-	my_locker.unlock();
 }
-//Set a query to the database via QSqlTableModel, a qiven query string and a pointer to the database (thread safe, due to lockinq with QMutex) (static)
+//Set a query to the database via QSqlTableModel, a qiven query string and a pointer to the database (thread safe, due to locking of the connection) (static)
 void Data_Base::database_request(QSqlQueryModel *query_model, string querystring, QSqlDatabase *ptr_database){
 
-	my_locker.lock();
+	QMutexLocker locker(Data_Base::get_connection_locker(ptr_database->connectionName()));
 	query_model->setQuery(querystring.c_str(), *ptr_database);
 	if(query_model->lastError().isValid()==true && ptr_database->isOpen()==false ){
 		
@@ -507,7 +511,6 @@ void Data_Base::database_request(QSqlQueryModel *query_model, string querystring
 		}
 
 	}
-	my_locker.unlock();
 }
 //Check the database connection in case of an error (static)
 void Data_Base::database_check_connection(QSqlDatabase *ptr_database){
@@ -585,25 +588,24 @@ void Data_Base::database_check_connection(QSqlDatabase *ptr_database){
 	}
 
 }
-//Submit data to the database via QSqlTableModel (thread safe, due to lockinq with QMutex) (static)
+//Submit data to the database via QSqlTableModel (thread safe, due to locking of the connection) (static)
 void Data_Base::database_submit(QSqlTableModel *table_model){
 
-	my_locker.lock();
-	table_model->submitAll();
     QSqlDatabase ptr_database;
     ptr_database=table_model->database();
+	QMutexLocker locker(Data_Base::get_connection_locker(ptr_database.connectionName()));
+	table_model->submitAll();
 
     if(table_model->lastError().isValid()==true || ptr_database.isOpen()==false){
         Data_Base::database_check_connection(&ptr_database);
 		//renew the sql-command
 		table_model->submitAll();
 	}
-	my_locker.unlock();
 }
-//Get a list of existing tables in the database (thread safe, due to lockinq with QMutex) (static)
+//Get a list of existing tables in the database (thread safe, due to locking of the connection) (static)
 void Data_Base::database_tables(QStringList *table_list, QSqlDatabase *ptr_database){
 	
-	my_locker.lock();
+	QMutexLocker locker(Data_Base::get_connection_locker(ptr_database->connectionName()));
 	*table_list=ptr_database->tables(QSql::Tables);
 	
 	if(ptr_database->lastError().isValid()==true || table_list->size()<=0){
@@ -611,11 +613,10 @@ void Data_Base::database_tables(QStringList *table_list, QSqlDatabase *ptr_datab
 		//renew the sql-command
 		*table_list=ptr_database->tables(QSql::Tables);
 	}
-	my_locker.unlock();
 }
-//Get a list of existing columns of a database table in the database (thread safe, due to lockinq with QMutex) (static)
+//Get a list of existing columns of a database table in the database (thread safe, due to locking of the connection) (static)
 void Data_Base::database_table_columns(QSqlRecord *columns, QString table_name, QSqlDatabase *ptr_database){
-	my_locker.lock();
+	QMutexLocker locker(Data_Base::get_connection_locker(ptr_database->connectionName()));
 	(*columns)=ptr_database->record(table_name);
 
 
@@ -625,9 +626,8 @@ void Data_Base::database_table_columns(QSqlRecord *columns, QString table_name,
 		//renew the sql-command
 		(*columns)=ptr_database->record(table_name);
 	}
-	my_locker.unlock();
 }
-//Get a list of existing columns of a database table in the database by an query (thread safe, due to lockinq with QMutex); please use this function instead of database_table_columns(...) (static)
+//Get a list of existing columns of a database table in the database by an query (thread safe, due to locking of the connection); please use this function instead of database_table_columns(...) (static)
 void Data_Base::database_table_columns_query(QSqlRecord *columns, string schema_name, string table_name, QSqlDatabase *ptr_database) {
 
 	
@@ -665,6 +665,83 @@ void Data_Base::database_table_columns_query(QSqlRecord *columns, string schema_
 
 	} while (my_query.next() == true);
 
+}
+//Prepare a query with the given statement for bound values (thread safe, due to locking of the connection); false is returned, if the preparation failed (static)
+bool Data_Base::database_prepare(QSqlQuery *query, string querystring, QSqlDatabase *ptr_database){
+	QMutexLocker locker(Data_Base::get_connection_locker(ptr_database->connectionName()));
+	return query->prepare(querystring.c_str());
+}
+//Execute a prepared query with its bound values (thread safe, due to locking of the connection) (static)
+void Data_Base::database_prepared_request(QSqlQuery *query, QSqlDatabase *ptr_database){
+	QMutexLocker locker(Data_Base::get_connection_locker(ptr_database->connectionName()));
+	query->exec();
+	if(query->lastError().isValid()==true && ptr_database->isOpen()==false){
+		//the bound values are not repeated; the caller gets the error
+		Data_Base::database_check_connection(ptr_database);
+	}
+}
+//Check if data rows can be sent via COPY ... FROM STDIN (PostgreSQL connection and libpq available) (static)
+bool Data_Base::check_copy_available(QSqlDatabase *ptr_database){
+#ifdef SYS_LIBPQ_COPY
+	if(ptr_database==NULL || ptr_database->isOpen()==false || ptr_database->driver()==NULL){
+		return false;
+	}
+	QVariant handle=ptr_database->driver()->handle();
+	if(handle.isValid()==false || qstrcmp(handle.typeName(), "PGconn*")!=0){
+		return false;
+	}
+	return (*static_cast<PGconn **>(handle.data())!=NULL);
+#else
+	Q_UNUSED(ptr_database);
+	return false;
+#endif
+}
+//Send data rows in the COPY text format via the given COPY ... FROM STDIN statement (thread safe, due to locking of the connection); false is returned, if the copy failed (static)
+bool Data_Base::database_copy(const string copy_statement, const QByteArray &data, QSqlDatabase *ptr_database, string *error_text){
+#ifdef SYS_LIBPQ_COPY
+	if(Data_Base::check_copy_available(ptr_database)==false){
+		*error_text="COPY is not available for the database connection";
+		return false;
+	}
+	QMutexLocker locker(Data_Base::get_connection_locker(ptr_database->connectionName()));
+	PGconn *connection=*static_cast<PGconn **>(ptr_database->driver()->handle().data());
+
+	PGresult *result=PQexec(connection, copy_statement.c_str());
+	if(PQresultStatus(result)!=PGRES_COPY_IN){
+		*error_text=PQerrorMessage(connection);
+		PQclear(result);
+		return false;
+	}
+	PQclear(result);
+
+	bool ok=true;
+	if(PQputCopyData(connection, data.constData(), data.size())!=1){
+		ok=false;
+		*error_text=PQerrorMessage(connection);
+	}
+	//a failed copy is ended with an error message, that the server rolls the rows back
+	if(PQputCopyEnd(connection, ok==true ? NULL : "Sending of the data rows failed")!=1){
+		ok=false;
+		*error_text=PQerrorMessage(connection);
+	}
+	//the results of the COPY have to be read completely before the next statement
+	while((result=PQgetResult(connection))!=NULL){
+		if(PQresultStatus(result)!=PGRES_COMMAND_OK){
+			if(ok==true){
+				*error_text=PQresultErrorMessage(result);
+			}
+			ok=false;
+		}
+		PQclear(result);
+	}
+	return ok;
+#else
+	Q_UNUSED(copy_statement);
+	Q_UNUSED(data);
+	Q_UNUSED(ptr_database);
+	*error_text="COPY is not available (compiled without libpq)";
+	return false;
+#endif
 }
 //Convert the driver name into an enumerator of the driver types (static)
 _sys_driver_type Data_Base::convert_txt2drivertype(const string txt){
@@ -843,6 +920,12 @@ void Data_Base::set_reconnection_flag(const bool flag){
 }
 //______________________________________
 //private:
+//Get the locker of a database connection; it is allocated by the first request of the connection (static)
+QMutex* Data_Base::get_connection_locker(const QString connection_name){
+	QMutexLocker locker(&Data_Base::pool_locker);
+	//the locker is constructed in place by the first request; the connection names are reused, thus the number of lockers is bounded
+	return &Data_Base::connection_lockers[connection_name];
+}
 //Set the database connection parameters per file
 void Data_Base::read_input(void){
 	this->set_output_prefix();
@@ -9,7 +9,8 @@
 #define DATA_BASE_H
 
 //libs
- 
+#include <map>
+
 //qt libs
 //from the Qt open sorce version;
 #include <QtSql>
@@ -65,6 +66,9 @@ The database connection is managed with this class. Two drivers are implemented:
 	- QPostgreSql
 	- QMySql (it has no connection to QGis yet)
 
+The static database requests are locked per connection (connection name): the threads (e.g. the hydraulic
+systems, the fpl or damage calculation) work with their own cloned connections and do not wait for each
+other. Just the bookkeeping of the lockers is protected by a global locker.
 */
 class Data_Base
 {
@@ -126,24 +130,33 @@ public:
 	void set_input_byfile(const string file_name);
 
 
-	///Set a query to the database via QSqlTableModel (thread safe, due to lockinq with QMutex)
+	///Set a query to the database via QSqlTableModel (thread safe, due to locking of the connection)
 	static void database_request(QSqlTableModel *table_model);
-	///Set a query to the database via QSqlTableModel and a qiven query string (thread safe, due to lockinq with QMutex)
+	///Set a query to the database via QSqlTableModel and a qiven query string (thread safe, due to locking of the connection)
 	static void database_request(QSqlQuery *query, string querystring, QSqlDatabase *ptr_database);
-	///Set a query to the database via QSqlTableModel, a qiven query string and a pointer to the database (thread safe, due to lockinq with QMutex)
+	///Set a query to the database via QSqlTableModel, a qiven query string and a pointer to the database (thread safe, due to locking of the connection)
 	static void database_request(QSqlQueryModel *query_model, string querystring, QSqlDatabase *ptr_database);
 	///Check the database connection in case of an error
 	static void database_check_connection(QSqlDatabase *ptr_database);
-	///Submit data to the database via QSqlTableModel (thread safe, due to lockinq with QMutex)
+	///Submit data to the database via QSqlTableModel (thread safe, due to locking of the connection)
 	static void database_submit(QSqlTableModel *table_model);
-	///Get a list of existing tables in the database (thread safe, due to lockinq with QMutex)
+	///Get a list of existing tables in the database (thread safe, due to locking of the connection)
 	static void database_tables(QStringList *table_list, QSqlDatabase *ptr_database);
-	///Get a list of existing columns of a database table in the database (thread safe, due to lockinq with QMutex); problems with newer postgre database version (5.2.2021); columns is always zero
+	///Get a list of existing columns of a database table in the database (thread safe, due to locking of the connection); problems with newer postgre database version (5.2.2021); columns is always zero
 	static void database_table_columns(QSqlRecord *columns, QString table_name, QSqlDatabase *ptr_database);
 
-	///Get a list of existing columns of a database table in the database by an query (thread safe, due to lockinq with QMutex); please use this function instead of database_table_columns(...) 
+	///Get a list of existing columns of a database table in the database by an query (thread safe, due to locking of the connection); please use this function instead of database_table_columns(...) 
 	static void database_table_columns_query(QSqlRecord *columns, string schema_name,  string table_name, QSqlDatabase *ptr_database);
 
+	///Prepare a query with the given statement for bound values (thread safe, due to locking of the connection); false is returned, if the preparation failed
+	static bool database_prepare(QSqlQuery *query, string querystring, QSqlDatabase *ptr_database);
+	///Execute a prepared query with its bound values (thread safe, due to locking of the connection)
+	static void database_prepared_request(QSqlQuery *query, QSqlDatabase *ptr_database);
+	///Check if data rows can be sent via COPY ... FROM STDIN (PostgreSQL connection and libpq available)
+	static bool check_copy_available(QSqlDatabase *ptr_database);
+	///Send data rows in the COPY text format via the given COPY ... FROM STDIN statement (thread safe, due to locking of the connection); false is returned, if the copy failed
+	static bool database_copy(const string copy_statement, const QByteArray &data, QSqlDatabase *ptr_database, string *error_text);
+
 	///Convert the driver name into an enumerator of the driver types
 	static _sys_driver_type convert_txt2drivertype(const string txt);
 	
@@ -182,8 +195,10 @@ private:
 	///Driver type of the database connection
 	static _sys_driver_type driver_type;
 
-	///Locker class for different database actions, which are used from different threads
-	static QMutex my_locker;
+	///Locker for the bookkeeping of the connection lockers
+	static QMutex pool_locker;
+	///Lockers for the database actions per connection name, which are used from different threads; they are stored by value and are not moved by new entries
+	static map<QString, QMutex> connection_lockers;
 	
 	///Database, which is connected
 	QSqlDatabase database;
@@ -198,6 +213,9 @@ private:
 	static bool reconnect_flag;
 
 	//methods
+	///Get the locker of a database connection; it is allocated by the first request of the connection (static)
+	static QMutex* get_connection_locker(const QString connection_name);
+
 	///Set the database connection parameters per file
 	void read_input(void);
 	
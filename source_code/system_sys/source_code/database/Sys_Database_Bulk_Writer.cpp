@@ -0,0 +1,436 @@
+#include "Sys_Headers_Precompiled.h"
+//#include "Sys_Database_Bulk_Writer.h"
+
+//Constructor with the database
+Sys_Database_Bulk_Writer::Sys_Database_Bulk_Writer(QSqlDatabase *ptr_database):query(*ptr_database){
+	this->ptr_database=ptr_database;
+	this->table_name=label::not_set;
+	this->init_flag=false;
+	this->copy_flag=false;
+	this->copy_statement=label::not_set;
+	this->prepared_rows=0;
+	this->number_fields=0;
+	this->number_rows=0;
+	this->rows_per_package=Sys_Database_Bulk_Writer::default_rows_per_statement;
+	this->rows_per_transaction=Sys_Database_Bulk_Writer::default_rows_per_transaction;
+	this->rows_in_transaction=0;
+	this->number_written_rows=0;
+	this->transaction_flag=false;
+	this->last_error=label::not_set;
+	Sys_Memory_Count::self()->add_mem(sizeof(Sys_Database_Bulk_Writer), _sys_system_modules::SYS_SYS);
+}
+//Default destructor
+Sys_Database_Bulk_Writer::~Sys_Database_Bulk_Writer(void){
+	//rows, which are not sent, are discarded; a not finished transaction is rolled back
+	if(this->transaction_flag==true){
+		this->ptr_database->rollback();
+		this->transaction_flag=false;
+	}
+	Sys_Memory_Count::self()->minus_mem(sizeof(Sys_Database_Bulk_Writer), _sys_system_modules::SYS_SYS);
+}
+//______________
+//public
+//Set the name of the table (with schema), which is written
+void Sys_Database_Bulk_Writer::set_table(const string table_name){
+	this->table_name=table_name;
+}
+//Add a column of the table; all columns have to be added before the first field is given
+void Sys_Database_Bulk_Writer::add_column(const string column_name, const _sys_bulk_column_type type){
+	this->column_names.push_back(column_name);
+	this->column_types.push_back(type);
+}
+//Set the number of rows after which the transaction is committed
+void Sys_Database_Bulk_Writer::set_rows_per_transaction(const int number){
+	this->rows_per_transaction=number;
+	if(this->rows_per_transaction<1){
+		this->rows_per_transaction=1;
+	}
+}
+//Add an integer value to the current row
+void Sys_Database_Bulk_Writer::add_int(const int value){
+	this->add_value(QVariant(value), QByteArray::number(value));
+}
+//Add a double value to the current row
+void Sys_Database_Bulk_Writer::add_double(const double value){
+	QByteArray buffer;
+	if(qIsNaN(value)==true){
+		buffer="NaN";
+	}
+	else if(qIsInf(value)==true){
+		if(value>0.0){
+			buffer="Infinity";
+		}
+		else{
+			buffer="-Infinity";
+		}
+	}
+	else{
+		buffer=QByteArray::number(value, 'g', 15);
+	}
+	this->add_value(QVariant(value), buffer);
+}
+//Add a boolean value to the current row
+void Sys_Database_Bulk_Writer::add_bool(const bool value){
+	if(value==true){
+		this->add_value(QVariant(value), QByteArray("t"));
+	}
+	else{
+		this->add_value(QVariant(value), QByteArray("f"));
+	}
+}
+//Add a text value (without quotes) to the current row
+void Sys_Database_Bulk_Writer::add_text(const string value){
+	this->start_field();
+	if(this->copy_flag==true){
+		this->copy_buffer.append(this->escape_copy_text(value));
+	}
+	else{
+		this->values.append(QVariant(QString(value.c_str())));
+	}
+}
+//Add a value, which is given as quoted sql-literal (e.g. a time '2000-01-01 00:00:00'), to the current row
+void Sys_Database_Bulk_Writer::add_literal(const string literal){
+	string buffer=literal;
+	//remove the surrounding blanks and quotes of the literal
+	size_t begin=buffer.find_first_not_of(" ");
+	size_t end=buffer.find_last_not_of(" ");
+	if(begin==string::npos){
+		buffer.clear();
+	}
+	else{
+		buffer=buffer.substr(begin, end-begin+1);
+	}
+	if(buffer.length()>=2 && buffer.at(0)=='\'' && buffer.at(buffer.length()-1)=='\''){
+		buffer=buffer.substr(1, buffer.length()-2);
+	}
+	this->add_text(buffer);
+}
+//Add a geometry as well-known text to the current row
+void Sys_Database_Bulk_Writer::add_wkt(const string wkt){
+	if(wkt.empty()==true){
+		this->add_null();
+		return;
+	}
+	this->add_text(wkt);
+}
+//Add a polygon as geometry to the current row (well-known binary)
+void Sys_Database_Bulk_Writer::add_polygon(_Geo_Polygon *polygon){
+	string buffer=polygon->get_polygon2wkb_hex();
+	if(buffer.empty()==true){
+		this->add_null();
+		return;
+	}
+	this->add_text(buffer);
+}
+//Add a null value to the current row
+void Sys_Database_Bulk_Writer::add_null(void){
+	this->add_value(QVariant(), QByteArray("\\N"));
+}
+//Finish the current row; the package is sent, if it is full; false is returned, if the sent package failed
+bool Sys_Database_Bulk_Writer::end_row(void){
+	if(this->number_fields!=(int)this->column_names.size()){
+		Error msg=this->set_error(0);
+		ostringstream info;
+		info << "Table name       : " << this->table_name << endl;
+		info << "Number columns   : " << this->column_names.size() << endl;
+		info << "Number fields    : " << this->number_fields << endl;
+		msg.make_second_info(info.str());
+		throw msg;
+	}
+	if(this->copy_flag==true){
+		this->copy_buffer.append('\n');
+	}
+	this->number_fields=0;
+	this->number_rows++;
+
+	if(this->number_rows>=this->rows_per_package){
+		return this->send_package();
+	}
+	return true;
+}
+//Send the collected rows and commit the transaction; false is returned, if the last package failed; a failed commit is thrown
+bool Sys_Database_Bulk_Writer::finish(void){
+	bool ok=this->send_package();
+	this->commit_transaction();
+	return ok;
+}
+//Get the error text of the last failed package
+string Sys_Database_Bulk_Writer::get_last_error(void){
+	return this->last_error;
+}
+//Get the number of rows, which are committed or written in the current transaction
+int Sys_Database_Bulk_Writer::get_number_written_rows(void){
+	return this->number_written_rows;
+}
+//______________
+//private
+//Initialize the writer with the first field: decide how the packages are sent
+void Sys_Database_Bulk_Writer::init_writer(void){
+	this->init_flag=true;
+	this->copy_flag=Data_Base::check_copy_available(this->ptr_database);
+	if(this->copy_flag==true){
+		this->rows_per_package=Sys_Database_Bulk_Writer::default_rows_per_copy;
+		this->copy_statement="COPY "+this->table_name+" (";
+		for(unsigned int i=0; i<this->column_names.size(); i++){
+			if(i>0){
+				this->copy_statement.append(" , ");
+			}
+			this->copy_statement.append(this->column_names.at(i));
+		}
+		this->copy_statement.append(") FROM STDIN");
+	}
+	else{
+		//the number of bound values per statement is limited
+		int max_rows=Sys_Database_Bulk_Writer::max_values_per_statement/max(1, (int)this->column_names.size());
+		this->rows_per_package=Sys_Database_Bulk_Writer::default_rows_per_statement;
+		if(this->rows_per_package>max_rows){
+			this->rows_per_package=max(1, max_rows);
+		}
+	}
+}
+//Start the field of the current row
+void Sys_Database_Bulk_Writer::start_field(void){
+	if(this->init_flag==false){
+		this->init_writer();
+	}
+	if(this->copy_flag==true && this->number_fields>0){
+		this->copy_buffer.append('\t');
+	}
+	this->number_fields++;
+}
+//Add a value to the current row
+void Sys_Database_Bulk_Writer::add_value(const QVariant value, const QByteArray copy_text){
+	this->start_field();
+	if(this->copy_flag==true){
+		this->copy_buffer.append(copy_text);
+	}
+	else{
+		this->values.append(value);
+	}
+}
+//Escape a text for the COPY text format
+QByteArray Sys_Database_Bulk_Writer::escape_copy_text(const string text){
+	QByteArray buffer;
+	buffer.reserve((int)text.length());
+	for(unsigned int i=0; i<text.length(); i++){
+		switch(text.at(i)){
+			case '\\':
+				buffer.append("\\\\");
+				break;
+			case '\t':
+				buffer.append("\\t");
+				break;
+			case '\n':
+				buffer.append("\\n");
+				break;
+			case '\r':
+				buffer.append("\\r");
+				break;
+			default:
+				buffer.append(text.at(i));
+		}
+	}
+	return buffer;
+}
+//Send the collected rows; false is returned, if the package failed
+bool Sys_Database_Bulk_Writer::send_package(void){
+	if(this->number_rows==0){
+		return true;
+	}
+	if(this->transaction_flag==false && this->ptr_database->driver()->hasFeature(QSqlDriver::Transactions)==true){
+		this->transaction_flag=this->ptr_database->transaction();
+		this->rows_in_transaction=0;
+	}
+	//a failed package is rolled back to the savepoint before it; the rows of the transaction, which are already sent, are kept
+	bool savepoint_flag=false;
+	if(this->transaction_flag==true){
+		savepoint_flag=this->savepoint_request("SAVEPOINT sys_bulk_package");
+		if(savepoint_flag==false){
+			//without a savepoint the sent rows are committed before; just the package is at risk
+			this->commit_transaction();
+		}
+	}
+
+	bool ok=true;
+	if(this->copy_flag==true){
+		string error_text;
+		ok=Data_Base::database_copy(this->copy_statement, this->copy_buffer, this->ptr_database, &error_text);
+		if(ok==false){
+			this->last_error=error_text;
+		}
+		this->copy_buffer.clear();
+	}
+	else{
+		ok=this->prepare_statement(this->number_rows);
+		if(ok==true){
+			for(int i=0; i<this->values.size(); i++){
+				this->query.addBindValue(this->values.at(i));
+			}
+			Data_Base::database_prepared_request(&this->query, this->ptr_database);
+			if(this->query.lastError().isValid()){
+				ok=false;
+				this->last_error=this->query.lastError().text().toStdString();
+			}
+		}
+		this->values.clear();
+	}
+
+	if(ok==true){
+		if(savepoint_flag==true){
+			this->savepoint_request("RELEASE SAVEPOINT sys_bulk_package");
+		}
+		this->number_written_rows=this->number_written_rows+this->number_rows;
+		this->rows_in_transaction=this->rows_in_transaction+this->number_rows;
+		this->number_rows=0;
+		if(this->transaction_flag==true && this->rows_in_transaction>=this->rows_per_transaction){
+			this->commit_transaction();
+		}
+	}
+	else{
+		ostringstream info;
+		info << this->last_error << "; " << this->number_rows << " row(s) of the package are not written";
+		this->last_error=info.str();
+		this->number_rows=0;
+		if(savepoint_flag==true && this->savepoint_request("ROLLBACK TO SAVEPOINT sys_bulk_package")==false){
+			//the transaction can not be continued: the rows of the transaction are lost
+			Error msg=this->set_error(2);
+			ostringstream info_error;
+			info_error << "Table name       : " << this->table_name << endl;
+			info_error << "Lost rows        : " << this->rows_in_transaction << endl;
+			info_error << "Table error info : " << this->last_error << endl;
+			msg.make_second_info(info_error.str());
+			this->rollback_transaction();
+			throw msg;
+		}
+	}
+	return ok;
+}
+//Prepare the insert statement for the given number of rows
+bool Sys_Database_Bulk_Writer::prepare_statement(const int rows){
+	if(this->prepared_rows==rows){
+		return true;
+	}
+	this->prepared_rows=0;
+	//placeholders of one row
+	string row="(";
+	for(unsigned int i=0; i<this->column_types.size(); i++){
+		if(i>0){
+			row.append(" , ");
+		}
+		switch(this->column_types.at(i)){
+			case _sys_bulk_column_type::bulk_geometry_wkt:
+				row.append("ST_GEOMFROMTEXT(?)");
+				break;
+			case _sys_bulk_column_type::bulk_geometry_wkb:
+				if(Data_Base::get_driver_type()==_sys_driver_type::POSTGRESQL){
+					row.append("ST_GEOMFROMWKB(decode(?, 'hex'))");
+				}
+				else{
+					row.append("ST_GEOMFROMWKB(UNHEX(?))");
+				}
+				break;
+			default:
+				row.append("?");
+		}
+	}
+	row.append(")");
+
+	string statement="INSERT INTO "+this->table_name+" (";
+	for(unsigned int i=0; i<this->column_names.size(); i++){
+		if(i>0){
+			statement.append(" , ");
+		}
+		statement.append(this->column_names.at(i));
+	}
+	statement.append(") VALUES ");
+	statement.reserve(statement.length()+rows*(row.length()+2));
+	for(int i=0; i<rows; i++){
+		if(i>0){
+			statement.append(",");
+		}
+		statement.append(row);
+	}
+
+	if(Data_Base::database_prepare(&this->query, statement, this->ptr_database)==false){
+		this->last_error=this->query.lastError().text().toStdString();
+		return false;
+	}
+	this->prepared_rows=rows;
+	return true;
+}
+//Send a savepoint request in the current transaction; false is returned, if the request failed
+bool Sys_Database_Bulk_Writer::savepoint_request(const string request){
+	QSqlQuery query_buff(*this->ptr_database);
+	Data_Base::database_request(&query_buff, request, this->ptr_database);
+	return !query_buff.lastError().isValid();
+}
+//Commit the current transaction; a failed commit is thrown
+void Sys_Database_Bulk_Writer::commit_transaction(void){
+	if(this->transaction_flag==false){
+		return;
+	}
+	this->transaction_flag=false;
+	if(this->ptr_database->commit()==false){
+		string error_text=this->ptr_database->lastError().text().toStdString();
+		this->ptr_database->rollback();
+		this->number_written_rows=this->number_written_rows-this->rows_in_transaction;
+		Error msg=this->set_error(1);
+		ostringstream info;
+		info << "Table name       : " << this->table_name << endl;
+		info << "Lost rows        : " << this->rows_in_transaction << endl;
+		info << "Table error info : " << error_text << endl;
+		msg.make_second_info(info.str());
+		this->rows_in_transaction=0;
+		throw msg;
+	}
+	this->rows_in_transaction=0;
+}
+//Roll back the current transaction, if a failed package can not be rolled back to its savepoint
+void Sys_Database_Bulk_Writer::rollback_transaction(void){
+	if(this->transaction_flag==false){
+		return;
+	}
+	this->ptr_database->rollback();
+	this->transaction_flag=false;
+	this->number_written_rows=this->number_written_rows-this->rows_in_transaction;
+	this->rows_in_transaction=0;
+}
+//Set error(s)
+Error Sys_Database_Bulk_Writer::set_error(const int err_type){
+	string place="Sys_Database_Bulk_Writer::";
+	string help;
+	string reason;
+	int type=0;
+	bool fatal=false;
+	stringstream info;
+	Error msg;
+
+	switch (err_type){
+		case 0://wrong number of fields
+			place.append("end_row(void)");
+			reason="The number of fields of the row does not fit to the number of columns";
+			help="Check the code";
+			type=6;
+			break;
+		case 1://commit failed
+			place.append("commit_transaction(void)");
+			reason="Can not commit the transaction of the written rows";
+			help="Check the database";
+			type=2;
+			break;
+		case 2://rollback to the savepoint failed
+			place.append("send_package(void)");
+			reason="Can not roll back a failed package to its savepoint; the transaction of the written rows is rolled back";
+			help="Check the database";
+			type=2;
+			break;
+		default:
+			place.append("set_error(const int err_type)");
+			reason ="Unknown flag!";
+			help="Check the flags";
+			type=6;
+	}
+	msg.set_msg(place, reason, help, type, fatal);
+	msg.make_second_info(info.str());
+	return msg;
+}
@@ -0,0 +1,170 @@
+#pragma once
+/**\class Sys_Database_Bulk_Writer
+	\author Daniel Bachmann et al.
+	\author produced by the Institute of Hydraulic Engineering (IWW), RWTH Aachen University
+	\version 0.0.1
+	\date 2009
+*/
+#ifndef SYS_DATABASE_BULK_WRITER_H
+#define SYS_DATABASE_BULK_WRITER_H
+
+//libs
+#include <string>
+#include <vector>
+
+//qt libs
+#include <QtSql>
+
+//system sys class
+#include "Data_Base.h"
+
+using namespace std;
+
+//forward declaration
+class _Geo_Polygon;
+
+///Enumerator for the type of the columns, which are written by the bulk writer \ingroup sys
+enum _sys_bulk_column_type{
+	///Column of a plain value (number, boolean, text, time)
+	bulk_value,
+	///Geometry column; the geometry is given as well-known text (WKT)
+	bulk_geometry_wkt,
+	///Geometry column; the geometry is given as hex-string of the well-known binary (WKB)
+	bulk_geometry_wkb,
+};
+
+///Class for writing a large number of data rows to a database table \ingroup sys
+/**
+The columns of the table are set once; the data rows are given field by field as values (no sql-strings).
+The rows are collected and sent in packages:
+	- PostgreSQL with libpq (define SYS_LIBPQ_COPY): the package is sent via COPY ... FROM STDIN in
+	text format; the geometries are given as WKT or hex-WKB text, which PostGIS accepts directly
+	- other drivers: the package is sent as a prepared multi-row insert with bound values; the prepared
+	statement is reused for all full packages
+
+The packages are written in transactions, which are committed after a bounded number of rows. Each package
+is sent behind a savepoint: if a package failed, just this package is rolled back and reported, the other rows
+of the transaction are kept and the writing goes on. A failed commit or a failed rollback to the savepoint is
+thrown as an error.
+
+\see Data_Base
+*/
+class Sys_Database_Bulk_Writer
+{
+public:
+	///Constructor with the database
+	Sys_Database_Bulk_Writer(QSqlDatabase *ptr_database);
+	///Default destructor
+	~Sys_Database_Bulk_Writer(void);
+
+	//members
+	///Default number of rows per package sent via COPY
+	static const int default_rows_per_copy=20000;
+	///Default number of rows per prepared insert statement
+	static const int default_rows_per_statement=500;
+	///Maximum number of bound values per prepared insert statement
+	static const int max_values_per_statement=30000;
+	///Default number of rows per transaction
+	static const int default_rows_per_transaction=200000;
+
+	//methods
+	///Set the name of the table (with schema), which is written
+	void set_table(const string table_name);
+	///Add a column of the table; all columns have to be added before the first field is given
+	void add_column(const string column_name, const _sys_bulk_column_type type=_sys_bulk_column_type::bulk_value);
+	///Set the number of rows after which the transaction is committed
+	void set_rows_per_transaction(const int number);
+
+	///Add an integer value to the current row
+	void add_int(const int value);
+	///Add a double value to the current row
+	void add_double(const double value);
+	///Add a boolean value to the current row
+	void add_bool(const bool value);
+	///Add a text value (without quotes) to the current row
+	void add_text(const string value);
+	///Add a value, which is given as quoted sql-literal (e.g. a time '2000-01-01 00:00:00'), to the current row
+	void add_literal(const string literal);
+	///Add a geometry as well-known text to the current row
+	void add_wkt(const string wkt);
+	///Add a polygon as geometry to the current row (well-known binary)
+	void add_polygon(_Geo_Polygon *polygon);
+	///Add a null value to the current row
+	void add_null(void);
+	///Finish the current row; the package is sent, if it is full; false is returned, if the sent package failed
+	bool end_row(void);
+	///Send the collected rows and commit the transaction; false is returned, if the last package failed; a failed commit is thrown
+	bool finish(void);
+
+	///Get the error text of the last failed package
+	string get_last_error(void);
+	///Get the number of rows, which are committed or written in the current transaction
+	int get_number_written_rows(void);
+
+private:
+	//members
+	///Pointer to the database
+	QSqlDatabase *ptr_database;
+	///Query for the prepared insert statements
+	QSqlQuery query;
+	///Name of the table
+	string table_name;
+	///Names of the columns
+	vector<string> column_names;
+	///Types of the columns
+	vector<_sys_bulk_column_type> column_types;
+
+	///Flag if the writer is initialized (first field of the first row)
+	bool init_flag;
+	///Flag if the packages are sent via COPY
+	bool copy_flag;
+	///COPY statement
+	string copy_statement;
+	///Collected rows of the package in COPY text format
+	QByteArray copy_buffer;
+	///Collected values of the package for the prepared insert statement
+	QVariantList values;
+	///Number of rows, for which the insert statement is prepared
+	int prepared_rows;
+
+	///Number of fields of the current row
+	int number_fields;
+	///Number of collected rows of the package
+	int number_rows;
+	///Number of rows per package
+	int rows_per_package;
+	///Number of rows per transaction
+	int rows_per_transaction;
+	///Number of rows, which are written in the current transaction
+	int rows_in_transaction;
+	///Number of rows, which are committed or written in the current transaction
+	int number_written_rows;
+	///Flag if a transaction is started
+	bool transaction_flag;
+	///Error text of the last failed package
+	string last_error;
+
+	//methods
+	///Initialize the writer with the first field: decide how the packages are sent
+	void init_writer(void);
+	///Start the field of the current row
+	void start_field(void);
+	///Add a value to the current row
+	void add_value(const QVariant value, const QByteArray copy_text);
+	///Escape a text for the COPY text format
+	QByteArray escape_copy_text(const string text);
+	///Send the collected rows; false is returned, if the package failed
+	bool send_package(void);
+	///Prepare the insert statement for the given number of rows
+	bool prepare_statement(const int rows);
+	///Send a savepoint request in the current transaction; false is returned, if the request failed
+	bool savepoint_request(const string request);
+	///Commit the current transaction; a failed commit is thrown
+	void commit_transaction(void);
+	///Roll back the current transaction, if a failed package can not be rolled back to its savepoint
+	void rollback_transaction(void);
+
+	///Set error(s)
+	Error set_error(const int err_type);
+};
+#endif
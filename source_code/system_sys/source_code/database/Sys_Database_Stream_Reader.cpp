@@ -0,0 +1,142 @@
+#include "Sys_Headers_Precompiled.h"
+//#include "Sys_Database_Stream_Reader.h"
+
+//init static members
+QAtomicInt Sys_Database_Stream_Reader::cursor_counter(0);
+
+//Constructor with the database and the number of rows per fetched package
+Sys_Database_Stream_Reader::Sys_Database_Stream_Reader(QSqlDatabase *ptr_database, const int rows_per_fetch):query(*ptr_database){
+	this->ptr_database=ptr_database;
+	this->rows_per_fetch=rows_per_fetch;
+	if(this->rows_per_fetch<1){
+		this->rows_per_fetch=1;
+	}
+	this->number_read_rows=0;
+	this->cursor_flag=false;
+	this->end_flag=false;
+	this->cursor_name=label::not_set;
+	this->last_error=label::not_set;
+	Sys_Memory_Count::self()->add_mem(sizeof(Sys_Database_Stream_Reader), _sys_system_modules::SYS_SYS);
+}
+//Default destructor
+Sys_Database_Stream_Reader::~Sys_Database_Stream_Reader(void){
+	this->close();
+	Sys_Memory_Count::self()->minus_mem(sizeof(Sys_Database_Stream_Reader), _sys_system_modules::SYS_SYS);
+}
+//______________
+//public
+//Execute the select statement; false is returned, if the statement failed
+bool Sys_Database_Stream_Reader::execute(const string select){
+	this->close();
+	this->number_read_rows=0;
+	this->last_error=label::not_set;
+
+	//a cursor of PostgreSQL is just valid in a transaction
+	if(Data_Base::get_driver_type()==_sys_driver_type::POSTGRESQL && this->ptr_database->driver()->hasFeature(QSqlDriver::Transactions)==true){
+		this->cursor_flag=this->ptr_database->transaction();
+	}
+
+	if(this->cursor_flag==true){
+		ostringstream buff;
+		buff<<"sys_stream_reader_"<<Sys_Database_Stream_Reader::cursor_counter.fetchAndAddOrdered(1);
+		this->cursor_name=buff.str();
+
+		ostringstream declare;
+		declare<<"DECLARE "<<this->cursor_name<<" NO SCROLL CURSOR FOR "<<select;
+		Data_Base::database_request(&this->query, declare.str(), this->ptr_database);
+		if(this->query.lastError().isValid()){
+			this->last_error=this->query.lastError().text().toStdString();
+			this->close();
+			return false;
+		}
+		return this->fetch_package();
+	}
+
+	this->query.setForwardOnly(true);
+	Data_Base::database_request(&this->query, select, this->ptr_database);
+	if(this->query.lastError().isValid()){
+		this->last_error=this->query.lastError().text().toStdString();
+		this->query.clear();
+		return false;
+	}
+	return true;
+}
+//Read the next row; false is returned, if there are no more rows or the fetch failed
+bool Sys_Database_Stream_Reader::next_row(void){
+	if(this->query.isActive()==false){
+		return false;
+	}
+	if(this->query.next()==true){
+		this->number_read_rows++;
+		return true;
+	}
+	if(this->cursor_flag==false || this->end_flag==true){
+		if(this->query.lastError().isValid()){
+			this->last_error=this->query.lastError().text().toStdString();
+		}
+		return false;
+	}
+	//the package is read; the next one is fetched from the cursor
+	if(this->fetch_package()==false){
+		return false;
+	}
+	if(this->query.next()==true){
+		this->number_read_rows++;
+		return true;
+	}
+	this->end_flag=true;
+	return false;
+}
+//Close the reader; the cursor and its transaction are closed
+void Sys_Database_Stream_Reader::close(void){
+	this->query.clear();
+	if(this->cursor_flag==true){
+		//the cursor is closed with the end of the transaction
+		if(this->ptr_database->commit()==false){
+			this->ptr_database->rollback();
+		}
+		this->cursor_flag=false;
+	}
+	this->end_flag=false;
+	this->cursor_name=label::not_set;
+}
+//Get the value of a column of the current row as integer
+int Sys_Database_Stream_Reader::get_int(const int column){
+	return this->query.value(column).toInt();
+}
+//Get the value of a column of the current row as double
+double Sys_Database_Stream_Reader::get_double(const int column){
+	return this->query.value(column).toDouble();
+}
+//Get the value of a column of the current row as string
+string Sys_Database_Stream_Reader::get_string(const int column){
+	return this->query.value(column).toString().toStdString();
+}
+//Get the error text of the last failed statement
+string Sys_Database_Stream_Reader::get_last_error(void){
+	return this->last_error;
+}
+//Get the number of rows, which are read
+int Sys_Database_Stream_Reader::get_number_read_rows(void){
+	return this->number_read_rows;
+}
+//______________
+//private
+//Fetch the next package of rows from the cursor; false is returned, if the fetch failed
+bool Sys_Database_Stream_Reader::fetch_package(void){
+	ostringstream fetch;
+	fetch<<"FETCH FORWARD "<<this->rows_per_fetch<<" FROM "<<this->cursor_name;
+	this->query.clear();
+	this->query.setForwardOnly(true);
+	Data_Base::database_request(&this->query, fetch.str(), this->ptr_database);
+	if(this->query.lastError().isValid()){
+		this->last_error=this->query.lastError().text().toStdString();
+		this->end_flag=true;
+		return false;
+	}
+	//a smaller package is the last one
+	if(this->query.size()>=0 && this->query.size()<this->rows_per_fetch){
+		this->end_flag=true;
+	}
+	return true;
+}
@@ -0,0 +1,92 @@
+#pragma once
+/**\class Sys_Database_Stream_Reader
+	\author Daniel Bachmann et al.
+	\author produced by the Institute of Hydraulic Engineering (IWW), RWTH Aachen University
+	\version 0.0.1
+	\date 2009
+*/
+#ifndef SYS_DATABASE_STREAM_READER_H
+#define SYS_DATABASE_STREAM_READER_H
+
+//libs
+#include <string>
+
+//qt libs
+#include <QtSql>
+#include <QAtomicInt>
+
+//system sys class
+#include "Data_Base.h"
+
+using namespace std;
+
+///Class for reading a large result set of a select statement row by row from the database \ingroup sys
+/**
+In contrast to a QSqlQueryModel the rows are not cached: they are read forward only and each row is
+gone after the next one is read. In case of a PostgreSQL database the select statement is opened as a
+server-side cursor, which is fetched in packages of rows; thus just one package is in the memory of the client.
+For other database drivers (or if no transaction can be started for the cursor) a forward-only query is used.
+The values are read by the index of the column in the select statement, which avoids the search of the
+column name per value.
+
+\see Data_Base, Sys_Database_Bulk_Writer
+*/
+class Sys_Database_Stream_Reader
+{
+public:
+	///Constructor with the database and the number of rows per fetched package
+	Sys_Database_Stream_Reader(QSqlDatabase *ptr_database, const int rows_per_fetch=Sys_Database_Stream_Reader::default_rows_per_fetch);
+	///Default destructor
+	~Sys_Database_Stream_Reader(void);
+
+	//members
+	///Default number of rows per fetched package
+	static const int default_rows_per_fetch=10000;
+
+	//methods
+	///Execute the select statement; false is returned, if the statement failed
+	bool execute(const string select);
+	///Read the next row; false is returned, if there are no more rows or the fetch failed
+	bool next_row(void);
+	///Close the reader; the cursor and its transaction are closed
+	void close(void);
+
+	///Get the value of a column of the current row as integer
+	int get_int(const int column);
+	///Get the value of a column of the current row as double
+	double get_double(const int column);
+	///Get the value of a column of the current row as string
+	string get_string(const int column);
+
+	///Get the error text of the last failed statement
+	string get_last_error(void);
+	///Get the number of rows, which are read
+	int get_number_read_rows(void);
+
+private:
+	//members
+	///Pointer to the database
+	QSqlDatabase *ptr_database;
+	///Query for the rows
+	QSqlQuery query;
+	///Number of rows per fetched package
+	int rows_per_fetch;
+	///Number of rows, which are read
+	int number_read_rows;
+	///Flag if the rows are read via a server-side cursor
+	bool cursor_flag;
+	///Flag if the cursor is completely read
+	bool end_flag;
+	///Name of the cursor
+	string cursor_name;
+	///Error text of the last failed statement
+	string last_error;
+
+	///Counter for unique cursor names
+	static QAtomicInt cursor_counter;
+
+	//methods
+	///Fetch the next package of rows from the cursor; false is returned, if the fetch failed
+	bool fetch_package(void);
+};
+#endif
@@ -495,13 +495,32 @@ void _Geo_Polygon::calculate_segment_interception(Geo_Interception_Point_List *i
 }
 //calculate an interception with a Geo_Poly_Segment and fill the Geo_Interception_Point_List 
 void _Geo_Polygon::calculate_polysegment_interception(Geo_Interception_Point_List *intercept_list, Geo_Polysegment *check_polysegment){
+	try{
+		//all segments are checked
+		this->calculate_polysegment_interception(intercept_list, check_polysegment, NULL, check_polysegment->get_number_segments());
+	}
+	catch(Error msg){
+		throw msg;
+	}
+}
+//Calculate the interception points with selected segments of a Geo_Poly_Segment and fill the Geo_Interception_Point_List; the segment indices have to be sorted ascending; without indices (NULL) the first number_index segments are checked
+void _Geo_Polygon::calculate_polysegment_interception(Geo_Interception_Point_List *intercept_list, Geo_Polysegment *check_polysegment, const int *segment_index, const int number_index){
 
 	//make the interception
 	_geo_multisegment_interception buffer;
 	buffer.line_interception.interception_point.set_point_name(label::interception_point);
 
-
-	for(int j=0; j< check_polysegment->get_number_segments(); j++){
+	int j=0;
+	for(int k=0; k< number_index; k++){
+		if(segment_index!=NULL){
+			j=segment_index[k];
+		}
+		else{
+			j=k;
+		}
+		if(j<0 || j>=check_polysegment->get_number_segments()){
+			continue;
+		}
 		for(int i=0; i< this->number_segments;i++){
 			this->segments[i].calc_interception(&(check_polysegment->my_segment[j]), &(buffer.line_interception));
 			if(buffer.line_interception.interception_flag==true){
@@ -522,15 +541,12 @@ void _Geo_Polygon::calculate_polysegment_interception(Geo_Interception_Point_Lis
 					buffer.distance=check_polysegment->get_distance_along_polysegment(&(buffer.line_interception.interception_point));
 				}
 				catch(Error msg){
-					
 					throw msg;
 				}
 				intercept_list->set_new_point(&buffer);
-				
 			}
 		}
 	}
-
 }
 //Check if a polysegement is partly inside a polygon 
 bool _Geo_Polygon::check_polysegment_partly_inside(Geo_Polysegment *check_polysegment){
@@ -1378,6 +1394,80 @@ string _Geo_Polygon::get_polygon2sql_string(void){
 
 	return buff.str();
 }
+//Get a string for inserting a polygon data to a sql-database as well-known binary (WKB); the coordinates are rounded like in get_polygon2sql_string()
+string _Geo_Polygon::get_polygon2sql_wkb_string(void){
+	return _Geo_Polygon::convert_wkb_hex2sql_string(this->get_polygon2wkb_hex());
+}
+//Get the well-known binary (WKB) of the polygon as hex-string; the coordinates are rounded like in get_polygon2sql_string(); an empty string is returned for a polygon without points
+string _Geo_Polygon::get_polygon2wkb_hex(void){
+	/**The WKB is given as hex-string (little endian, one ring, the first point is repeated at the end). The database
+	does not need to parse the coordinates from text. The coordinates are rounded to mm, like the text of
+	get_polygon2sql_string(); thus neighbouring polygons keep identical points.
+	*/
+	static const char hex_digits[]="0123456789ABCDEF";
+	const int number=this->get_number_points();
+	string hex;
+	if(number<=0){
+		return hex;
+	}
+	hex.reserve(2*(13+(number+1)*16));
+
+	//geometry type (polygon), number of rings, number of points of the ring
+	unsigned int head[3];
+	head[0]=3;
+	head[1]=1;
+	head[2]=(unsigned int)(number+1);
+
+	//byte order: little endian
+	hex.append("01");
+	for(int i=0; i< 3; i++){
+		for(int j=0; j< 4; j++){
+			unsigned char byte=(unsigned char)((head[i]>>(8*j))&0xFF);
+			hex.push_back(hex_digits[byte>>4]);
+			hex.push_back(hex_digits[byte&0x0F]);
+		}
+	}
+	//the points; the first one is repeated to close the ring
+	double coor=0.0;
+	unsigned long long int bits=0;
+	for(int i=0; i<= number; i++){
+		Geo_Point *point=this->get_point(i%number);
+		for(int k=0; k< 2; k++){
+			if(k==0){
+				coor=point->get_xcoordinate();
+			}
+			else{
+				coor=point->get_ycoordinate();
+			}
+			coor=floor(coor*1000.0+0.5)/1000.0;
+			memcpy(&bits, &coor, sizeof(double));
+			for(int j=0; j< 8; j++){
+				unsigned char byte=(unsigned char)((bits>>(8*j))&0xFF);
+				hex.push_back(hex_digits[byte>>4]);
+				hex.push_back(hex_digits[byte&0x0F]);
+			}
+		}
+	}
+	return hex;
+}
+//Get a string for inserting a geometry, which is given as hex-string of the well-known binary (WKB), to a sql-database (static)
+string _Geo_Polygon::convert_wkb_hex2sql_string(const string wkb_hex){
+	if(wkb_hex.empty()==true){
+		return " NULL ";
+	}
+	string buffer;
+	if(Data_Base::get_driver_type()==_sys_driver_type::POSTGRESQL){
+		buffer.append(" ST_GEOMFROMWKB(decode('");
+		buffer.append(wkb_hex);
+		buffer.append("', 'hex')) ");
+	}
+	else{
+		buffer.append(" ST_GEOMFROMWKB(X'");
+		buffer.append(wkb_hex);
+		buffer.append("') ");
+	}
+	return buffer;
+}
 //Clear polygon, the segments of the polygon are deleted
 void _Geo_Polygon::clear_polygon(void){
 
@@ -8,6 +8,8 @@
 #ifndef _GEO_POLYGON_H
 #define _GEO_POLYGON_H
 
+//libs
+#include <cstring>
 
 //system libs
 #include "Geo_Segment.h"
@@ -91,6 +93,8 @@ public:
 
 	///Calculate the interception points with a Geo_Poly_Segment and fill the Geo_Interception_Point_List 
 	void calculate_polysegment_interception(Geo_Interception_Point_List *intercept_list, Geo_Polysegment *check_polysegment);
+	///Calculate the interception points with selected segments of a Geo_Poly_Segment and fill the Geo_Interception_Point_List; the segment indices have to be sorted ascending; without indices (NULL) the first number_index segments are checked
+	void calculate_polysegment_interception(Geo_Interception_Point_List *intercept_list, Geo_Polysegment *check_polysegment, const int *segment_index, const int number_index);
 	///Check if a polysegement is partly inside a polygon 
 	bool check_polysegment_partly_inside(Geo_Polysegment *check_polysegment);
 
@@ -110,6 +114,12 @@ public:
 
 	///Get a string for inserting a polygon data to a sql-database
 	string get_polygon2sql_string(void);
+	///Get a string for inserting a polygon data to a sql-database as well-known binary (WKB); the coordinates are rounded like in get_polygon2sql_string()
+	string get_polygon2sql_wkb_string(void);
+	///Get the well-known binary (WKB) of the polygon as hex-string; the coordinates are rounded like in get_polygon2sql_string(); an empty string is returned for a polygon without points
+	string get_polygon2wkb_hex(void);
+	///Get a string for inserting a geometry, which is given as hex-string of the well-known binary (WKB), to a sql-database
+	static string convert_wkb_hex2sql_string(const string wkb_hex);
 
 	///Clear polygon, the segments of the polygon are deleted
 	void clear_polygon(void);